@@ -97,7 +97,7 @@ void PythonAction::performAction(double time,
       normal                 = vertex.getNormal();
       PyObject *pythonID     = PyInt_FromLong(id);
       PyObject *pythonCoords = PyArray_SimpleNewFromData(1, vdim, NPY_DOUBLE, coords.data());
-      PyObject *pythonNormal = PyArray_SimpleNewFromData(1, vdim, NPY_DOUBLE, coords.data());
+      PyObject *pythonNormal = PyArray_SimpleNewFromData(1, vdim, NPY_DOUBLE, normal.data());
       CHECK(pythonID != nullptr, "Creating python ID failed!");
       CHECK(pythonCoords != nullptr, "Creating python coords failed!");
       CHECK(pythonNormal != nullptr, "Creating python normal failed!");
@@ -114,6 +114,10 @@ void PythonAction::performAction(double time,
     Py_DECREF(vertexArgs);
   }
 
+  if (_vectorizedVertexCallback != nullptr) {
+    callVectorizedVertexCallback();
+  }
+
   if (_postAction != nullptr) {
     PyObject *postActionArgs = PyTuple_New(0);
     PyObject_CallObject(_postAction, postActionArgs);
@@ -157,12 +161,19 @@ void PythonAction::initialize()
   //  if (not valid){
   //  }
 
-  // Construct method vertexCallback
-  _vertexCallback = PyObject_GetAttrString(_module, "vertexCallback");
+  // Construct method vectorizedVertexCallback, which replaces vertexCallback
+  _vectorizedVertexCallback = PyObject_GetAttrString(_module, "vectorizedVertexCallback");
   if (PyErr_Occurred()) {
     PyErr_Clear();
-    WARN("No function void vertexCallback() in python module \"" << _moduleName << "\" found.");
-    _vertexCallback = nullptr;
+    _vectorizedVertexCallback = nullptr;
+
+    // Construct method vertexCallback
+    _vertexCallback = PyObject_GetAttrString(_module, "vertexCallback");
+    if (PyErr_Occurred()) {
+      PyErr_Clear();
+      WARN("No function void vertexCallback() in python module \"" << _moduleName << "\" found.");
+      _vertexCallback = nullptr;
+    }
   }
 
   // Construct function postAction
@@ -172,6 +183,53 @@ void PythonAction::initialize()
     WARN("No function void postAction() in python module \"" << _moduleName << "\" found.");
     _postAction = nullptr;
   }
+  _isInitialized = true;
+}
+
+void PythonAction::callVectorizedVertexCallback()
+{
+  TRACE();
+  mesh::PtrMesh mesh       = getMesh();
+  const int     dimensions = mesh->getDimensions();
+  npy_intp      vertices   = static_cast<npy_intp>(mesh->vertices().size());
+
+  // Coordinates and normals are not stored contiguously, hence, they are gathered into new arrays
+  npy_intp  vdims[]       = {vertices, dimensions};
+  PyObject *pythonCoords  = PyArray_SimpleNew(2, vdims, NPY_DOUBLE);
+  PyObject *pythonNormals = PyArray_SimpleNew(2, vdims, NPY_DOUBLE);
+  CHECK(pythonCoords != nullptr, "Creating python coords failed!");
+  CHECK(pythonNormals != nullptr, "Creating python normals failed!");
+  using RowMajorMatrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  Eigen::Map<RowMajorMatrix> coords(static_cast<double *>(PyArray_DATA(reinterpret_cast<PyArrayObject *>(pythonCoords))),
+                                    vertices, dimensions);
+  Eigen::Map<RowMajorMatrix> normals(static_cast<double *>(PyArray_DATA(reinterpret_cast<PyArrayObject *>(pythonNormals))),
+                                     vertices, dimensions);
+  int row = 0;
+  for (const mesh::Vertex &vertex : mesh->vertices()) {
+    coords.row(row)  = vertex.getCoords();
+    normals.row(row) = vertex.getNormal();
+    row++;
+  }
+
+  PyObject *args = PyTuple_New(_numberArguments);
+  PyTuple_SetItem(args, 0, pythonCoords);
+  PyTuple_SetItem(args, 1, pythonNormals);
+  int argumentIndex = 2;
+  for (const mesh::PtrData &data : {_sourceData, _targetData}) {
+    if (data.use_count() > 0) {
+      npy_intp  ddims[]    = {vertices, data->getDimensions()};
+      PyObject *pythonData = PyArray_SimpleNewFromData(2, ddims, NPY_DOUBLE, data->values().data());
+      CHECK(pythonData != nullptr, "Creating python data of \"" << data->getName() << "\" failed!");
+      PyTuple_SetItem(args, argumentIndex++, pythonData);
+    }
+  }
+  PyObject_CallObject(_vectorizedVertexCallback, args);
+  if (PyErr_Occurred()) {
+    PyErr_Print();
+    ERROR("Error occurred during call of function "
+          << "vectorizedVertexCallback() python module \"" << _moduleName << "\"!");
+  }
+  Py_DECREF(args);
 }
 
 int PythonAction::makeNumPyArraysAvailable()
@@ -14,7 +14,16 @@ namespace precice
 namespace action
 {
 
-/// Action whose implementation is given in a Python file.
+/**
+ * @brief Action whose implementation is given in a Python file.
+ *
+ * The module may define the functions performAction(time, dt, sourceData, targetData),
+ * vertexCallback(id, coords, normal) or vectorizedVertexCallback(coords, normals, sourceData,
+ * targetData), and postAction(). vectorizedVertexCallback() is called once per action with the
+ * coordinates and normals of all vertices as arrays of shape (vertices, dimensions) and the data
+ * as arrays of shape (vertices, data dimensions), which refer to the values of the data. If it is
+ * defined, vertexCallback() is not called.
+ */
 class PythonAction : public Action
 {
 public:
@@ -61,10 +70,15 @@ private:
 
   PyObject *_vertexCallback = nullptr;
 
+  PyObject *_vectorizedVertexCallback = nullptr;
+
   PyObject *_postAction = nullptr; 
 
   void initialize();
 
+  /// Calls vectorizedVertexCallback() with the coordinates, normals and data of all vertices.
+  void callVectorizedVertexCallback();
+
   int makeNumPyArraysAvailable();
 };
 
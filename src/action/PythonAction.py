@@ -26,6 +26,15 @@ def vertexCallback(id, coords, normal):
     global myTargetData
     # myTargetData[id] += coords[0] + mySourceData[id] # Add data to vertex coords
     
+# def vectorizedVertexCallback(coords, normals, sourceData, targetData):
+#     '''This function replaces vertexCallback, if defined. It is called once for all
+#     vertices of the configured mesh, which is considerably faster for large meshes.
+#     The coordinates and normals are arrays of shape (vertices, dimensions), the source
+#     and target data refer to the data values in arrays of shape (vertices, data dimensions).'''
+#
+#     # Usage example:
+#     targetData[:, 0] += coords[:, 0] + sourceData[:, 0] # Add data to vertex coords
+
 def postAction():
     '''This function is called at last, if not omitted.'''
     
@@ -0,0 +1,27 @@
+mySourceData = 0
+myTargetData = 0
+myIteration = 0
+
+#
+# Same as TestAllAction, but with a single callback for all vertices.
+#
+def performAction(time, dt, sourceData, targetData):
+    global mySourceData
+    global myTargetData
+    mySourceData = sourceData
+    myTargetData = targetData
+    myTargetData[:] = mySourceData + 1
+
+#
+# This function is called once for all vertices of the configured mesh. The
+# coordinates and normals have the shape (vertices, dimensions), the source and
+# target data the shape (vertices, data dimensions).
+#
+def vectorizedVertexCallback(coords, normals, sourceData, targetData):
+    targetData[:, 0] += coords[:, 0]
+
+def postAction():
+    global myTargetData
+    global myIteration
+    myTargetData -= myIteration
+    myIteration += 1
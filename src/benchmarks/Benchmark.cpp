@@ -0,0 +1,111 @@
+#include "Benchmark.hpp"
+#include <algorithm>
+#include <cmath>
+#include "mesh/Edge.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Vertex.hpp"
+
+namespace precice
+{
+namespace benchmarks
+{
+
+void Recorder::record(const std::string &phase, double seconds)
+{
+  auto entry = std::find_if(_phases.begin(), _phases.end(),
+                            [&phase](const Phases::value_type &p) { return p.first == phase; });
+  if (entry == _phases.end()) {
+    _phases.emplace_back(phase, std::vector<double>());
+    entry = _phases.end() - 1;
+  }
+  entry->second.push_back(seconds);
+}
+
+const Recorder::Phases &Recorder::phases() const
+{
+  return _phases;
+}
+
+Recorder::Phases &Recorder::phases()
+{
+  return _phases;
+}
+
+namespace
+{
+/// Number of vertices along each axis of the surface
+int verticesPerAxis(int dimensions, int vertices)
+{
+  if (dimensions == 2) {
+    return std::max(vertices, 2);
+  }
+  return std::max(static_cast<int>(std::lround(std::sqrt(vertices))), 2);
+}
+} // namespace
+
+double surfaceMeshSpacing(int dimensions, int vertices)
+{
+  return 1.0 / (verticesPerAxis(dimensions, vertices) - 1);
+}
+
+mesh::PtrMesh createSurfaceMesh(
+    const std::string &name,
+    int                dimensions,
+    int                vertices,
+    double             offset,
+    bool               connectivity)
+{
+  const int    n     = verticesPerAxis(dimensions, vertices);
+  const double h     = surfaceMeshSpacing(dimensions, vertices);
+  const double shift = offset * h;
+
+  mesh::PtrMesh mesh(new mesh::Mesh(name, dimensions, false));
+  if (dimensions == 2) {
+    for (int i = 0; i < n; i++) {
+      mesh->createVertex(Eigen::Vector2d(i * h + shift, 0.0));
+    }
+    if (connectivity) {
+      for (int i = 0; i + 1 < n; i++) {
+        mesh->createEdge(mesh->vertices()[i], mesh->vertices()[i + 1]);
+      }
+    }
+  } else {
+    std::vector<double> coords;
+    coords.reserve(3 * n * n);
+    for (int j = 0; j < n; j++) {
+      for (int i = 0; i < n; i++) {
+        coords.insert(coords.end(), {i * h + shift, j * h + shift, 0.0});
+      }
+    }
+    mesh->createVertices(n * n, coords.data());
+    if (connectivity) {
+      auto vertex = [&mesh, n](int i, int j) -> mesh::Vertex & { return mesh->vertices()[j * n + i]; };
+      // Edges along x, along y and diagonals of all cells, indexed by the cell at their first vertex
+      std::vector<mesh::Edge *> alongX(n * n), alongY(n * n), diagonals(n * n);
+      for (int j = 0; j < n; j++) {
+        for (int i = 0; i < n; i++) {
+          if (i + 1 < n) {
+            alongX[j * n + i] = &mesh->createEdge(vertex(i, j), vertex(i + 1, j));
+          }
+          if (j + 1 < n) {
+            alongY[j * n + i] = &mesh->createEdge(vertex(i, j), vertex(i, j + 1));
+          }
+          if (i + 1 < n && j + 1 < n) {
+            diagonals[j * n + i] = &mesh->createEdge(vertex(i, j), vertex(i + 1, j + 1));
+          }
+        }
+      }
+      for (int j = 0; j + 1 < n; j++) {
+        for (int i = 0; i + 1 < n; i++) {
+          mesh->createTriangle(*alongX[j * n + i], *alongY[j * n + i + 1], *diagonals[j * n + i]);
+          mesh->createTriangle(*alongY[j * n + i], *alongX[(j + 1) * n + i], *diagonals[j * n + i]);
+        }
+      }
+    }
+  }
+  mesh->computeState();
+  return mesh;
+}
+
+} // namespace benchmarks
+} // namespace precice
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+#include "mesh/SharedPointer.hpp"
+
+namespace precice
+{
+namespace benchmarks
+{
+
+/// Parameters of one run of a benchmark, every combination given on the command line is run.
+struct Parameters {
+  /// Number of vertices of the meshes, rows of the matrices, or calls of the solver interface
+  int vertices;
+
+  /// Spatial dimensions of the meshes
+  int dimensions;
+
+  /// Number of values per vertex
+  int valueDimension;
+
+  /// Number of timed repetitions of every phase
+  int repetitions;
+};
+
+/**
+ * @brief Collects the measured times of the phases of one benchmark run.
+ *
+ * A benchmark times one or more named phases, e.g., computing and applying a mapping,
+ * once per repetition. Phases are reported in the order they are first recorded.
+ */
+class Recorder
+{
+public:
+  using Phases = std::vector<std::pair<std::string, std::vector<double>>>;
+
+  /// Calls function and records its wall time in seconds as sample of phase.
+  template <typename Function>
+  void time(const std::string &phase, Function function)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    record(phase, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+  }
+
+  /// Adds a sample in seconds to phase.
+  void record(const std::string &phase, double seconds);
+
+  const Phases &phases() const;
+
+  Phases &phases();
+
+private:
+  Phases _phases;
+};
+
+/**
+ * @brief Creates a structured surface mesh with about the given number of vertices.
+ *
+ * In 3D, the mesh is a triangulated grid of the unit square in the plane z = 0, in 2D a
+ * polyline on the unit interval of the x axis. The vertices are shifted by offset times
+ * the grid spacing along all axes of the surface, such that meshes with different offsets
+ * do not share vertices. Edges and triangles are only created if connectivity is set.
+ * The state of the mesh is computed.
+ */
+mesh::PtrMesh createSurfaceMesh(
+    const std::string &name,
+    int                dimensions,
+    int                vertices,
+    double             offset,
+    bool               connectivity);
+
+/// Returns the distance of neighbouring vertices of a mesh created by createSurfaceMesh().
+double surfaceMeshSpacing(int dimensions, int vertices);
+
+/// Computes and applies a consistent NearestNeighborMapping.
+void nearestNeighborMapping(const Parameters &parameters, Recorder &recorder);
+
+/// Computes and applies a consistent NearestProjectionMapping.
+void nearestProjectionMapping(const Parameters &parameters, Recorder &recorder);
+
+/// Computes and applies a consistent RadialBasisFctMapping with a compactly supported basis function.
+void radialBasisFctMapping(const Parameters &parameters, Recorder &recorder);
+
+#ifndef PRECICE_NO_PETSC
+/// Computes and applies a consistent PetRadialBasisFctMapping with a compactly supported basis function.
+void petRadialBasisFctMapping(const Parameters &parameters, Recorder &recorder);
+#endif
+
+/// Builds and queries the vertex and primitive R-trees of a mesh, and a vertex tree built by insertion for reference.
+void rtree(const Parameters &parameters, Recorder &recorder);
+
+/// Creates the vertices of a mesh one by one and at once.
+void createVertex(const Parameters &parameters, Recorder &recorder);
+
+/// Maps and gathers data of meshes of randomly ordered vertices and of vertices in Morton order.
+void mortonOrdering(const Parameters &parameters, Recorder &recorder);
+
+/// Inserts columns into a QRFactorization, as done by the quasi-Newton post-processings.
+void qrInsertColumn(const Parameters &parameters, Recorder &recorder);
+
+#ifndef PRECICE_NO_MPI
+/// Multiplies W_til and Z of the MVQNPostProcessing by a cyclic ParallelMatrixOperations, with vertices on growing numbers of ranks.
+void cyclicMultiplication(const Parameters &parameters, Recorder &recorder);
+#endif
+
+#ifndef PRECICE_NO_SHARED_MEMORY
+/// Sends doubles back and forth and sends a large vector between the first two ranks by a SharedMemoryCommunication.
+void sharedMemoryCommunication(const Parameters &parameters, Recorder &recorder);
+#endif
+
+/// Sends doubles back and forth and sends a large vector between the first two ranks by a SocketCommunication.
+void socketCommunication(const Parameters &parameters, Recorder &recorder);
+
+/// Encodes and decodes a smooth field and noise with all types of m2n::Compression.
+void compression(const Parameters &parameters, Recorder &recorder);
+
+/// Encodes a block distribution on many ranks as m2n::CompactVertexDistribution and computes a communication map.
+void compactVertexDistribution(const Parameters &parameters, Recorder &recorder);
+
+#ifndef PRECICE_NO_PYTHON
+/// Performs a PythonAction calling vertexCallback() per vertex and one calling vectorizedVertexCallback() once.
+void pythonAction(const Parameters &parameters, Recorder &recorder);
+#endif
+
+#ifndef PRECICE_NO_MPI
+/// Writes and reads data by a client, which sends the requests to the server of its participant.
+void clientCalls(const Parameters &parameters, Recorder &recorder);
+
+/// Exchanges data between two participants, which split the ranks, by a PointToPointCommunication.
+void pointToPointCommunication(const Parameters &parameters, Recorder &recorder);
+#endif
+
+} // namespace benchmarks
+} // namespace precice
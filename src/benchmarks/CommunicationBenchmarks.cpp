@@ -0,0 +1,85 @@
+#include <vector>
+#include "Benchmark.hpp"
+#include "com/SharedMemoryCommunication.hpp"
+#include "com/SocketCommunication.hpp"
+#include "utils/Parallel.hpp"
+
+namespace precice
+{
+namespace benchmarks
+{
+
+namespace
+{
+/**
+ * @brief Measures round trips of a double and transfers of large vectors between the first two ranks.
+ *
+ * The other ranks only record zero samples, such that the maximum over all ranks is the time of the first two.
+ */
+template <typename Communication>
+void pingPong(const Parameters &parameters, Recorder &recorder)
+{
+  const int roundTrips = 1000;
+  const int rank       = utils::Parallel::getProcessRank();
+  if (rank > 1) {
+    for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+      recorder.record("roundTrips", 0.0);
+    }
+    for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+      recorder.record("sendVector", 0.0);
+    }
+    return;
+  }
+
+  Communication com;
+  if (rank == 0) {
+    com.acceptConnection("A", "B", rank);
+  } else {
+    com.requestConnection("A", "B", 0, 1);
+  }
+
+  double value = 0.0;
+  for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+    recorder.time("roundTrips", [&] {
+      for (int i = 0; i < roundTrips; i++) {
+        if (rank == 0) {
+          com.send(value, 0);
+          com.receive(value, 0);
+        } else {
+          com.receive(value, 0);
+          com.send(value + 1.0, 0);
+        }
+      }
+    });
+  }
+
+  std::vector<double> data(parameters.vertices * parameters.valueDimension, 1.0);
+  for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+    recorder.time("sendVector", [&] {
+      if (rank == 0) {
+        com.send(data.data(), data.size(), 0);
+        com.receive(value, 0);
+      } else {
+        com.receive(data.data(), data.size(), 0);
+        com.send(value, 0);
+      }
+    });
+  }
+  com.closeConnection();
+}
+} // namespace
+
+#ifndef PRECICE_NO_SHARED_MEMORY
+void sharedMemoryCommunication(const Parameters &parameters, Recorder &recorder)
+{
+  pingPong<com::SharedMemoryCommunication>(parameters, recorder);
+}
+#endif
+
+void socketCommunication(const Parameters &parameters, Recorder &recorder)
+{
+  pingPong<com::SocketCommunication>(parameters, recorder);
+}
+
+} // namespace benchmarks
+} // namespace precice
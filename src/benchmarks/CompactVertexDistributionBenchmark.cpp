@@ -0,0 +1,57 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "Benchmark.hpp"
+#include "m2n/CompactVertexDistribution.hpp"
+
+namespace precice
+{
+namespace benchmarks
+{
+
+namespace
+{
+/// Receives the sizes of the communication maps, such that they cannot be optimized away
+volatile size_t mapSink = 0;
+
+/// Distribution of blocks of consecutive indices, where neighbouring ranks share the vertices at their common border.
+mesh::Mesh::VertexDistribution blockDistribution(int ranks, int verticesPerRank)
+{
+  mesh::Mesh::VertexDistribution distribution;
+  for (int rank = 0; rank < ranks; rank++) {
+    auto &indices = distribution[rank];
+    for (int index = rank * verticesPerRank; index <= (rank + 1) * verticesPerRank; index++) {
+      indices.push_back(index);
+    }
+    // Vertices are not stored in ascending order, e.g., when reordered along a space-filling curve
+    std::reverse(indices.begin(), indices.end());
+  }
+  return distribution;
+}
+} // namespace
+
+void compactVertexDistribution(const Parameters &parameters, Recorder &recorder)
+{
+  const int verticesPerRank = parameters.vertices;
+  for (int ranks : {1024, 8192}) {
+    const std::string              suffix       = "On" + std::to_string(ranks) + "Ranks";
+    mesh::Mesh::VertexDistribution distribution = blockDistribution(ranks, verticesPerRank);
+
+    m2n::CompactVertexDistribution compact;
+    for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+      recorder.time("encode" + suffix, [&] { compact = m2n::CompactVertexDistribution(distribution); });
+    }
+
+    // The local vertices of a rank of the other participant overlap two blocks
+    std::vector<int> localIndices(verticesPerRank);
+    for (int i = 0; i < verticesPerRank; i++) {
+      localIndices[i] = (ranks / 2) * verticesPerRank + verticesPerRank / 2 + i;
+    }
+    for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+      recorder.time("communicationMap" + suffix, [&] { mapSink = compact.communicationMap(localIndices).size(); });
+    }
+  }
+}
+
+} // namespace benchmarks
+} // namespace precice
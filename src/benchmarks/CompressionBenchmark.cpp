@@ -0,0 +1,73 @@
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Benchmark.hpp"
+#include "m2n/Compression.hpp"
+
+namespace precice
+{
+namespace benchmarks
+{
+
+namespace
+{
+/// Smooth displacements of a 2D grid of vertices with valueDimension components.
+std::vector<double> smoothField(int vertices, int valueDimension)
+{
+  std::vector<double> values(vertices * valueDimension);
+  const int           rowLength = static_cast<int>(std::sqrt(vertices)) + 1;
+  for (int i = 0; i < vertices; i++) {
+    double x = static_cast<double>(i % rowLength) / rowLength;
+    double y = static_cast<double>(i / rowLength) / rowLength;
+    for (int d = 0; d < valueDimension; d++) {
+      values[i * valueDimension + d] = 1e-3 * (d + 1) * std::sin(3.0 * x + d) * std::cos(2.0 * y);
+    }
+  }
+  return values;
+}
+
+/// Values without correlation of neighbouring vertices, the worst case of the lossless compression.
+std::vector<double> noiseField(int vertices, int valueDimension)
+{
+  std::vector<double> values(vertices * valueDimension);
+  for (size_t i = 0; i < values.size(); i++) {
+    values[i] = std::sin(1e4 * i) * std::exp(std::cos(7.0 * i));
+  }
+  return values;
+}
+} // namespace
+
+void compression(const Parameters &parameters, Recorder &recorder)
+{
+  using m2n::Compression;
+  const std::vector<std::pair<std::string, Compression>> compressions{
+      {"None", Compression()},
+      {"Lossless", Compression(Compression::Type::LOSSLESS)},
+      {"Float", Compression(Compression::Type::FLOAT)},
+      {"Quantize", Compression(Compression::Type::QUANTIZE, 1e-6)}};
+  const std::vector<std::pair<std::string, std::vector<double>>> fields{
+      {"SmoothField", smoothField(parameters.vertices, parameters.valueDimension)},
+      {"Noise", noiseField(parameters.vertices, parameters.valueDimension)}};
+
+  std::vector<double> packed;
+  for (const auto &field : fields) {
+    const std::vector<double> &values = field.second;
+    std::vector<double>        decoded(values.size());
+    for (const auto &compression : compressions) {
+      for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+        recorder.time("encode" + compression.first + field.first, [&] {
+          compression.second.encode(values.data(), values.size(), parameters.valueDimension, packed);
+        });
+      }
+      for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+        recorder.time("decode" + compression.first + field.first, [&] {
+          compression.second.decode(packed, decoded.data(), decoded.size(), parameters.valueDimension);
+        });
+      }
+    }
+  }
+}
+
+} // namespace benchmarks
+} // namespace precice
@@ -0,0 +1,95 @@
+#include <Eigen/Core>
+#include "Benchmark.hpp"
+#include "mapping/Mapping.hpp"
+#include "mapping/NearestNeighborMapping.hpp"
+#include "mapping/NearestProjectionMapping.hpp"
+#include "mapping/PetRadialBasisFctMapping.hpp"
+#include "mapping/RadialBasisFctMapping.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/RTree.hpp"
+
+namespace precice
+{
+namespace benchmarks
+{
+
+namespace
+{
+/**
+ * Maps data from a surface mesh with connectivity to a surface mesh of vertices, which are
+ * shifted by half the grid spacing. The R-trees of the meshes are cleared before computing
+ * the mapping, such that the time of computeMapping includes building them.
+ */
+void benchmarkMapping(mapping::Mapping &mapping, const Parameters &parameters, Recorder &recorder)
+{
+  mesh::PtrMesh inMesh  = createSurfaceMesh("InMesh", parameters.dimensions, parameters.vertices, 0.0, true);
+  mesh::PtrMesh outMesh = createSurfaceMesh("OutMesh", parameters.dimensions, parameters.vertices, 0.5, false);
+
+  mesh::PtrData inData  = inMesh->createData("Data", parameters.valueDimension);
+  mesh::PtrData outData = outMesh->createData("Data", parameters.valueDimension);
+  inMesh->allocateDataValues();
+  outMesh->allocateDataValues();
+  inData->values() = Eigen::VectorXd::Random(inData->values().size());
+
+  mapping.setMeshes(inMesh, outMesh);
+  for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+    mapping.clear();
+    mesh::rtree::clear(*inMesh);
+    mesh::rtree::clear(*outMesh);
+    recorder.time("computeMapping", [&] { mapping.computeMapping(); });
+  }
+  for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+    recorder.time("map", [&] { mapping.map(inData->getID(), outData->getID()); });
+  }
+
+  mesh::rtree::clear(*inMesh);
+  mesh::rtree::clear(*outMesh);
+}
+
+/// Support radius of the basis functions, which covers a few neighbours of every vertex
+double supportRadius(const Parameters &parameters)
+{
+  return 5 * surfaceMeshSpacing(parameters.dimensions, parameters.vertices);
+}
+} // namespace
+
+void nearestNeighborMapping(const Parameters &parameters, Recorder &recorder)
+{
+  mapping::NearestNeighborMapping mapping(mapping::Mapping::CONSISTENT, parameters.dimensions);
+  benchmarkMapping(mapping, parameters, recorder);
+}
+
+void nearestProjectionMapping(const Parameters &parameters, Recorder &recorder)
+{
+  mapping::NearestProjectionMapping mapping(mapping::Mapping::CONSISTENT, parameters.dimensions);
+  benchmarkMapping(mapping, parameters, recorder);
+}
+
+void radialBasisFctMapping(const Parameters &parameters, Recorder &recorder)
+{
+  // The surface meshes are flat, the axis normal to them is dead
+  const bool yDead = parameters.dimensions == 2;
+  const bool zDead = parameters.dimensions == 3;
+
+  mapping::CompactPolynomialC6 function(supportRadius(parameters));
+  mapping::RadialBasisFctMapping<mapping::CompactPolynomialC6> mapping(
+      mapping::Mapping::CONSISTENT, parameters.dimensions, function, false, yDead, zDead);
+  benchmarkMapping(mapping, parameters, recorder);
+}
+
+#ifndef PRECICE_NO_PETSC
+void petRadialBasisFctMapping(const Parameters &parameters, Recorder &recorder)
+{
+  const bool yDead = parameters.dimensions == 2;
+  const bool zDead = parameters.dimensions == 3;
+
+  mapping::CompactPolynomialC6 function(supportRadius(parameters));
+  mapping::PetRadialBasisFctMapping<mapping::CompactPolynomialC6> mapping(
+      mapping::Mapping::CONSISTENT, parameters.dimensions, function, false, yDead, zDead);
+  benchmarkMapping(mapping, parameters, recorder);
+}
+#endif
+
+} // namespace benchmarks
+} // namespace precice
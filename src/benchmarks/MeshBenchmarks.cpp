@@ -0,0 +1,194 @@
+#include <Eigen/Core>
+#include <boost/function_output_iterator.hpp>
+#include <memory>
+#include <numeric>
+#include <random>
+#include "Benchmark.hpp"
+#include "mapping/NearestNeighborMapping.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/RTree.hpp"
+#include "mesh/SpaceFillingCurve.hpp"
+#include "mesh/Vertex.hpp"
+
+namespace precice
+{
+namespace benchmarks
+{
+
+namespace bgi = boost::geometry::index;
+
+namespace
+{
+/// Receives the results of the queries, such that they cannot be optimized away
+volatile size_t querySink = 0;
+
+/// Indexes the vertices of a mesh through their dynamically sized coordinates, as done before packing.
+struct DynamicVertexIndexable {
+  using result_type = const mesh::Vertex &;
+  const mesh::Mesh::VertexContainer &vertices;
+
+  result_type operator()(size_t i) const
+  {
+    return vertices[i];
+  }
+};
+
+/// Vertex tree built by inserting one vertex at a time, the reference for the packed tree.
+using InsertedVertexRTree = bgi::rtree<size_t, bgi::rstar<16>, DynamicVertexIndexable>;
+
+/// Creates a mesh of randomly ordered vertices on the unit sphere, optionally stored in Morton order.
+mesh::PtrMesh createSphereMesh(const std::string &name, int vertices, unsigned seed, bool reorder)
+{
+  std::mt19937                     gen(seed);
+  std::normal_distribution<double> dist;
+  mesh::Mesh                       random("Random", 3, false);
+  for (int i = 0; i < vertices; i++) {
+    random.createVertex(Eigen::Vector3d(dist(gen), dist(gen), dist(gen)).normalized());
+  }
+  std::vector<size_t> ordering(vertices);
+  std::iota(ordering.begin(), ordering.end(), 0);
+  if (reorder) {
+    ordering = mesh::computeMortonOrdering(random);
+  }
+  mesh::PtrMesh mesh(new mesh::Mesh(name, 3, false));
+  for (size_t index : ordering) {
+    mesh->createVertex(random.vertices()[index].getCoords());
+  }
+  return mesh;
+}
+} // namespace
+
+void rtree(const Parameters &parameters, Recorder &recorder)
+{
+  mesh::PtrMesh mesh    = createSurfaceMesh("Mesh", parameters.dimensions, parameters.vertices, 0.0, true);
+  mesh::PtrMesh queries = createSurfaceMesh("Queries", parameters.dimensions, parameters.vertices, 0.5, false);
+
+  mesh::rtree::PtrVertexRTree vertexTree;
+  for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+    mesh::rtree::clear(*mesh);
+    recorder.time("buildVertexTree", [&] { vertexTree = mesh::rtree::getVertexRTree(mesh); });
+  }
+
+  size_t indexSum = 0;
+  for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+    recorder.time("queryNearestVertex", [&] {
+      for (const mesh::Vertex &vertex : queries->vertices()) {
+        vertexTree->query(bgi::nearest(vertex.getCoords(), 1),
+                          boost::make_function_output_iterator([&indexSum](size_t index) { indexSum += index; }));
+      }
+    });
+  }
+
+  std::unique_ptr<InsertedVertexRTree> insertedTree;
+  for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+    recorder.time("buildInsertedVertexTree", [&] {
+      insertedTree.reset(new InsertedVertexRTree(bgi::rstar<16>(), DynamicVertexIndexable{mesh->vertices()}));
+      for (size_t i = 0; i < mesh->vertices().size(); i++) {
+        insertedTree->insert(i);
+      }
+    });
+  }
+
+  for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+    recorder.time("queryNearestVertexInserted", [&] {
+      for (const mesh::Vertex &vertex : queries->vertices()) {
+        insertedTree->query(bgi::nearest(vertex.getCoords(), 1),
+                            boost::make_function_output_iterator([&indexSum](size_t index) { indexSum += index; }));
+      }
+    });
+  }
+
+  mesh::PtrPrimitiveRTree primitiveTree;
+  for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+    mesh::rtree::clear(*mesh);
+    recorder.time("buildPrimitiveTree", [&] { primitiveTree = mesh::rtree::getPrimitiveRTree(mesh); });
+  }
+
+  for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+    recorder.time("queryNearestPrimitives", [&] {
+      for (const mesh::Vertex &vertex : queries->vertices()) {
+        const Eigen::VectorXd &coords = vertex.getCoords();
+        mesh::Point3d          point(coords[0], coords[1], parameters.dimensions == 3 ? coords[2] : 0.0);
+        primitiveTree->query(bgi::nearest(point, 4),
+                             boost::make_function_output_iterator([&indexSum](const std::pair<mesh::AABB, mesh::PrimitiveIndex> &match) {
+                               indexSum += match.second.index;
+                             }));
+      }
+    });
+  }
+
+  mesh::rtree::clear(*mesh);
+  querySink = indexSum;
+}
+
+void createVertex(const Parameters &parameters, Recorder &recorder)
+{
+  const int       count = parameters.vertices;
+  Eigen::VectorXd coords(count * parameters.dimensions);
+  for (int i = 0; i < coords.size(); i++) {
+    coords[i] = static_cast<double>(i) / coords.size();
+  }
+
+  for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+    mesh::Mesh mesh("Mesh", parameters.dimensions, false);
+    recorder.time("createVertex", [&] {
+      for (int i = 0; i < count; i++) {
+        mesh.createVertex(coords.segment(i * parameters.dimensions, parameters.dimensions));
+      }
+    });
+  }
+
+  for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+    mesh::Mesh mesh("Mesh", parameters.dimensions, false);
+    recorder.time("createVertices", [&] { mesh.createVertices(count, coords.data()); });
+  }
+}
+
+void mortonOrdering(const Parameters &parameters, Recorder &recorder)
+{
+  const int valueDimension = parameters.valueDimension;
+  for (bool reorder : {false, true}) {
+    const std::string order   = reorder ? "MortonOrder" : "RandomOrder";
+    mesh::PtrMesh     inMesh  = createSphereMesh("InMesh", parameters.vertices, 1, reorder);
+    mesh::PtrMesh     outMesh = createSphereMesh("OutMesh", parameters.vertices, 2, reorder);
+    mesh::PtrData     inData  = inMesh->createData("InData", valueDimension);
+    mesh::PtrData     outData = outMesh->createData("OutData", valueDimension);
+    inMesh->allocateDataValues();
+    outMesh->allocateDataValues();
+    inData->values().setRandom();
+
+    mapping::NearestNeighborMapping mapping(mapping::Mapping::CONSISTENT, 3);
+    mapping.setMeshes(inMesh, outMesh);
+    for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+      mapping.clear();
+      mesh::rtree::clear(*inMesh);
+      recorder.time("computeMapping" + order, [&] { mapping.computeMapping(); });
+    }
+
+    for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+      recorder.time("map" + order, [&] { mapping.map(inData->getID(), outData->getID()); });
+    }
+
+    // Gathers the values of every other vertex, like PointToPointCommunication does for its mappings
+    std::vector<int> indices;
+    for (int i = 0; i < parameters.vertices; i += 2) {
+      indices.push_back(i);
+    }
+    std::vector<double> buffer;
+    for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+      recorder.time("gather" + order, [&] {
+        buffer.clear();
+        for (int index : indices) {
+          for (int d = 0; d < valueDimension; d++) {
+            buffer.push_back(outData->values()[index * valueDimension + d]);
+          }
+        }
+      });
+    }
+    mesh::rtree::clear(*inMesh);
+  }
+}
+
+} // namespace benchmarks
+} // namespace precice
@@ -0,0 +1,105 @@
+#ifndef PRECICE_NO_MPI
+
+#include <Eigen/Core>
+#include <string>
+#include <vector>
+#include "Benchmark.hpp"
+#include "com/MPIDirectCommunication.hpp"
+#include "com/MPIPortsCommunication.hpp"
+#include "cplscheme/impl/ParallelMatrixOperations.hpp"
+#include "utils/MasterSlave.hpp"
+#include "utils/Parallel.hpp"
+
+namespace precice
+{
+namespace benchmarks
+{
+
+namespace
+{
+/// Connects every rank to its successor, the last one to the first, as done by the MVQNPostProcessing.
+void connectCyclic(com::PtrCommunication &left, com::PtrCommunication &right)
+{
+  const int rank     = utils::Parallel::getProcessRank();
+  const int prevProc = (rank - 1 < 0) ? utils::Parallel::getCommunicatorSize() - 1 : rank - 1;
+  if ((rank % 2) == 0) {
+    left->acceptConnection("cyclicComm-" + std::to_string(prevProc), "", rank);
+    right->requestConnection("cyclicComm-" + std::to_string(rank), "", 0, 1);
+  } else {
+    right->requestConnection("cyclicComm-" + std::to_string(rank), "", 0, 1);
+    left->acceptConnection("cyclicComm-" + std::to_string(prevProc), "", rank);
+  }
+}
+
+/// Closes the connections of connectCyclic() in the same order.
+void closeCyclic(com::PtrCommunication &left, com::PtrCommunication &right)
+{
+  if ((utils::Parallel::getProcessRank() % 2) == 0) {
+    left->closeConnection();
+    right->closeConnection();
+  } else {
+    right->closeConnection();
+    left->closeConnection();
+  }
+}
+} // namespace
+
+void cyclicMultiplication(const Parameters &parameters, Recorder &recorder)
+{
+  using utils::MasterSlave;
+  using utils::Parallel;
+
+  const int size = Parallel::getCommunicatorSize();
+  const int rank = Parallel::getProcessRank();
+
+  MasterSlave::_communication = std::make_shared<com::MPIDirectCommunication>();
+  MasterSlave::_rank          = rank;
+  MasterSlave::_size          = size;
+  MasterSlave::_masterMode    = rank == 0;
+  MasterSlave::_slaveMode     = rank != 0;
+  if (MasterSlave::_masterMode) {
+    MasterSlave::_communication->acceptConnection("Master", "Slaves", 0);
+    MasterSlave::_communication->setRankOffset(1);
+  } else {
+    MasterSlave::_communication->requestConnection("Master", "Slaves", rank - 1, size - 1);
+  }
+
+  com::PtrCommunication cyclicCommLeft  = std::make_shared<com::MPIPortsCommunication>(".");
+  com::PtrCommunication cyclicCommRight = std::make_shared<com::MPIPortsCommunication>(".");
+  connectCyclic(cyclicCommLeft, cyclicCommRight);
+
+  cplscheme::impl::ParallelMatrixOperations parMatrixOps;
+  parMatrixOps.initialize(cyclicCommLeft, cyclicCommRight, true);
+
+  // The columns of W_til and rows of Z, as stored by the MVQNPostProcessing
+  const int m        = 50;
+  const int n_global = parameters.vertices * parameters.valueDimension;
+  for (int activeRanks = 1; activeRanks <= size; activeRanks *= 2) {
+    // The vertices are distributed evenly among the first activeRanks ranks
+    std::vector<int> offsets(size + 1, n_global);
+    for (int i = 0; i < activeRanks; i++) {
+      offsets[i] = i * (n_global / activeRanks);
+    }
+    const int n_local = offsets[rank + 1] - offsets[rank];
+
+    Eigen::MatrixXd W_local = Eigen::MatrixXd::Random(n_local, m);
+    Eigen::MatrixXd Z_local = Eigen::MatrixXd::Random(m, n_local);
+    Eigen::MatrixXd WZ_local(n_global, n_local);
+    for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+      Parallel::synchronizeProcesses();
+      recorder.time("multiplyOn" + std::to_string(activeRanks) + "Ranks", [&] {
+        parMatrixOps.multiply(W_local, Z_local, WZ_local, offsets, n_global, m, n_global);
+      });
+    }
+  }
+
+  closeCyclic(cyclicCommLeft, cyclicCommRight);
+  MasterSlave::_communication.reset();
+  MasterSlave::reset();
+  Parallel::synchronizeProcesses();
+}
+
+} // namespace benchmarks
+} // namespace precice
+
+#endif // not PRECICE_NO_MPI
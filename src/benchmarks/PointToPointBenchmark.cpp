@@ -0,0 +1,100 @@
+#ifndef PRECICE_NO_MPI
+
+#include <string>
+#include <vector>
+#include "Benchmark.hpp"
+#include "com/MPIDirectCommunication.hpp"
+#include "com/SocketCommunicationFactory.hpp"
+#include "m2n/PointToPointCommunication.hpp"
+#include "mesh/Mesh.hpp"
+#include "utils/MasterSlave.hpp"
+#include "utils/Parallel.hpp"
+
+namespace precice
+{
+namespace benchmarks
+{
+
+namespace
+{
+/// Global indices of the vertices of a rank: contiguous blocks, shifted cyclically by shift.
+std::vector<int> blockIndices(int vertices, int ranks, int rank, int shift)
+{
+  std::vector<int> indices;
+  const int        begin = static_cast<int>(static_cast<long>(vertices) * rank / ranks);
+  const int        end   = static_cast<int>(static_cast<long>(vertices) * (rank + 1) / ranks);
+  for (int index = begin; index < end; index++) {
+    indices.push_back((index + shift) % vertices);
+  }
+  return indices;
+}
+} // namespace
+
+void pointToPointCommunication(const Parameters &parameters, Recorder &recorder)
+{
+  using utils::MasterSlave;
+  using utils::Parallel;
+
+  // The first half of the ranks forms participant A, the second half participant B
+  const int         size        = Parallel::getCommunicatorSize();
+  const bool        isA         = Parallel::getProcessRank() < size / 2;
+  const std::string participant = isA ? "A" : "B";
+  const int         ranks       = isA ? size / 2 : size - size / 2;
+  const int         localRank   = isA ? Parallel::getProcessRank() : Parallel::getProcessRank() - size / 2;
+  // The blocks of B are shifted by half a block of A, such that every rank of B receives from two ranks of A
+  const int shift = isA ? 0 : parameters.vertices / (2 * (size / 2));
+
+  MasterSlave::_communication = std::make_shared<com::MPIDirectCommunication>();
+  MasterSlave::_rank          = localRank;
+  MasterSlave::_size          = ranks;
+  MasterSlave::_masterMode    = localRank == 0;
+  MasterSlave::_slaveMode     = localRank != 0;
+
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", parameters.dimensions, false));
+  if (MasterSlave::_masterMode) {
+    MasterSlave::_communication->acceptConnection(participant + ".Master", participant + ".Slave", 0);
+    MasterSlave::_communication->setRankOffset(1);
+
+    mesh->setGlobalNumberOfVertices(parameters.vertices);
+    for (int rank = 0; rank < ranks; rank++) {
+      mesh->getVertexDistribution()[rank] = blockIndices(parameters.vertices, ranks, rank, shift);
+    }
+  } else {
+    MasterSlave::_communication->requestConnection(participant + ".Master", participant + ".Slave", localRank - 1, ranks - 1);
+  }
+
+  com::PtrCommunicationFactory   factory(new com::SocketCommunicationFactory);
+  m2n::PointToPointCommunication communication(factory, mesh);
+  if (isA) {
+    communication.requestConnection("B", "A");
+  } else {
+    communication.acceptConnection("B", "A");
+  }
+
+  const size_t        localVertices = blockIndices(parameters.vertices, ranks, localRank, shift).size();
+  std::vector<double> values(localVertices * parameters.valueDimension, localRank);
+
+  for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+    Parallel::synchronizeProcesses();
+    recorder.time("sendReceive", [&] {
+      if (isA) {
+        communication.send(values.data(), values.size(), parameters.valueDimension);
+        communication.receive(values.data(), values.size(), parameters.valueDimension);
+      } else {
+        communication.receive(values.data(), values.size(), parameters.valueDimension);
+        communication.send(values.data(), values.size(), parameters.valueDimension);
+      }
+    });
+  }
+
+  communication.closeConnection();
+  MasterSlave::_communication.reset();
+  MasterSlave::reset();
+  Parallel::synchronizeProcesses();
+  Parallel::clearGroups();
+}
+
+} // namespace benchmarks
+} // namespace precice
+
+#endif // not PRECICE_NO_MPI
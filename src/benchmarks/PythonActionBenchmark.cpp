@@ -0,0 +1,75 @@
+#ifndef PRECICE_NO_PYTHON
+
+#include <Eigen/Core>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Benchmark.hpp"
+#include "action/PythonAction.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Mesh.hpp"
+
+namespace precice
+{
+namespace benchmarks
+{
+
+namespace
+{
+/// Adds the first coordinate of every vertex to the target data, one call per vertex.
+const char *vertexCallbackModule = R"(
+myTargetData = 0
+
+def performAction(time, dt, sourceData, targetData):
+    global myTargetData
+    myTargetData = targetData
+    myTargetData[:] = sourceData + 1
+
+def vertexCallback(id, coords, normal):
+    myTargetData[id] += coords[0]
+)";
+
+/// Adds the first coordinate of every vertex to the target data, one call for all vertices.
+const char *vectorizedVertexCallbackModule = R"(
+def performAction(time, dt, sourceData, targetData):
+    targetData[:] = sourceData + 1
+
+def vectorizedVertexCallback(coords, normals, sourceData, targetData):
+    targetData[:, 0] += coords[:, 0]
+)";
+} // namespace
+
+void pythonAction(const Parameters &parameters, Recorder &recorder)
+{
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 3, false));
+  for (int i = 0; i < parameters.vertices; i++) {
+    mesh->createVertex(Eigen::Vector3d::Constant(i));
+  }
+  int targetID = mesh->createData("TargetData", 1)->getID();
+  int sourceID = mesh->createData("SourceData", 1)->getID();
+  mesh->allocateDataValues();
+  mesh->data(sourceID)->values() = Eigen::VectorXd::LinSpaced(parameters.vertices, 0.0, 1.0);
+
+  const std::vector<std::pair<std::string, const char *>> modules{
+      {"vertexCallback", vertexCallbackModule},
+      {"vectorizedVertexCallback", vectorizedVertexCallbackModule}};
+  for (const auto &module : modules) {
+    const std::string moduleName = "preciceBenchmark_" + module.first;
+    std::ofstream(moduleName + ".py") << module.second;
+    {
+      action::PythonAction action(action::PythonAction::ALWAYS_PRIOR, ".", moduleName, mesh, targetID, sourceID);
+      action.performAction(0.0, 0.0, 0.0, 0.0); // imports the module
+      for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+        recorder.time(module.first, [&] { action.performAction(0.0, 0.0, 0.0, 0.0); });
+      }
+    }
+    std::remove((moduleName + ".py").c_str());
+  }
+}
+
+} // namespace benchmarks
+} // namespace precice
+
+#endif // not PRECICE_NO_PYTHON
@@ -0,0 +1,35 @@
+#include <Eigen/Core>
+#include "Benchmark.hpp"
+#include "cplscheme/impl/QRFactorization.hpp"
+
+namespace precice
+{
+namespace benchmarks
+{
+
+void qrInsertColumn(const Parameters &parameters, Recorder &recorder)
+{
+  // Columns of the matrix V of a quasi-Newton post-processing after a few time steps
+  const int       columns = 32;
+  const int       rows    = parameters.vertices * parameters.valueDimension;
+  Eigen::MatrixXd matrix  = Eigen::MatrixXd::Random(rows, columns);
+
+  for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+    cplscheme::impl::QRFactorization qr;
+    qr.setGlobalRows(rows);
+    // New columns are inserted at the front, as for the latest residual differences
+    recorder.time("insertColumn", [&] {
+      for (int column = 0; column < columns; column++) {
+        qr.insertColumn(0, matrix.col(column));
+      }
+    });
+    recorder.time("deleteColumn", [&] {
+      for (int column = 0; column < columns; column++) {
+        qr.deleteColumn(qr.cols() - 1);
+      }
+    });
+  }
+}
+
+} // namespace benchmarks
+} // namespace precice
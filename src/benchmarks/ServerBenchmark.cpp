@@ -0,0 +1,147 @@
+#ifndef PRECICE_NO_MPI
+
+#include <Eigen/Core>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include "Benchmark.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Mesh.hpp"
+#include "precice/SolverInterface.hpp"
+#include "precice/impl/Participant.hpp"
+#include "precice/impl/SolverInterfaceImpl.hpp"
+#include "utils/EventUtils.hpp"
+#include "utils/MasterSlave.hpp"
+#include "utils/Parallel.hpp"
+
+namespace precice
+{
+extern bool testMode;
+
+namespace benchmarks
+{
+
+namespace
+{
+/// ParticipantB runs its solver on a client of a server, both participants exchange data once.
+const char *serverConfiguration = R"(<?xml version="1.0"?>
+<precice-configuration>
+   <solver-interface dimensions="2">
+      <data:scalar name="ScalarData" />
+      <data:vector name="VectorData" />
+      <mesh name="Mesh">
+         <use-data name="ScalarData"/>
+         <use-data name="VectorData"/>
+      </mesh>
+      <participant name="ParticipantA">
+         <use-mesh name="Mesh" provide="true"/>
+         <write-data name="ScalarData" mesh="Mesh"/>
+         <read-data  name="VectorData" mesh="Mesh"/>
+      </participant>
+      <participant name="ParticipantB">
+         <server:mpi-single/>
+         <use-mesh name="Mesh" from="ParticipantA" />
+         <write-data name="VectorData" mesh="Mesh"/>
+         <read-data  name="ScalarData" mesh="Mesh"/>
+      </participant>
+      <m2n:mpi-single from="ParticipantA" to="ParticipantB"/>
+      <coupling-scheme:serial-explicit>
+         <participants first="ParticipantA" second="ParticipantB"/>
+         <max-timesteps value="1"/>
+         <timestep-length value="1.0"/>
+         <exchange data="ScalarData" mesh="Mesh" from="ParticipantA" to="ParticipantB"/>
+         <exchange data="VectorData"  mesh="Mesh" from="ParticipantB" to="ParticipantA"/>
+      </coupling-scheme:serial-explicit>
+   </solver-interface>
+</precice-configuration>
+)";
+
+const std::string configurationFile = "precice-benchmark-server.xml";
+} // namespace
+
+void clientCalls(const Parameters &parameters, Recorder &recorder)
+{
+  using utils::Parallel;
+
+  const int rank = Parallel::getProcessRank();
+  if (rank == 0) {
+    std::ofstream(configurationFile) << serverConfiguration;
+  }
+  Parallel::synchronizeProcesses();
+  // The configuration numbers meshes, data and participants from zero, as in a fresh process
+  mesh::Mesh::resetGeometryIDsGlobally();
+  mesh::Data::resetDataCount();
+  impl::Participant::resetParticipantCount();
+  utils::MasterSlave::reset();
+  Parallel::restrictGlobalCommunicator({0, 1, 2});
+  // Keeps MPI initialized when the solver interfaces finalize
+  precice::testMode = true;
+
+  if (rank == 0) {
+    SolverInterface interface("ParticipantA", 0, 1);
+    interface.configure(configurationFile);
+    int meshID = interface.getMeshID("Mesh");
+    interface.setMeshVertex(meshID, Eigen::Vector2d(0.0, 0.0).data());
+    interface.setMeshVertex(meshID, Eigen::Vector2d(1.0, 0.0).data());
+    double dt = interface.initialize();
+    while (interface.isCouplingOngoing()) {
+      dt = interface.advance(dt);
+    }
+    interface.finalize();
+  } else if (rank == 1) {
+    SolverInterface interface("ParticipantB", 0, 1);
+    interface.configure(configurationFile);
+    double dt            = interface.initialize();
+    int    meshID        = interface.getMeshID("Mesh");
+    int    scalarDataID  = interface.getDataID("ScalarData", meshID);
+    int    vectorDataID  = interface.getDataID("VectorData", meshID);
+    double vectorValue[] = {1.0, 2.0};
+    double scalarValue   = 0.0;
+    for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+      recorder.time("writeVectorData", [&] {
+        for (int call = 0; call < parameters.vertices; call++) {
+          interface.writeVectorData(vectorDataID, call % 2, vectorValue);
+        }
+        interface.readScalarData(scalarDataID, 0, scalarValue); // waits until the server has handled all writes
+      });
+    }
+    for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+      recorder.time("readScalarData", [&] {
+        for (int call = 0; call < parameters.vertices; call++) {
+          interface.readScalarData(scalarDataID, call % 2, scalarValue);
+        }
+      });
+    }
+    while (interface.isCouplingOngoing()) {
+      dt = interface.advance(dt);
+    }
+    interface.finalize();
+  } else if (rank == 2) {
+    impl::SolverInterfaceImpl server("ParticipantB", 0, 1, true);
+    server.configure(configurationFile);
+    server.runServer();
+  }
+
+  // The other ranks only record zero samples, such that the maximum over all ranks is the time of the client
+  if (rank != 1) {
+    for (const char *phase : {"writeVectorData", "readScalarData"}) {
+      for (int repetition = 0; repetition < parameters.repetitions; repetition++) {
+        recorder.record(phase, 0.0);
+      }
+    }
+  }
+
+  precice::testMode = false;
+  Parallel::setGlobalCommunicator(Parallel::getCommunicatorWorld());
+  // The solver interfaces registered their events with the restricted communicator
+  utils::EventRegistry::instance().initialize("precice-Benchmarks", "", Parallel::getGlobalCommunicator());
+  Parallel::synchronizeProcesses();
+  if (rank == 0) {
+    std::remove(configurationFile.c_str());
+  }
+}
+
+} // namespace benchmarks
+} // namespace precice
+
+#endif // not PRECICE_NO_MPI
@@ -0,0 +1,318 @@
+#include <algorithm>
+#include <boost/program_options.hpp>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mpi.h>
+#include <string>
+#include <vector>
+#include "precice/Constants.hpp"
+#include "precice/SolverInterface.hpp"
+#include "utils/TableWriter.hpp"
+#include "utils/json.hpp"
+
+using json = nlohmann::json;
+
+namespace
+{
+
+/// Global indices of the rows (3D) or vertices (2D) of a rank: a contiguous strip
+std::pair<int, int> strip(int count, int rank, int size)
+{
+  return {static_cast<int>(static_cast<long>(count) * rank / size),
+          static_cast<int>(static_cast<long>(count) * (rank + 1) / size)};
+}
+
+/**
+ * @brief Surface mesh of the local partition of a participant.
+ *
+ * The global mesh is a triangulated grid of about the given number of vertices on the unit
+ * square in the plane z = 0 in 3D, or a polyline on the unit interval of the x axis in 2D.
+ * It is partitioned into strips of rows, which are connected within each strip only.
+ * The vertices are shifted by offset times the grid spacing along the surface.
+ */
+struct Partition {
+  std::vector<double> coords;
+  std::vector<int>    vertexIDs;
+
+  Partition(precice::SolverInterface &interface, int meshID, int vertices, double offset, int rank, int size)
+  {
+    const int dimensions = interface.getDimensions();
+    const int n          = dimensions == 2 ? std::max(vertices, 2)
+                                  : std::max(static_cast<int>(std::lround(std::sqrt(vertices))), 2);
+    const double h     = 1.0 / (n - 1);
+    const double shift = offset * h;
+
+    if (dimensions == 2) {
+      const auto range = strip(n, rank, size);
+      for (int i = range.first; i < range.second; i++) {
+        coords.insert(coords.end(), {i * h + shift, 0.0});
+      }
+      setVertices(interface, meshID, dimensions);
+      for (size_t i = 0; i + 1 < vertexIDs.size(); i++) {
+        interface.setMeshEdge(meshID, vertexIDs[i], vertexIDs[i + 1]);
+      }
+    } else {
+      const auto rows  = strip(n, rank, size);
+      const int  local = rows.second - rows.first;
+      for (int j = rows.first; j < rows.second; j++) {
+        for (int i = 0; i < n; i++) {
+          coords.insert(coords.end(), {i * h + shift, j * h + shift, 0.0});
+        }
+      }
+      setVertices(interface, meshID, dimensions);
+      auto vertex = [this, n](int i, int j) { return vertexIDs[j * n + i]; };
+      // Edges along x, along y and diagonals of all cells, indexed by the cell at their first vertex
+      std::vector<int> alongX(n * local), alongY(n * local), diagonals(n * local);
+      for (int j = 0; j < local; j++) {
+        for (int i = 0; i < n; i++) {
+          if (i + 1 < n) {
+            alongX[j * n + i] = interface.setMeshEdge(meshID, vertex(i, j), vertex(i + 1, j));
+          }
+          if (j + 1 < local) {
+            alongY[j * n + i] = interface.setMeshEdge(meshID, vertex(i, j), vertex(i, j + 1));
+          }
+          if (i + 1 < n && j + 1 < local) {
+            diagonals[j * n + i] = interface.setMeshEdge(meshID, vertex(i, j), vertex(i + 1, j + 1));
+          }
+        }
+      }
+      for (int j = 0; j + 1 < local; j++) {
+        for (int i = 0; i + 1 < n; i++) {
+          interface.setMeshTriangle(meshID, alongX[j * n + i], alongY[j * n + i + 1], diagonals[j * n + i]);
+          interface.setMeshTriangle(meshID, alongY[j * n + i], alongX[(j + 1) * n + i], diagonals[j * n + i]);
+        }
+      }
+    }
+  }
+
+  int size() const
+  {
+    return static_cast<int>(vertexIDs.size());
+  }
+
+private:
+  void setVertices(precice::SolverInterface &interface, int meshID, int dimensions)
+  {
+    vertexIDs.resize(coords.size() / dimensions);
+    interface.setMeshVertices(meshID, size(), coords.data(), vertexIDs.data());
+  }
+};
+
+/**
+ * Events of the phases in the breakdown. Nested events are named by their path, e.g., initialize/partition.gatherMesh.MeshA,
+ * the last component of which is compared. Names ending with a dot match all events starting with it.
+ */
+const std::vector<std::pair<std::string, std::vector<std::string>>> &phases()
+{
+  static const std::vector<std::pair<std::string, std::vector<std::string>>> phases{
+      {"total", {"_GLOBAL"}},
+      {"initialize", {"initialize", "initializeData"}},
+      {"advance", {"advance"}},
+      {"solver", {"solver.initialize", "solver.advance"}},
+      {"partitioning", {"partition."}},
+      {"connection", {"m2n.acceptMasterConnection", "m2n.acceptSlavesConnection", "m2n.requestMasterConnection",
+                      "m2n.requestSlavesConnection", "com.initializeMasterSlaveCom"}},
+      {"mapping", {"map."}},
+      {"exchange", {"m2n.sendData", "m2n.receiveData"}},
+      {"convergence", {"cpl.measureConvergence"}},
+      {"quasi-Newton", {"cpl.computeQuasiNewtonUpdate", "cpl.overlappedPostProcessing"}}};
+  return phases;
+}
+
+bool matches(const std::string &event, const std::string &name)
+{
+  const std::string component = event.substr(event.rfind('/') + 1);
+  if (name.back() == '.') {
+    return component.compare(0, name.size(), name) == 0;
+  }
+  return component == name;
+}
+
+/**
+ * @brief Sums the event timings of the participant per phase and prints the maximum and minimum over all ranks.
+ *
+ * The timings are read from the events file written by preCICE on finalize.
+ */
+json reportBreakdown(const std::string &eventsFile)
+{
+  std::ifstream in(eventsFile);
+  if (not in) {
+    std::cerr << "Cannot read " << eventsFile << ", no breakdown is reported" << std::endl;
+    return json();
+  }
+  json events;
+  in >> events;
+
+  std::map<std::string, std::vector<double>> perRank; // phase -> total time per rank [ms]
+  for (const auto &rank : events["Ranks"]) {
+    for (const auto &phase : phases()) {
+      double total = 0;
+      for (auto timing = rank["Timings"].begin(); timing != rank["Timings"].end(); ++timing) {
+        for (const std::string &name : phase.second) {
+          if (matches(timing.key(), name)) {
+            total += timing.value()["Total"].get<double>();
+            break;
+          }
+        }
+      }
+      perRank[phase.first].push_back(total);
+    }
+  }
+
+  Table table(std::cout);
+  table.addColumn("Phase", 14);
+  table.addColumn("Max[ms]", 12);
+  table.addColumn("MaxOnRank", 10);
+  table.addColumn("Min[ms]", 12);
+  table.addColumn("MinOnRank", 10);
+  table.printHeader();
+
+  json breakdown;
+  for (const auto &phase : phases()) {
+    const auto &times = perRank[phase.first];
+    if (times.empty()) {
+      continue;
+    }
+    const auto maximum = std::max_element(times.begin(), times.end());
+    const auto minimum = std::min_element(times.begin(), times.end());
+    table.printRow(phase.first, *maximum, static_cast<int>(maximum - times.begin()),
+                   *minimum, static_cast<int>(minimum - times.begin()));
+    breakdown[phase.first] = {{"Max", *maximum}, {"Min", *minimum}, {"PerRank", times}};
+  }
+  return breakdown;
+}
+
+void busyWait(double seconds)
+{
+  const double start = MPI_Wtime();
+  while (MPI_Wtime() - start < seconds) {
+  }
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+  namespace po = boost::program_options;
+
+  std::string configuration;
+  std::string participant;
+  int         vertices;
+  double      computeTime;
+
+  po::options_description options("Usage: couplingprecice configuration participant [options]\n\n"
+                                  "Synthetic solver for one participant of the coupling configurations in\n"
+                                  "src/benchmarks/coupling, run one instance per participant, e.g., with mpirun.\n\n"
+                                  "Options");
+  options.add_options()
+      ("help,h", "Prints this help message")
+      ("configuration", po::value<std::string>(&configuration)->required(), "preCICE configuration file")
+      ("participant", po::value<std::string>(&participant)->required(), "Participant A or B")
+      ("vertices,n", po::value<int>(&vertices)->default_value(10000), "Number of vertices of the global mesh")
+      ("compute-time,c", po::value<double>(&computeTime)->default_value(0.0),
+       "Seconds each rank computes per iteration");
+  po::positional_options_description positional;
+  positional.add("configuration", 1).add("participant", 1);
+
+  po::variables_map variables;
+  try {
+    po::store(po::command_line_parser(argc, argv).options(options).positional(positional).run(), variables);
+    if (variables.count("help")) {
+      std::cout << options << std::endl;
+      return 0;
+    }
+    po::notify(variables);
+  } catch (const po::error &e) {
+    std::cerr << e.what() << std::endl << std::endl << options << std::endl;
+    return 1;
+  }
+  if (participant != "A" && participant != "B") {
+    std::cerr << "The participant has to be A or B" << std::endl;
+    return 1;
+  }
+
+  // preCICE does not finalize MPI if it has been initialized before
+  MPI_Init(&argc, &argv);
+  int rank = 0;
+  int size = 1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  // A writes forces and reads displacements on MeshA, B the other way round on MeshB
+  const bool        isA       = participant == "A";
+  const std::string meshName  = isA ? "MeshA" : "MeshB";
+  const std::string writeName = isA ? "Forces" : "Displacements";
+  const std::string readName  = isA ? "Displacements" : "Forces";
+
+  precice::SolverInterface interface(participant, rank, size);
+  interface.configure(configuration);
+  const int dimensions  = interface.getDimensions();
+  const int meshID      = interface.getMeshID(meshName);
+  const int writeDataID = interface.getDataID(writeName, meshID);
+  const int readDataID  = interface.getDataID(readName, meshID);
+
+  const double        startTime = MPI_Wtime();
+  Partition           partition(interface, meshID, vertices, isA ? 0.0 : 0.5, rank, size);
+  std::vector<double> writeData(partition.size() * dimensions);
+  std::vector<double> readData(partition.size() * dimensions, 0.0);
+
+  double maxDt      = interface.initialize();
+  double time       = 0;
+  int    timesteps  = 0;
+  int    iterations = 0;
+  if (interface.isReadDataAvailable()) {
+    interface.readBlockVectorData(readDataID, partition.size(), partition.vertexIDs.data(), readData.data());
+  }
+
+  while (interface.isCouplingOngoing()) {
+    if (interface.isActionRequired(precice::constants::actionWriteIterationCheckpoint())) {
+      interface.fulfilledAction(precice::constants::actionWriteIterationCheckpoint());
+    }
+
+    // A contraction of the read data plus a smooth field, such that implicit coupling converges
+    const double dt = maxDt;
+    busyWait(computeTime);
+    for (int i = 0; i < partition.size(); i++) {
+      const double field = std::sin(M_PI * partition.coords[i * dimensions]) * (1.0 + time);
+      for (int d = 0; d < dimensions; d++) {
+        writeData[i * dimensions + d] = 0.5 * readData[i * dimensions + d] + (isA ? field : -field);
+      }
+    }
+    interface.writeBlockVectorData(writeDataID, partition.size(), partition.vertexIDs.data(), writeData.data());
+    maxDt = interface.advance(dt);
+    iterations++;
+    interface.readBlockVectorData(readDataID, partition.size(), partition.vertexIDs.data(), readData.data());
+
+    if (interface.isActionRequired(precice::constants::actionReadIterationCheckpoint())) {
+      interface.fulfilledAction(precice::constants::actionReadIterationCheckpoint());
+    } else {
+      time += dt;
+      timesteps++;
+    }
+  }
+  interface.finalize();
+  const double wallTime = MPI_Wtime() - startTime;
+
+  if (rank == 0) {
+    std::cout << std::endl
+              << "Participant " << participant << ": " << size << " ranks, " << vertices << " vertices, "
+              << timesteps << " time steps, " << iterations << " iterations, "
+              << wallTime << " s" << std::endl
+              << std::endl;
+    json breakdown            = reportBreakdown("precice-" + participant + "-events.json");
+    breakdown["Participant"]  = participant;
+    breakdown["Ranks"]        = size;
+    breakdown["Vertices"]     = vertices;
+    breakdown["Timesteps"]    = timesteps;
+    breakdown["Iterations"]   = iterations;
+    breakdown["WallTime"]     = wallTime;
+    std::ofstream out("precice-" + participant + "-breakdown.json");
+    out << std::setw(2) << breakdown << std::endl;
+  }
+
+  MPI_Finalize();
+  return 0;
+}
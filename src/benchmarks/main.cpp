@@ -0,0 +1,257 @@
+#include <algorithm>
+#include <boost/program_options.hpp>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+#include "Benchmark.hpp"
+#include "logging/LogConfiguration.hpp"
+#include "utils/EventUtils.hpp"
+#include "utils/Parallel.hpp"
+#include "utils/Petsc.hpp"
+#include "utils/json.hpp"
+
+namespace precice {
+extern bool testMode;
+extern bool syncMode;
+}
+
+using namespace precice;
+using json = nlohmann::json;
+
+namespace
+{
+/// A benchmark and the parameters it depends on.
+struct Benchmark {
+  std::string name;
+  void (*run)(const benchmarks::Parameters &, benchmarks::Recorder &);
+  /// Runs on all ranks and reports the maximal time over all ranks, otherwise runs on the first rank only.
+  bool parallel;
+  /// Skipped if fewer ranks are available.
+  int minRanks;
+  /// Skipped for more vertices, e.g., as dense matrices are involved. Zero means unlimited.
+  int maxVertices;
+  bool usesDimensions;
+  bool usesValueDimension;
+};
+
+const std::vector<Benchmark> &allBenchmarks()
+{
+  static const std::vector<Benchmark> benchmarks{
+      {"mapping.nearest-neighbor", &benchmarks::nearestNeighborMapping, false, 1, 0, true, true},
+      {"mapping.nearest-projection", &benchmarks::nearestProjectionMapping, false, 1, 0, true, true},
+      {"mapping.rbf", &benchmarks::radialBasisFctMapping, false, 1, 5000, true, true},
+#ifndef PRECICE_NO_PETSC
+      {"mapping.petrbf", &benchmarks::petRadialBasisFctMapping, false, 1, 0, true, true},
+#endif
+#ifndef PRECICE_NO_PYTHON
+      {"action.python", &benchmarks::pythonAction, false, 1, 0, false, false},
+#endif
+      {"mesh.rtree", &benchmarks::rtree, false, 1, 0, true, false},
+      {"mesh.createVertex", &benchmarks::createVertex, false, 1, 0, true, false},
+      {"mesh.morton-ordering", &benchmarks::mortonOrdering, false, 1, 0, false, true},
+      {"cplscheme.qr.insertColumn", &benchmarks::qrInsertColumn, false, 1, 0, false, true},
+#ifndef PRECICE_NO_MPI
+      {"cplscheme.cyclic-multiplication", &benchmarks::cyclicMultiplication, true, 2, 0, false, true},
+#endif
+#ifndef PRECICE_NO_SHARED_MEMORY
+      {"com.shared-memory", &benchmarks::sharedMemoryCommunication, true, 2, 0, false, true},
+#endif
+      {"com.sockets", &benchmarks::socketCommunication, true, 2, 0, false, true},
+      {"m2n.compression", &benchmarks::compression, false, 1, 0, false, true},
+      {"m2n.compact-vertex-distribution", &benchmarks::compactVertexDistribution, false, 1, 0, false, false},
+#ifndef PRECICE_NO_MPI
+      {"m2n.point-to-point", &benchmarks::pointToPointCommunication, true, 4, 0, false, true},
+      {"precice.client-calls", &benchmarks::clientCalls, true, 3, 0, false, false},
+#endif
+  };
+  return benchmarks;
+}
+
+bool isSelected(const Benchmark &benchmark, const std::vector<std::string> &prefixes)
+{
+  if (prefixes.empty()) {
+    return true;
+  }
+  return std::any_of(prefixes.begin(), prefixes.end(), [&benchmark](const std::string &prefix) {
+    return benchmark.name.compare(0, prefix.size(), prefix) == 0;
+  });
+}
+
+/// Replaces the samples of parallel benchmarks by their maximum over all ranks, which is stored at rank 0.
+void reduceMaximum(benchmarks::Recorder::Phases &phases)
+{
+#ifndef PRECICE_NO_MPI
+  std::vector<double> samples;
+  for (const auto &phase : phases) {
+    samples.insert(samples.end(), phase.second.begin(), phase.second.end());
+  }
+  std::vector<double> maxima(samples.size());
+  MPI_Reduce(samples.data(), maxima.data(), static_cast<int>(samples.size()), MPI_DOUBLE, MPI_MAX, 0,
+             utils::Parallel::getGlobalCommunicator());
+  auto maximum = maxima.begin();
+  for (auto &phase : phases) {
+    std::copy(maximum, maximum + phase.second.size(), phase.second.begin());
+    maximum += phase.second.size();
+  }
+#endif
+}
+
+json toJSON(const Benchmark &benchmark, const benchmarks::Parameters &parameters, int ranks,
+            const std::string &phase, const std::vector<double> &seconds)
+{
+  json result;
+  result["benchmark"]      = benchmark.name;
+  result["phase"]          = phase;
+  result["vertices"]       = parameters.vertices;
+  result["dimensions"]     = parameters.dimensions;
+  result["valueDimension"] = parameters.valueDimension;
+  result["ranks"]          = ranks;
+  result["seconds"]        = seconds;
+  result["min"]            = *std::min_element(seconds.begin(), seconds.end());
+  result["mean"]           = std::accumulate(seconds.begin(), seconds.end(), 0.0) / seconds.size();
+  result["max"]            = *std::max_element(seconds.begin(), seconds.end());
+  return result;
+}
+
+void printResult(const json &result)
+{
+  std::cout << std::left << std::setw(60)
+            << result["benchmark"].get<std::string>() + "/" + result["phase"].get<std::string>()
+            << std::right
+            << " N=" << std::setw(8) << result["vertices"].get<int>()
+            << " dim=" << result["dimensions"].get<int>()
+            << " valueDim=" << result["valueDimension"].get<int>()
+            << " ranks=" << std::setw(3) << result["ranks"].get<int>()
+            << std::fixed << std::setprecision(3)
+            << "  min " << std::setw(10) << result["min"].get<double>() * 1e3 << " ms"
+            << "  mean " << std::setw(10) << result["mean"].get<double>() * 1e3 << " ms"
+            << std::defaultfloat << std::endl;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+  namespace po = boost::program_options;
+
+  std::vector<std::string> selection;
+  std::vector<int>         verticesList;
+  std::vector<int>         dimensionsList;
+  std::vector<int>         valueDimensionList;
+  int                      repetitions;
+  std::string              output;
+
+  po::options_description options("Usage: benchprecice [options]\n\n"
+                                  "Runs micro-benchmarks of preCICE kernels for all combinations of the given parameters.\n"
+                                  "Run with mpirun to measure the communication benchmarks, all others run on the first rank.\n\n"
+                                  "Options");
+  options.add_options()
+      ("help,h", "Prints this help message")
+      ("list,l", "Lists the available benchmarks")
+      ("benchmark,b", po::value<std::vector<std::string>>(&selection)->multitoken(),
+       "Runs only the benchmarks whose names start with one of the given prefixes")
+      ("vertices,n", po::value<std::vector<int>>(&verticesList)->multitoken()->default_value({1000, 10000}, "1000 10000"),
+       "Numbers of vertices of the meshes")
+      ("dimensions,d", po::value<std::vector<int>>(&dimensionsList)->multitoken()->default_value({3}, "3"),
+       "Spatial dimensions of the meshes, 2 or 3")
+      ("value-dimension,v", po::value<std::vector<int>>(&valueDimensionList)->multitoken()->default_value({1}, "1"),
+       "Numbers of values per vertex")
+      ("repetitions,r", po::value<int>(&repetitions)->default_value(5),
+       "Timed repetitions of every phase")
+      ("output,o", po::value<std::string>(&output)->default_value("precice-benchmarks.json"),
+       "File to write the results to as JSON");
+
+  po::variables_map variables;
+  try {
+    po::store(po::parse_command_line(argc, argv, options), variables);
+    po::notify(variables);
+  } catch (const po::error &e) {
+    std::cerr << e.what() << std::endl << std::endl << options << std::endl;
+    return 1;
+  }
+  if (variables.count("help")) {
+    std::cout << options << std::endl;
+    return 0;
+  }
+  if (variables.count("list")) {
+    for (const Benchmark &benchmark : allBenchmarks()) {
+      std::cout << benchmark.name << std::endl;
+    }
+    return 0;
+  }
+
+  logging::BackendConfiguration logConfig;
+  logConfig.filter = "%Severity% >= warning";
+  logging::setupLogging({logConfig});
+
+  precice::testMode = false;
+  precice::syncMode = false;
+  utils::Parallel::initializeMPI(&argc, &argv);
+  logging::setMPIRank(utils::Parallel::getProcessRank());
+  utils::Petsc::initialize(&argc, &argv);
+  utils::EventRegistry::instance().initialize("precice-Benchmarks", "", utils::Parallel::getGlobalCommunicator());
+
+  const int  size   = utils::Parallel::getCommunicatorSize();
+  const bool isRoot = utils::Parallel::getProcessRank() == 0;
+
+  json results = json::array();
+  for (const Benchmark &benchmark : allBenchmarks()) {
+    if (not isSelected(benchmark, selection)) {
+      continue;
+    }
+    if (size < benchmark.minRanks) {
+      if (isRoot) {
+        std::cout << benchmark.name << ": skipped, requires at least " << benchmark.minRanks << " ranks" << std::endl;
+      }
+      continue;
+    }
+    for (int vertices : verticesList) {
+      if (benchmark.maxVertices > 0 && vertices > benchmark.maxVertices) {
+        if (isRoot) {
+          std::cout << benchmark.name << ": skipped for " << vertices << " vertices, supports at most "
+                    << benchmark.maxVertices << std::endl;
+        }
+        continue;
+      }
+      for (int dimensions : dimensionsList) {
+        if (not benchmark.usesDimensions && dimensions != dimensionsList.front()) {
+          continue;
+        }
+        for (int valueDimension : valueDimensionList) {
+          if (not benchmark.usesValueDimension && valueDimension != valueDimensionList.front()) {
+            continue;
+          }
+          const benchmarks::Parameters parameters{vertices, dimensions, valueDimension, repetitions};
+          benchmarks::Recorder         recorder;
+          if (benchmark.parallel) {
+            benchmark.run(parameters, recorder);
+            reduceMaximum(recorder.phases());
+          } else if (isRoot) {
+            benchmark.run(parameters, recorder);
+          }
+          utils::Parallel::synchronizeProcesses();
+
+          if (isRoot) {
+            for (const auto &phase : recorder.phases()) {
+              json result = toJSON(benchmark, parameters, benchmark.parallel ? size : 1, phase.first, phase.second);
+              printResult(result);
+              results.push_back(result);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  if (isRoot) {
+    std::ofstream out(output);
+    out << std::setw(2) << json{{"results", results}} << std::endl;
+  }
+
+  utils::EventRegistry::instance().finalize();
+  utils::Petsc::finalize();
+  utils::Parallel::finalizeMPI();
+  return 0;
+}
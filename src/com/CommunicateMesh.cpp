@@ -1,5 +1,6 @@
 #include "CommunicateMesh.hpp"
-#include <map>
+#include <algorithm>
+#include <cstring>
 #include <vector>
 #include "Communication.hpp"
 #include "com/SharedPointer.hpp"
@@ -12,6 +13,52 @@ namespace precice
 {
 namespace com
 {
+namespace
+{
+/// Number of doubles preceding the sections of a packed mesh.
+constexpr size_t HEADER_SIZE = 4;
+
+/// Number of doubles needed to store count integers.
+size_t intSectionSize(size_t count)
+{
+  return (count * sizeof(int) + sizeof(double) - 1) / sizeof(double);
+}
+
+/// Copies the integers bytewise into a section of a buffer of doubles.
+void copyToSection(const std::vector<int> &values, double *section)
+{
+  if (not values.empty()) {
+    std::memcpy(section, values.data(), values.size() * sizeof(int));
+  }
+}
+
+/// Copies count integers bytewise out of a section of a buffer of doubles.
+std::vector<int> copyFromSection(const double *section, size_t count)
+{
+  std::vector<int> values(count);
+  if (count > 0) {
+    std::memcpy(values.data(), section, count * sizeof(int));
+  }
+  return values;
+}
+
+/// Maps the IDs of the given elements to their positions in the container.
+template <typename Container>
+std::vector<int> positionsByID(const Container &elements)
+{
+  int maxID = -1;
+  for (const auto &element : elements) {
+    maxID = std::max(maxID, element.getID());
+  }
+  std::vector<int> positions(maxID + 1, -1);
+  int              position = 0;
+  for (const auto &element : elements) {
+    positions[element.getID()] = position++;
+  }
+  return positions;
+}
+} // namespace
+
 CommunicateMesh::CommunicateMesh(
     com::PtrCommunication communication)
     : _communication(communication)
@@ -23,63 +70,9 @@ void CommunicateMesh::sendMesh(
     int               rankReceiver)
 {
   TRACE(mesh.getName(), rankReceiver);
-  int dim = mesh.getDimensions();
-
-  int numberOfVertices = mesh.vertices().size();
-  _communication->send(numberOfVertices, rankReceiver);
-  if (not mesh.vertices().empty()) {
-    std::vector<double> coords(numberOfVertices * dim);
-    std::vector<int> globalIDs(numberOfVertices);
-    for (int i = 0; i < numberOfVertices; i++) {
-      for (int d = 0; d < dim; d++) {
-        coords[i * dim + d] = mesh.vertices()[i].getCoords()[d];
-      }
-      globalIDs[i] = mesh.vertices()[i].getGlobalIndex();
-    }
-    _communication->send(coords, rankReceiver);
-    _communication->send(globalIDs, rankReceiver);
-  }
-
-  int numberOfEdges = mesh.edges().size();
-  _communication->send(numberOfEdges, rankReceiver);
-  if (not mesh.edges().empty()) {
-    //we need to send the vertexIDs first such that the right edges can be created later
-    //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-    std::vector<int> vertexIDs(numberOfVertices);
-    for (int i = 0; i < numberOfVertices; i++) {
-      vertexIDs[i] = mesh.vertices()[i].getID();
-    }
-    _communication->send(vertexIDs, rankReceiver);
-
-    std::vector<int> edgeIDs(numberOfEdges * 2);
-    for (int i = 0; i < numberOfEdges; i++) {
-      edgeIDs[i * 2]     = mesh.edges()[i].vertex(0).getID();
-      edgeIDs[i * 2 + 1] = mesh.edges()[i].vertex(1).getID();
-    }
-    _communication->send(edgeIDs, rankReceiver);
-  }
-
-  if (dim == 3) {
-    int numberOfTriangles = mesh.triangles().size();
-    _communication->send(numberOfTriangles, rankReceiver);
-    if (not mesh.triangles().empty()) {
-      //we need to send the edgeIDs first such that the right edges can be created later
-      //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-      std::vector<int> edgeIDs(numberOfEdges);
-      for (int i = 0; i < numberOfEdges; i++) {
-        edgeIDs[i] = mesh.edges()[i].getID();
-      }
-      _communication->send(edgeIDs, rankReceiver);
-
-      std::vector<int> triangleIDs(numberOfTriangles * 3);
-      for (int i = 0; i < numberOfTriangles; i++) {
-        triangleIDs[i * 3]     = mesh.triangles()[i].edge(0).getID();
-        triangleIDs[i * 3 + 1] = mesh.triangles()[i].edge(1).getID();
-        triangleIDs[i * 3 + 2] = mesh.triangles()[i].edge(2).getID();
-      }
-      _communication->send(triangleIDs, rankReceiver);
-    }
-  }
+  std::vector<double> buffer;
+  packMesh(mesh, buffer);
+  _communication->send(buffer, rankReceiver);
 }
 
 void CommunicateMesh::receiveMesh(
@@ -87,221 +80,27 @@ void CommunicateMesh::receiveMesh(
     int         rankSender)
 {
   TRACE(mesh.getName(), rankSender);
-  int dim = mesh.getDimensions();
-
-  std::vector<mesh::Vertex *>   vertices;
-  std::map<int, mesh::Vertex *> vertexMap;
-  int                           numberOfVertices = 0;
-  _communication->receive(numberOfVertices, rankSender);
-  DEBUG("Number of vertices to receive: " << numberOfVertices);
-
-  if (numberOfVertices > 0) {
-    std::vector<double> vertexCoords;
-    std::vector<int> globalIDs;
-    _communication->receive(vertexCoords, rankSender);
-    _communication->receive(globalIDs, rankSender);
-    for (int i = 0; i < numberOfVertices; i++) {
-      Eigen::VectorXd coords(dim);
-      for (int d = 0; d < dim; d++) {
-        coords[d] = vertexCoords[i * dim + d];
-      }
-      mesh::Vertex &v = mesh.createVertex(coords);
-      assertion(v.getID() >= 0, v.getID());
-      v.setGlobalIndex(globalIDs[i]);
-      vertices.push_back(&v);
-    }
-  }
-
-  int                       numberOfEdges = 0;
-  std::vector<mesh::Edge *> edges;
-  _communication->receive(numberOfEdges, rankSender);
-  DEBUG("Number of edges to receive: " << numberOfEdges);
-  if (numberOfEdges > 0) {
-    std::vector<int> vertexIDs;
-    _communication->receive(vertexIDs, rankSender);
-    for (int i = 0; i < numberOfVertices; i++) {
-      vertexMap[vertexIDs[i]] = vertices[i];
-    }
-
-    std::vector<int> edgeIDs;
-    _communication->receive(edgeIDs, rankSender);
-    for (int i = 0; i < numberOfEdges; i++) {
-      assertion(vertexMap.find(edgeIDs[i * 2]) != vertexMap.end());
-      assertion(vertexMap.find(edgeIDs[i * 2 + 1]) != vertexMap.end());
-      assertion(edgeIDs[i * 2] != edgeIDs[i * 2 + 1]);
-      mesh::Edge &e = mesh.createEdge(*vertexMap[edgeIDs[i * 2]], *vertexMap[edgeIDs[i * 2 + 1]]);
-      edges.push_back(&e);
-    }
-  }
-
-  if (dim == 3) {
-    int numberOfTriangles = 0;
-    _communication->receive(numberOfTriangles, rankSender);
-    DEBUG("Number of Triangles to receive: " << numberOfTriangles);
-    DEBUG("Number of Edges: " << edges.size());
-    if (numberOfTriangles > 0) {
-      assertion((edges.size() > 0) || (numberOfTriangles == 0));
-      std::vector<int> edgeIDs;
-      _communication->receive(edgeIDs, rankSender);
-      std::map<int, mesh::Edge *> edgeMap;
-      for (int i = 0; i < numberOfEdges; i++) {
-        edgeMap[edgeIDs[i]] = edges[i];
-      }
-
-      std::vector<int> triangleIDs;
-      _communication->receive(triangleIDs, rankSender);
-
-      for (int i = 0; i < numberOfTriangles; i++) {
-        assertion(edgeMap.find(triangleIDs[i * 3]) != edgeMap.end());
-        assertion(edgeMap.find(triangleIDs[i * 3 + 1]) != edgeMap.end());
-        assertion(edgeMap.find(triangleIDs[i * 3 + 2]) != edgeMap.end());
-        assertion(triangleIDs[i * 3] != triangleIDs[i * 3 + 1]);
-        assertion(triangleIDs[i * 3 + 1] != triangleIDs[i * 3 + 2]);
-        assertion(triangleIDs[i * 3 + 2] != triangleIDs[i * 3]);
-        mesh.createTriangle(*edgeMap[triangleIDs[i * 3]], *edgeMap[triangleIDs[i * 3 + 1]], *edgeMap[triangleIDs[i * 3 + 2]]);
-      }
-    }
-  }
+  std::vector<double> buffer;
+  _communication->receive(buffer, rankSender);
+  unpackMesh(buffer, mesh);
 }
 
 void CommunicateMesh::broadcastSendMesh(const mesh::Mesh &mesh)
 {
   TRACE(mesh.getName());
-  int dim = mesh.getDimensions();
-
-  int numberOfVertices = mesh.vertices().size();
-  _communication->broadcast(numberOfVertices);
-  if (numberOfVertices > 0) {
-    std::vector<double> coords(numberOfVertices * dim);
-    std::vector<int> globalIDs(numberOfVertices);
-    for (int i = 0; i < numberOfVertices; i++) {
-      for (int d = 0; d < dim; d++) {
-        coords[i * dim + d] = mesh.vertices()[i].getCoords()[d];
-      }
-      globalIDs[i] = mesh.vertices()[i].getGlobalIndex();
-    }
-    _communication->broadcast(coords);
-    _communication->broadcast(globalIDs);
-  }
-
-  int numberOfEdges = mesh.edges().size();
-  _communication->broadcast(numberOfEdges);
-  if (numberOfEdges > 0) {
-    //we need to send the vertexIDs first such that the right edges can be created later
-    //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-    std::vector<int> vertexIDs(numberOfVertices);
-    for (int i = 0; i < numberOfVertices; i++) {
-      vertexIDs[i] = mesh.vertices()[i].getID();
-    }
-    _communication->broadcast(vertexIDs);
-
-    std::vector<int> edgeIDs(numberOfEdges * 2);
-    for (int i = 0; i < numberOfEdges; i++) {
-      edgeIDs[i * 2]     = mesh.edges()[i].vertex(0).getID();
-      edgeIDs[i * 2 + 1] = mesh.edges()[i].vertex(1).getID();
-    }
-    _communication->broadcast(edgeIDs);
-  }
-
-  if (dim == 3) {
-    int numberOfTriangles = mesh.triangles().size();
-    _communication->broadcast(numberOfTriangles);
-    if (numberOfTriangles > 0) {
-      //we need to send the edgeIDs first such that the right edges can be created later
-      //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-      std::vector<int> edgeIDs(numberOfEdges);
-      for (int i = 0; i < numberOfEdges; i++) {
-        edgeIDs[i] = mesh.edges()[i].getID();
-      }
-      _communication->broadcast(edgeIDs);
-
-      std::vector<int> triangleIDs(numberOfTriangles * 3);
-      for (int i = 0; i < numberOfTriangles; i++) {
-        triangleIDs[i * 3]     = mesh.triangles()[i].edge(0).getID();
-        triangleIDs[i * 3 + 1] = mesh.triangles()[i].edge(1).getID();
-        triangleIDs[i * 3 + 2] = mesh.triangles()[i].edge(2).getID();
-      }
-      _communication->broadcast(triangleIDs);
-    }
-  }
+  std::vector<double> buffer;
+  packMesh(mesh, buffer);
+  _communication->broadcast(buffer);
 }
 
 void CommunicateMesh::broadcastReceiveMesh(
     mesh::Mesh &mesh)
 {
   TRACE(mesh.getName());
-  int dim             = mesh.getDimensions();
-  int rankBroadcaster = 0;
-
-  std::vector<mesh::Vertex *>   vertices;
-  std::map<int, mesh::Vertex *> vertexMap;
-  int                           numberOfVertices = 0;
-  _communication->broadcast(numberOfVertices, rankBroadcaster);
-
-  if (numberOfVertices > 0) {
-    std::vector<double> vertexCoords;
-    std::vector<int> globalIDs;
-    _communication->broadcast(vertexCoords, rankBroadcaster);
-    _communication->broadcast(globalIDs, rankBroadcaster);
-    for (int i = 0; i < numberOfVertices; i++) {
-      Eigen::VectorXd coords(dim);
-      for (int d = 0; d < dim; d++) {
-        coords[d] = vertexCoords[i * dim + d];
-      }
-      mesh::Vertex &v = mesh.createVertex(coords);
-      assertion(v.getID() >= 0, v.getID());
-      v.setGlobalIndex(globalIDs[i]);
-      vertices.push_back(&v);
-    }
-  }
-
-  int                       numberOfEdges = 0;
-  std::vector<mesh::Edge *> edges;
-  _communication->broadcast(numberOfEdges, rankBroadcaster);
-  if (numberOfEdges > 0) {
-    std::vector<int> vertexIDs;
-    _communication->broadcast(vertexIDs, rankBroadcaster);
-    for (int i = 0; i < numberOfVertices; i++) {
-      vertexMap[vertexIDs[i]] = vertices[i];
-    }
-
-    std::vector<int> edgeIDs;
-    _communication->broadcast(edgeIDs, rankBroadcaster);
-    for (int i = 0; i < numberOfEdges; i++) {
-      assertion(vertexMap.find(edgeIDs[i * 2]) != vertexMap.end());
-      assertion(vertexMap.find(edgeIDs[i * 2 + 1]) != vertexMap.end());
-      assertion(edgeIDs[i * 2] != edgeIDs[i * 2 + 1]);
-      mesh::Edge &e = mesh.createEdge(*vertexMap[edgeIDs[i * 2]], *vertexMap[edgeIDs[i * 2 + 1]]);
-      edges.push_back(&e);
-    }
-  }
-
-  if (dim == 3) {
-    int numberOfTriangles = 0;
-    _communication->broadcast(numberOfTriangles, rankBroadcaster);
-    if (numberOfTriangles > 0) {
-      assertion((edges.size() > 0) || (numberOfTriangles == 0));
-      std::vector<int> edgeIDs;
-      _communication->broadcast(edgeIDs, rankBroadcaster);
-      std::map<int, mesh::Edge *> edgeMap;
-      for (int i = 0; i < numberOfEdges; i++) {
-        edgeMap[edgeIDs[i]] = edges[i];
-      }
-
-      std::vector<int> triangleIDs;
-      _communication->broadcast(triangleIDs, rankBroadcaster);
-
-      for (int i = 0; i < numberOfTriangles; i++) {
-        assertion(edgeMap.find(triangleIDs[i * 3]) != edgeMap.end());
-        assertion(edgeMap.find(triangleIDs[i * 3 + 1]) != edgeMap.end());
-        assertion(edgeMap.find(triangleIDs[i * 3 + 2]) != edgeMap.end());
-        assertion(triangleIDs[i * 3] != triangleIDs[i * 3 + 1]);
-        assertion(triangleIDs[i * 3 + 1] != triangleIDs[i * 3 + 2]);
-        assertion(triangleIDs[i * 3 + 2] != triangleIDs[i * 3]);
-        mesh.createTriangle(*edgeMap[triangleIDs[i * 3]], *edgeMap[triangleIDs[i * 3 + 1]], *edgeMap[triangleIDs[i * 3 + 2]]);
-      }
-    }
-  }
+  int                 rankBroadcaster = 0;
+  std::vector<double> buffer;
+  _communication->broadcast(buffer, rankBroadcaster);
+  unpackMesh(buffer, mesh);
 }
 
 void CommunicateMesh::sendBoundingBox(
@@ -327,5 +126,120 @@ void CommunicateMesh::receiveBoundingBox(
     _communication->receive(bb[d].second, rankSender);
   }
 }
+void CommunicateMesh::packMesh(
+    const mesh::Mesh &   mesh,
+    std::vector<double> &buffer)
+{
+  const int    dim          = mesh.getDimensions();
+  const size_t numVertices  = mesh.vertices().size();
+  const size_t numEdges     = mesh.edges().size();
+  const size_t numTriangles = mesh.triangles().size();
+
+  const size_t coordsOffset    = HEADER_SIZE;
+  const size_t globalIDsOffset = coordsOffset + numVertices * dim;
+  const size_t edgesOffset     = globalIDsOffset + intSectionSize(numVertices);
+  const size_t trianglesOffset = edgesOffset + intSectionSize(numEdges * 2);
+  buffer.assign(trianglesOffset + intSectionSize(numTriangles * 3), 0.0);
+
+  buffer[0] = dim;
+  buffer[1] = numVertices;
+  buffer[2] = numEdges;
+  buffer[3] = numTriangles;
+
+  double *         coords = buffer.data() + coordsOffset;
+  std::vector<int> globalIDs(numVertices);
+  std::vector<int> edges(numEdges * 2);
+  std::vector<int> triangles(numTriangles * 3);
+
+  size_t i = 0;
+  for (const mesh::Vertex &vertex : mesh.vertices()) {
+    Eigen::Map<Eigen::VectorXd>(coords + i * dim, dim) = vertex.getCoords();
+    globalIDs[i]                                       = vertex.getGlobalIndex();
+    i++;
+  }
+
+  // Connectivity refers to positions in the sent mesh, such that the receiver
+  // does not need to look up IDs and delta meshes are supported.
+  if (numEdges > 0) {
+    const std::vector<int> vertexPositions = positionsByID(mesh.vertices());
+    i                                      = 0;
+    for (const mesh::Edge &edge : mesh.edges()) {
+      edges[i++] = vertexPositions[edge.vertex(0).getID()];
+      edges[i++] = vertexPositions[edge.vertex(1).getID()];
+    }
+  }
+
+  if (numTriangles > 0) {
+    const std::vector<int> edgePositions = positionsByID(mesh.edges());
+    i                                    = 0;
+    for (const mesh::Triangle &triangle : mesh.triangles()) {
+      for (int j = 0; j < 3; j++) {
+        triangles[i++] = edgePositions[triangle.edge(j).getID()];
+      }
+    }
+  }
+
+  // The sections of integers are stored bytewise in the buffer of doubles
+  copyToSection(globalIDs, buffer.data() + globalIDsOffset);
+  copyToSection(edges, buffer.data() + edgesOffset);
+  copyToSection(triangles, buffer.data() + trianglesOffset);
+}
+
+void CommunicateMesh::unpackMesh(
+    const std::vector<double> &buffer,
+    mesh::Mesh &               mesh)
+{
+  CHECK(buffer.size() >= HEADER_SIZE, "Received an invalid mesh message of size " << buffer.size());
+  const int    dim          = mesh.getDimensions();
+  const size_t numVertices  = buffer[1];
+  const size_t numEdges     = buffer[2];
+  const size_t numTriangles = buffer[3];
+  CHECK(static_cast<int>(buffer[0]) == dim,
+        "Received a mesh of dimension " << buffer[0] << " for mesh \"" << mesh.getName()
+                                        << "\" of dimension " << dim);
+  DEBUG("Number of vertices to receive: " << numVertices);
+  DEBUG("Number of edges to receive: " << numEdges);
+  DEBUG("Number of triangles to receive: " << numTriangles);
+
+  const size_t coordsOffset    = HEADER_SIZE;
+  const size_t globalIDsOffset = coordsOffset + numVertices * dim;
+  const size_t edgesOffset     = globalIDsOffset + intSectionSize(numVertices);
+  const size_t trianglesOffset = edgesOffset + intSectionSize(numEdges * 2);
+  assertion(buffer.size() == trianglesOffset + intSectionSize(numTriangles * 3), buffer.size());
+
+  const std::vector<int> globalIDs = copyFromSection(buffer.data() + globalIDsOffset, numVertices);
+  const std::vector<int> edges     = copyFromSection(buffer.data() + edgesOffset, numEdges * 2);
+  const std::vector<int> triangles = copyFromSection(buffer.data() + trianglesOffset, numTriangles * 3);
+
+  const size_t firstVertex = mesh.vertices().size();
+  if (numVertices > 0) {
+    mesh.createVertices(numVertices, buffer.data() + coordsOffset);
+    for (size_t i = 0; i < numVertices; i++) {
+      mesh.vertices()[firstVertex + i].setGlobalIndex(globalIDs[i]);
+    }
+  }
+
+  const size_t firstEdge = mesh.edges().size();
+  for (size_t i = 0; i < numEdges; i++) {
+    const int v0 = edges[i * 2];
+    const int v1 = edges[i * 2 + 1];
+    assertion(v0 >= 0 && v0 < static_cast<int>(numVertices), v0);
+    assertion(v1 >= 0 && v1 < static_cast<int>(numVertices), v1);
+    assertion(v0 != v1);
+    mesh.createEdge(mesh.vertices()[firstVertex + v0], mesh.vertices()[firstVertex + v1]);
+  }
+
+  for (size_t i = 0; i < numTriangles; i++) {
+    const int *e = triangles.data() + i * 3;
+    assertion(e[0] >= 0 && e[0] < static_cast<int>(numEdges), e[0]);
+    assertion(e[1] >= 0 && e[1] < static_cast<int>(numEdges), e[1]);
+    assertion(e[2] >= 0 && e[2] < static_cast<int>(numEdges), e[2]);
+    assertion(e[0] != e[1] && e[1] != e[2] && e[2] != e[0]);
+    mesh.createTriangle(mesh.edges()[firstEdge + e[0]],
+                        mesh.edges()[firstEdge + e[1]],
+                        mesh.edges()[firstEdge + e[2]]);
+  }
+}
+
 } // namespace com
 } // namespace precice
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <vector>
 #include "com/SharedPointer.hpp"
 #include "logging/Logger.hpp"
 #include "mesh/Mesh.hpp"
@@ -9,7 +10,15 @@ namespace precice
 namespace com
 {
 
-/// Copies a Mesh object from a sender to a receiver.
+/**
+ * @brief Copies a Mesh object from a sender to a receiver.
+ *
+ * A mesh is transferred as one message, which consists of a header with the
+ * dimensions and the numbers of vertices, edges and triangles, followed by
+ * contiguous sections of vertex coordinates, global vertex indices, edges and
+ * triangles. Edges and triangles refer to the positions of their vertices and
+ * edges in the transferred mesh, not to their IDs.
+ */
 class CommunicateMesh
 {
 public:
@@ -43,6 +52,16 @@ public:
 
 private:
   logging::Logger _log{"com::CommunicateMesh"};
+
+  /// Serializes the mesh into a single buffer.
+  void packMesh(
+      const mesh::Mesh &   mesh,
+      std::vector<double> &buffer);
+
+  /// Adds the vertices, edges and triangles of a serialized mesh to mesh.
+  void unpackMesh(
+      const std::vector<double> &buffer,
+      mesh::Mesh &               mesh);
   
   /// Communication means used for the transfer of the geometry.
   com::PtrCommunication _communication;
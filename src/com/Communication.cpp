@@ -1,5 +1,6 @@
 #include "Communication.hpp"
 #include "Request.hpp"
+#include "utils/EventUtils.hpp"
 
 namespace precice
 {
@@ -286,5 +287,54 @@ void Communication::broadcast(std::vector<double> &v, int rankBroadcaster)
   broadcast(v.data(), size, rankBroadcaster);
 }
 
+std::map<int, utils::ChannelData> Communication::getStatistics() const
+{
+  std::map<int, utils::ChannelData> statistics;
+  for (auto const &remote : _statistics) {
+    statistics[remote.first + _rankOffset] = *remote.second;
+  }
+  return statistics;
+}
+
+std::shared_ptr<utils::ChannelData> const &Communication::channelData(int remoteRank)
+{
+  auto &data = _statistics[remoteRank];
+  if (not data) {
+    data = std::make_shared<utils::ChannelData>();
+  }
+  return data;
+}
+
+void Communication::countSent(int remoteRank, size_t bytes)
+{
+  auto &data = *channelData(remoteRank);
+  data.bytesSent += bytes;
+  data.messagesSent++;
+}
+
+void Communication::countReceived(int remoteRank, size_t bytes, utils::Event::Clock::time_point start)
+{
+  auto &data = *channelData(remoteRank);
+  data.bytesReceived += bytes;
+  data.messagesReceived++;
+  data.waitTime += utils::Event::Clock::now() - start;
+}
+
+PtrRequest Communication::countSent(int remoteRank, size_t bytes, PtrRequest request)
+{
+  countSent(remoteRank, bytes);
+  request->setChannelData(channelData(remoteRank));
+  return request;
+}
+
+PtrRequest Communication::countReceived(int remoteRank, size_t bytes, PtrRequest request)
+{
+  auto const &data = channelData(remoteRank);
+  data->bytesReceived += bytes;
+  data->messagesReceived++;
+  request->setChannelData(data);
+  return request;
+}
+
 } // namespace com
 } // namespace precice
@@ -1,7 +1,13 @@
 #pragma once
 
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
 #include "Request.hpp"
 #include "logging/Logger.hpp"
+#include "utils/Event.hpp"
+#include "utils/assertion.hpp"
 
 namespace precice
 {
@@ -40,6 +46,12 @@ namespace com
  * @attention All receive methods, that accept a raw array, expect it to be 
  * sized appropriatly. Asynchronous receive methods also expect the vector
  * be sized correctly.
+ *
+ * The implementations count the bytes and messages sent to and received from every
+ * remote rank, and the time blocked in receives and in waiting for requests, see
+ * getStatistics(). A message is one transfer of the underlying communication, e.g., a
+ * vector sent with its size is counted as two messages by some implementations.
+ * Collective operations implemented by MPI collectives are not counted.
  */
 class Communication
 {
@@ -136,7 +148,37 @@ public:
                                           std::string   const &requesterName,
                                           std::set<int> const &acceptorRanks,
                                           int                  requesterRank) = 0;
-  
+
+  /**
+   * @brief Opens the endpoint of a subsequent acceptConnectionAsServer() and returns its address.
+   *
+   * acceptConnectionAsServer() then accepts the connections at this endpoint without publishing
+   * its address in a file. The requesters need to obtain the address by other means, e.g. over
+   * the master-slave communication, and connect with requestConnectionAtAddresses().
+   *
+   * @returns the address of the endpoint, or an empty string if the communication can only
+   *          exchange its address by file.
+   */
+  virtual std::string prepareConnectionAsServer()
+  {
+    return "";
+  }
+
+  /**
+   * @brief Connects to servers, which have called prepareConnectionAsServer() and acceptConnectionAsServer().
+   *
+   * Equivalent to requestConnectionAsClient(), but the addresses of the acceptors are given
+   * instead of read from the address files.
+   *
+   * @param[in] acceptorAddresses Ranks that accept a connection and the address of their endpoint
+   * @param[in] requesterRank Rank that requests the connection, usually the caller's rank
+   */
+  virtual void requestConnectionAtAddresses(std::map<int, std::string> const &acceptorAddresses,
+                                            int                               requesterRank)
+  {
+    assertion(false, "Not implemented!");
+  }
+
   /**
    * @brief Disconnects from communication space, i.e. participant.
    *
@@ -287,15 +329,35 @@ public:
     _rankOffset = rankOffset;
   }
 
+  /// Returns the volume and wait time of the communication with every remote rank so far.
+  std::map<int, utils::ChannelData> getStatistics() const;
+
 protected:
   /// Rank offset for masters-slave communication, since ranks are from 0 to size - 2
   int _rankOffset = 0;
 
   bool _isConnected = false;
 
+  /// Counts a message sent to the remote rank, which is given without rank offset.
+  void countSent(int remoteRank, size_t bytes);
+
+  /// Counts a message received from the remote rank, the receive having blocked since start.
+  void countReceived(int remoteRank, size_t bytes, utils::Event::Clock::time_point start);
+
+  /// Counts an asynchronous send and adds the time blocked in waiting for the request.
+  PtrRequest countSent(int remoteRank, size_t bytes, PtrRequest request);
+
+  /// Counts an asynchronous receive and adds the time blocked in waiting for the request.
+  PtrRequest countReceived(int remoteRank, size_t bytes, PtrRequest request);
+
 private:
   logging::Logger _log{"com::Communication"};
-  
+
+  /// Returns the statistics of a remote rank, which is given without rank offset.
+  std::shared_ptr<utils::ChannelData> const &channelData(int remoteRank);
+
+  /// Remote rank without rank offset -> statistics, shared with the requests of the rank
+  std::map<int, std::shared_ptr<utils::ChannelData>> _statistics;
 };
 } // namespace com
 } // namespace precice
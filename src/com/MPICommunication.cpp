@@ -51,6 +51,7 @@ void MPICommunication::send(std::string const &itemToSend, int rankReceiver)
            rank(rankReceiver),
            0,
            communicator(rankReceiver));
+  countSent(rankReceiver, itemToSend.size());
 }
 
 void MPICommunication::send(const int *itemsToSend, int size, int rankReceiver)
@@ -63,6 +64,7 @@ void MPICommunication::send(const int *itemsToSend, int size, int rankReceiver)
            rank(rankReceiver),
            0,
            communicator(rankReceiver));
+  countSent(rankReceiver, size * sizeof(int));
 }
 
 PtrRequest MPICommunication::aSend(const int *itemsToSend, int size, int rankReceiver)
@@ -79,7 +81,7 @@ PtrRequest MPICommunication::aSend(const int *itemsToSend, int size, int rankRec
             communicator(rankReceiver),
             &request);
 
-  return PtrRequest(new MPIRequest(request));
+  return countSent(rankReceiver, size * sizeof(int), PtrRequest(new MPIRequest(request)));
 }
 
 void MPICommunication::send(const double *itemsToSend, int size, int rankReceiver)
@@ -92,6 +94,7 @@ void MPICommunication::send(const double *itemsToSend, int size, int rankReceive
            rank(rankReceiver),
            0,
            communicator(rankReceiver));
+  countSent(rankReceiver, size * sizeof(double));
 }
 
 PtrRequest MPICommunication::aSend(const double *itemsToSend, int size, int rankReceiver)
@@ -108,7 +111,7 @@ PtrRequest MPICommunication::aSend(const double *itemsToSend, int size, int rank
             communicator(rankReceiver),
             &request);
 
-  return PtrRequest(new MPIRequest(request));
+  return countSent(rankReceiver, size * sizeof(double), PtrRequest(new MPIRequest(request)));
 }
 
 PtrRequest MPICommunication::aSend(std::vector<double> const & itemsToSend, int rankReceiver)
@@ -125,7 +128,7 @@ PtrRequest MPICommunication::aSend(std::vector<double> const & itemsToSend, int
             communicator(rankReceiver),
             &request);
 
-  return PtrRequest(new MPIRequest(request));
+  return countSent(rankReceiver, itemsToSend.size() * sizeof(double), PtrRequest(new MPIRequest(request)));
 }
 
 void MPICommunication::send(double itemToSend, int rankReceiver)
@@ -138,6 +141,7 @@ void MPICommunication::send(double itemToSend, int rankReceiver)
            rank(rankReceiver),
            0,
            communicator(rankReceiver));
+  countSent(rankReceiver, sizeof(double));
 }
 
 PtrRequest MPICommunication::aSend(const double& itemToSend, int rankReceiver)
@@ -155,6 +159,7 @@ void MPICommunication::send(int itemToSend, int rankReceiver)
            rank(rankReceiver),
            0,
            communicator(rankReceiver));
+  countSent(rankReceiver, sizeof(int));
 }
 
 PtrRequest MPICommunication::aSend(const int& itemToSend, int rankReceiver)
@@ -172,6 +177,7 @@ void MPICommunication::send(bool itemToSend, int rankReceiver)
            rank(rankReceiver),
            0,
            communicator(rankReceiver));
+  countSent(rankReceiver, sizeof(bool));
 }
 
 PtrRequest MPICommunication::aSend(const bool& itemToSend, int rankReceiver)
@@ -188,13 +194,14 @@ PtrRequest MPICommunication::aSend(const bool& itemToSend, int rankReceiver)
             communicator(rankReceiver),
             &request);
 
-  return PtrRequest(new MPIRequest(request));
+  return countSent(rankReceiver, sizeof(bool), PtrRequest(new MPIRequest(request)));
 }
 
 void MPICommunication::receive(std::string &itemToReceive, int rankSender)
 {
   TRACE(itemToReceive, rankSender);
   rankSender = rankSender - _rankOffset;
+  const auto start = utils::Event::Clock::now();
   int        length;
   MPI_Status status;
   MPI_Probe(rank(rankSender), 0, communicator(rankSender), &status);
@@ -209,12 +216,14 @@ void MPICommunication::receive(std::string &itemToReceive, int rankSender)
            communicator(rankSender),
            MPI_STATUS_IGNORE);
   DEBUG("Received \"" << itemToReceive << "\" from rank " << rankSender);
+  countReceived(rankSender, length, start);
 }
 
 void MPICommunication::receive(int *itemsToReceive, int size, int rankSender)
 {
   TRACE(size);
   rankSender = rankSender - _rankOffset;
+  const auto start = utils::Event::Clock::now();
   
   MPI_Status status;
   MPI_Recv(itemsToReceive,
@@ -224,12 +233,14 @@ void MPICommunication::receive(int *itemsToReceive, int size, int rankSender)
            0,
            communicator(rankSender),
            &status);
+  countReceived(rankSender, size * sizeof(int), start);
 }
 
 void MPICommunication::receive(double *itemsToReceive, int size, int rankSender)
 {
   TRACE(size);
   rankSender = rankSender - _rankOffset;
+  const auto start = utils::Event::Clock::now();
   
   MPI_Status status;
   MPI_Recv(itemsToReceive,
@@ -239,6 +250,7 @@ void MPICommunication::receive(double *itemsToReceive, int size, int rankSender)
            0,
            communicator(rankSender),
            &status);
+  countReceived(rankSender, size * sizeof(double), start);
 }
 
 PtrRequest MPICommunication::aReceive(double *itemsToReceive, int size, int rankSender)
@@ -255,7 +267,7 @@ PtrRequest MPICommunication::aReceive(double *itemsToReceive, int size, int rank
             communicator(rankSender),
             &request);
 
-  return PtrRequest(new MPIRequest(request));
+  return countReceived(rankSender, size * sizeof(double), PtrRequest(new MPIRequest(request)));
 }
 
 PtrRequest MPICommunication::aReceive(std::vector<double> & itemsToReceive, int rankSender)
@@ -272,13 +284,14 @@ PtrRequest MPICommunication::aReceive(std::vector<double> & itemsToReceive, int
             communicator(rankSender),
             &request);
 
-  return PtrRequest(new MPIRequest(request));
+  return countReceived(rankSender, itemsToReceive.size() * sizeof(double), PtrRequest(new MPIRequest(request)));
 }
 
 void MPICommunication::receive(double &itemToReceive, int rankSender)
 {
   TRACE(rankSender);
   rankSender = rankSender - _rankOffset;
+  const auto start = utils::Event::Clock::now();
   
   MPI_Status status;
   MPI_Recv(&itemToReceive,
@@ -289,6 +302,7 @@ void MPICommunication::receive(double &itemToReceive, int rankSender)
            communicator(rankSender),
            &status);
   DEBUG("Received " << itemToReceive << " from rank " << rankSender);
+  countReceived(rankSender, sizeof(double), start);
 }
 
 PtrRequest MPICommunication::aReceive(double &itemToReceive, int rankSender)
@@ -300,6 +314,7 @@ void MPICommunication::receive(int &itemToReceive, int rankSender)
 {
   TRACE(rankSender);
   rankSender = rankSender - _rankOffset;
+  const auto start = utils::Event::Clock::now();
 
   MPI_Status status;
   MPI_Recv(&itemToReceive,
@@ -310,6 +325,7 @@ void MPICommunication::receive(int &itemToReceive, int rankSender)
            communicator(rankSender),
            &status);
   DEBUG("Received " << itemToReceive << " from rank " << rankSender);
+  countReceived(rankSender, sizeof(int), start);
 }
 
 PtrRequest MPICommunication::aReceive(int &itemToReceive, int rankSender)
@@ -326,13 +342,14 @@ PtrRequest MPICommunication::aReceive(int &itemToReceive, int rankSender)
             communicator(rankSender),
             &request);
 
-  return PtrRequest(new MPIRequest(request));
+  return countReceived(rankSender, sizeof(int), PtrRequest(new MPIRequest(request)));
 }
 
 void MPICommunication::receive(bool &itemToReceive, int rankSender)
 {
   TRACE(rankSender);
   rankSender = rankSender - _rankOffset;
+  const auto start = utils::Event::Clock::now();
 
   MPI_Status status;
   MPI_Recv(&itemToReceive,
@@ -343,6 +360,7 @@ void MPICommunication::receive(bool &itemToReceive, int rankSender)
            communicator(rankSender),
            &status);
   DEBUG("Received " << itemToReceive << " from rank " << rankSender);
+  countReceived(rankSender, sizeof(bool), start);
 }
 
 PtrRequest MPICommunication::aReceive(bool &itemToReceive, int rankSender)
@@ -359,7 +377,7 @@ PtrRequest MPICommunication::aReceive(bool &itemToReceive, int rankSender)
             communicator(rankSender),
             &request);
 
-  return PtrRequest(new MPIRequest(request));
+  return countReceived(rankSender, sizeof(bool), PtrRequest(new MPIRequest(request)));
 }
 
 void MPICommunication::send(std::vector<int> const &v, int rankReceiver)
@@ -368,12 +386,14 @@ void MPICommunication::send(std::vector<int> const &v, int rankReceiver)
   rankReceiver = rankReceiver - _rankOffset;
   MPI_Send(const_cast<int*>(v.data()), v.size(), MPI_INT,
            rank(rankReceiver), 0, communicator(rankReceiver));
+  countSent(rankReceiver, v.size() * sizeof(int));
 }
 
 void MPICommunication::receive(std::vector<int> &v, int rankSender)
 {
   TRACE(rankSender);
   rankSender = rankSender - _rankOffset;
+  const auto start = utils::Event::Clock::now();
   int        length = -1;
   MPI_Status status;
   MPI_Probe(rank(rankSender), 0, communicator(rankSender), &status);
@@ -381,6 +401,7 @@ void MPICommunication::receive(std::vector<int> &v, int rankSender)
   v.resize(length);
   MPI_Recv(v.data(), length, MPI_INT, rank(rankSender),
            0, communicator(rankSender), MPI_STATUS_IGNORE);
+  countReceived(rankSender, length * sizeof(int), start);
 }
 
 void MPICommunication::send(std::vector<double> const &v, int rankReceiver)
@@ -389,12 +410,14 @@ void MPICommunication::send(std::vector<double> const &v, int rankReceiver)
   rankReceiver = rankReceiver - _rankOffset;
   MPI_Send(const_cast<double*>(v.data()), v.size(), MPI_DOUBLE,
            rank(rankReceiver), 0, communicator(rankReceiver));
+  countSent(rankReceiver, v.size() * sizeof(double));
 }
 
 void MPICommunication::receive(std::vector<double> &v, int rankSender)
 {
   TRACE(rankSender);
   rankSender = rankSender - _rankOffset;
+  const auto start = utils::Event::Clock::now();
   int        length = -1;
   MPI_Status status;
   MPI_Probe(rank(rankSender), 0, communicator(rankSender), &status);
@@ -402,6 +425,7 @@ void MPICommunication::receive(std::vector<double> &v, int rankSender)
   v.resize(length, '\0');
   MPI_Recv(v.data(), length, MPI_DOUBLE, rank(rankSender),
            0, communicator(rankSender), MPI_STATUS_IGNORE);
+  countReceived(rankSender, length * sizeof(double), start);
 }
 
 
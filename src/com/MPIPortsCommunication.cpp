@@ -1,6 +1,7 @@
 #ifndef PRECICE_NO_MPI
 
 #include "MPIPortsCommunication.hpp"
+#include <memory>
 #include "utils/assertion.hpp"
 #include "utils/Parallel.hpp"
 #include "utils/Publisher.hpp"
@@ -95,15 +96,18 @@ void MPIPortsCommunication::acceptConnectionAsServer(
   CHECK(requesterCommunicatorSize > 0, "Requester communicator size has to be > 0!");
   assertion(not isConnected());
 
-  _isAcceptor = true;
-
-  MPI_Open_port(MPI_INFO_NULL, const_cast<char *>(_portName.data()));
+  // Publish the port by file, unless it has been handed to the requesters otherwise
+  std::unique_ptr<ScopedPublisher> publisher;
+  if (not _isPortPrepared) {
+    prepareConnectionAsServer();
 
-  const std::string addressFileName("." + requesterName + "-" +
-                                    acceptorName + "-" + std::to_string(acceptorRank) + ".address");
-  Publisher::ScopedChangePrefixDirectory scpd(_addressDirectory);
-  ScopedPublisher                        p(addressFileName);
-  p.write(_portName);
+    const std::string addressFileName("." + requesterName + "-" +
+                                      acceptorName + "-" + std::to_string(acceptorRank) + ".address");
+    Publisher::ScopedChangePrefixDirectory scpd(_addressDirectory);
+    publisher.reset(new ScopedPublisher(addressFileName));
+    publisher->write(_portName);
+  }
+  _isPortPrepared = false;
   DEBUG("Accept connection at " << _portName);
 
   for (int connection = 0; connection < requesterCommunicatorSize; ++connection) {
@@ -164,20 +168,51 @@ void MPIPortsCommunication::requestConnectionAsClient(std::string      const &ac
 
     Publisher::ScopedChangePrefixDirectory scpd(_addressDirectory);
     Publisher p(addressFileName);
-    _portName = p.read();
-    DEBUG("Request connection to " << _portName);
-
-    MPI_Comm communicator;
-    MPI_Comm_connect(const_cast<char *>(_portName.c_str()), MPI_INFO_NULL, 0, MPI_COMM_SELF, &communicator);
-    DEBUG("Requested connection to " << _portName);
-    _communicators[acceptorRank] = communicator;
-    
-    // Rank 0 is always the peer, because we connected on COMM_SELF
-    MPI_Send(&requesterRank, 1, MPI_INT, 0, 42, communicator);    
+    connectToPort(p.read(), acceptorRank, requesterRank);
   }  
   _isConnected = true;
 }
 
+std::string MPIPortsCommunication::prepareConnectionAsServer()
+{
+  TRACE();
+  assertion(not isConnected());
+  assertion(not _isPortPrepared);
+
+  _isAcceptor     = true;
+  _isPortPrepared = true;
+  MPI_Open_port(MPI_INFO_NULL, const_cast<char *>(_portName.data()));
+  return _portName.c_str();
+}
+
+void MPIPortsCommunication::requestConnectionAtAddresses(std::map<int, std::string> const &acceptorAddresses,
+                                                         int                               requesterRank)
+{
+  TRACE(acceptorAddresses.size(), requesterRank);
+  assertion(not isConnected());
+
+  _isAcceptor = false;
+
+  for (auto const &acceptorAddress : acceptorAddresses) {
+    connectToPort(acceptorAddress.second, acceptorAddress.first, requesterRank);
+  }
+  _isConnected = true;
+}
+
+void MPIPortsCommunication::connectToPort(std::string const &portName, int acceptorRank, int requesterRank)
+{
+  _portName = portName;
+  DEBUG("Request connection to " << _portName);
+
+  MPI_Comm communicator;
+  MPI_Comm_connect(const_cast<char *>(_portName.c_str()), MPI_INFO_NULL, 0, MPI_COMM_SELF, &communicator);
+  DEBUG("Requested connection to " << _portName);
+  _communicators[acceptorRank] = communicator;
+
+  // Rank 0 is always the peer, because we connected on COMM_SELF
+  MPI_Send(&requesterRank, 1, MPI_INT, 0, 42, communicator);
+}
+
 void MPIPortsCommunication::closeConnection()
 {
   TRACE(_communicators.size());
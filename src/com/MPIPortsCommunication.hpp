@@ -43,6 +43,11 @@ public:
                                          std::set<int>    const &acceptorRanks,
                                          int                     requesterRank) override;
 
+  virtual std::string prepareConnectionAsServer() override;
+
+  virtual void requestConnectionAtAddresses(std::map<int, std::string> const &acceptorAddresses,
+                                            int                               requesterRank) override;
+
   virtual void closeConnection() override;
 
 private:
@@ -62,6 +67,12 @@ private:
 
   bool _isAcceptor = false;
 
+  /// Whether the port has been opened by prepareConnectionAsServer().
+  bool _isPortPrepared = false;
+
+  /// Connects to the port of the given acceptor rank and sends it the requester rank.
+  void connectToPort(std::string const &portName, int acceptorRank, int requesterRank);
+
 };
 } // namespace com
 } // namespace precice
@@ -1,6 +1,7 @@
 #ifndef PRECICE_NO_MPI
 
 #include "MPIRequest.hpp"
+#include "utils/assertion.hpp"
 
 namespace precice
 {
@@ -22,7 +23,34 @@ bool MPIRequest::test()
 
 void MPIRequest::wait()
 {
+  const auto start = utils::Event::Clock::now();
   MPI_Wait(&_request, MPI_STATUS_IGNORE);
+  countWait(start);
+}
+
+bool MPIRequest::waitAny(std::vector<PtrRequest> const &requests, size_t &position)
+{
+  std::vector<MPIRequest *> mpiRequests;
+  std::vector<MPI_Request>  handles;
+  std::vector<size_t>       positions;
+  for (size_t i = 0; i < requests.size(); ++i) {
+    if (requests[i]) {
+      auto mpiRequest = dynamic_cast<MPIRequest *>(requests[i].get());
+      if (mpiRequest == nullptr) {
+        return false;
+      }
+      mpiRequests.push_back(mpiRequest);
+      handles.push_back(mpiRequest->_request);
+      positions.push_back(i);
+    }
+  }
+
+  int index = MPI_UNDEFINED;
+  MPI_Waitany(static_cast<int>(handles.size()), handles.data(), &index, MPI_STATUS_IGNORE);
+  assertion(index != MPI_UNDEFINED, "All requests have been completed before");
+  mpiRequests[index]->_request = handles[index];
+  position                     = positions[index];
+  return true;
 }
 } // namespace com
 } // namespace precice
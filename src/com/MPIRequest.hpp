@@ -17,6 +17,13 @@ public:
 
   void wait() override;
 
+  /**
+   * @brief Blocks in MPI_Waitany() until any of the non-empty requests has completed.
+   *
+   * @returns false without waiting, if not all non-empty requests are MPI requests.
+   */
+  static bool waitAny(std::vector<PtrRequest> const &requests, size_t &position);
+
 private:
   MPI_Request _request;
 };
@@ -1,10 +1,24 @@
 #include "Request.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "MPIRequest.hpp"
+#include "utils/EventUtils.hpp"
+#include "utils/assertion.hpp"
 
 namespace precice
 {
 namespace com
 {
 
+namespace
+{
+std::mutex              completionMutex;
+std::condition_variable completionCondition;
+unsigned long           completionCount = 0;
+} // namespace
+
 void Request::wait(std::vector<PtrRequest> &requests)
 {
   for (auto request : requests) {
@@ -12,6 +26,67 @@ void Request::wait(std::vector<PtrRequest> &requests)
   }
 }
 
+size_t Request::waitAny(std::vector<PtrRequest> const &requests)
+{
+  assertion(std::any_of(requests.begin(), requests.end(), [](PtrRequest const &request) { return request != nullptr; }));
+  bool allNotify = true;
+  for (auto const &request : requests) {
+    if (request) {
+      allNotify = allNotify && request->notifiesCompletion();
+    }
+  }
+
+  while (true) {
+    unsigned long completions;
+    {
+      std::lock_guard<std::mutex> lock(completionMutex);
+      completions = completionCount;
+    }
+
+    for (size_t position = 0; position < requests.size(); ++position) {
+      if (requests[position] && requests[position]->test()) {
+        return position;
+      }
+    }
+
+#ifndef PRECICE_NO_MPI
+    size_t position;
+    if (MPIRequest::waitAny(requests, position)) {
+      return position;
+    }
+#endif
+
+    if (allNotify) {
+      // A completion after the requests have been tested changes the count
+      std::unique_lock<std::mutex> lock(completionMutex);
+      completionCondition.wait(lock, [completions] { return completionCount != completions; });
+    } else {
+      std::this_thread::yield();
+    }
+  }
+}
+
+void Request::setChannelData(std::shared_ptr<utils::ChannelData> channelData)
+{
+  _channelData = std::move(channelData);
+}
+
+void Request::countWait(utils::Event::Clock::time_point start)
+{
+  if (_channelData) {
+    _channelData->waitTime += utils::Event::Clock::now() - start;
+  }
+}
+
+void Request::notifyCompletion()
+{
+  {
+    std::lock_guard<std::mutex> lock(completionMutex);
+    ++completionCount;
+  }
+  completionCondition.notify_all();
+}
+
 Request::~Request()
 {
 }
@@ -1,10 +1,17 @@
 #pragma once
 
+#include <memory>
 #include <vector>
 #include "com/SharedPointer.hpp"
+#include "utils/Event.hpp"
 
 namespace precice
 {
+namespace utils
+{
+struct ChannelData;
+}
+
 namespace com
 {
 class Request
@@ -13,11 +20,39 @@ class Request
 public:
   static void wait(std::vector<PtrRequest> &requests);
 
+  /**
+   * @brief Blocks until any of the requests has completed and returns its position.
+   *
+   * Empty requests are skipped, but at least one request must be given. Blocks in MPI_Waitany(),
+   * if all requests are MPI requests, and until the next completion, if all requests notify their
+   * completion. Otherwise, the requests are tested repeatedly.
+   */
+  static size_t waitAny(std::vector<PtrRequest> const &requests);
+
   virtual ~Request();
 
   virtual bool test() = 0;
 
   virtual void wait() = 0;
+
+  /// Adds the time blocked in wait() to the wait time of the given channel.
+  void setChannelData(std::shared_ptr<utils::ChannelData> channelData);
+
+protected:
+  /// Adds the time since start to the wait time of the channel, has to be called at the end of wait().
+  void countWait(utils::Event::Clock::time_point start);
+
+  /// Wakes up waitAny(), has to be called by requests which notify their completion.
+  static void notifyCompletion();
+
+  /// Returns true, if the request calls notifyCompletion() when it completes.
+  virtual bool notifiesCompletion() const
+  {
+    return false;
+  }
+
+private:
+  std::shared_ptr<utils::ChannelData> _channelData;
 };
 } // namespace com
 } // namespace precice
@@ -0,0 +1,810 @@
+#ifndef PRECICE_NO_SHARED_MEMORY
+
+#include "SharedMemoryCommunication.hpp"
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <new>
+#include <sstream>
+#include <thread>
+#include "SharedMemoryRequest.hpp"
+#include "utils/Publisher.hpp"
+#include "utils/assertion.hpp"
+
+using precice::utils::Publisher;
+using precice::utils::ScopedPublisher;
+
+namespace precice
+{
+namespace com
+{
+
+namespace
+{
+
+/// Maximal number of requesters, which can connect to one acceptor.
+constexpr int MAX_REQUESTERS = 1024;
+
+/// Number of polls of a doorbell before going to sleep on its futex.
+constexpr int SPIN_COUNT = 4096;
+
+/// Futex word, which is incremented by the peer whenever it changed a shared state.
+struct Doorbell {
+  std::atomic<std::uint32_t> counter;
+  std::atomic<std::uint32_t> waiters;
+};
+
+/// Shared state of a single producer, single consumer ring buffer of bytes.
+struct RingHeader {
+  /// Total number of bytes written.
+  alignas(64) std::atomic<std::uint64_t> head;
+  /// Total number of bytes read.
+  alignas(64) std::atomic<std::uint64_t> tail;
+};
+
+/// Beginning of a channel segment, which is followed by the data of both ring buffers.
+struct ChannelHeader {
+  int           requesterRank;
+  int           requesterCommunicatorSize;
+  std::uint64_t capacity;
+
+  alignas(64) Doorbell acceptorBell;
+  alignas(64) Doorbell requesterBell;
+
+  RingHeader toAcceptor;
+  RingHeader toRequester;
+};
+
+/// Segment of an acceptor, in which requesters register their ranks.
+struct ListenerHeader {
+  std::atomic<int> tickets;
+  Doorbell         bell;
+  /// Ranks of the registered requesters, shifted by one, since zero marks a free slot.
+  std::atomic<int> requesterRanks[MAX_REQUESTERS];
+};
+
+void ring(Doorbell &bell)
+{
+  bell.counter.fetch_add(1);
+  if (bell.waiters.load() > 0) {
+    syscall(SYS_futex, &bell.counter, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+  }
+}
+
+/// Blocks until the doorbell has been rung after the counter value seen has been read.
+void waitForRing(Doorbell &bell, std::uint32_t seen)
+{
+  for (int i = 0; i < SPIN_COUNT; i++) {
+    if (bell.counter.load(std::memory_order_acquire) != seen) {
+      return;
+    }
+  }
+  bell.waiters.fetch_add(1);
+  while (bell.counter.load() == seen) {
+    syscall(SYS_futex, &bell.counter, FUTEX_WAIT, seen, nullptr, nullptr, 0);
+  }
+  bell.waiters.fetch_sub(1);
+}
+
+/**
+ * @brief Maps a named shared memory segment.
+ *
+ * If create is true, a new segment of the given length is created. Otherwise, an existing
+ * segment is opened and length is set to its size. Returns MAP_FAILED on errors.
+ */
+void *mapSegment(std::string const &name, size_t &length, bool create)
+{
+  int fd = -1;
+  if (create) {
+    shm_unlink(name.c_str()); // Remove leftovers of an aborted run
+    fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+    if (fd < 0 || ftruncate(fd, length) != 0) {
+      if (fd >= 0) {
+        close(fd);
+      }
+      return MAP_FAILED;
+    }
+  } else {
+    fd = shm_open(name.c_str(), O_RDWR, 0);
+    struct stat status;
+    if (fd < 0 || fstat(fd, &status) != 0) {
+      if (fd >= 0) {
+        close(fd);
+      }
+      return MAP_FAILED;
+    }
+    length = status.st_size;
+  }
+  void *address = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  return address;
+}
+
+std::string uniqueSegmentName()
+{
+  static std::atomic<int> counter(0);
+  return "/precice-" + std::to_string(getpid()) + "-" + std::to_string(counter++);
+}
+
+std::string hostName()
+{
+  char name[HOST_NAME_MAX + 1] = {};
+  gethostname(name, HOST_NAME_MAX);
+  return name;
+}
+
+} // namespace
+
+const size_t SharedMemoryCommunication::DEFAULT_BUFFER_SIZE = 1 << 22;
+
+struct SharedMemoryCommunication::Channel {
+  /// Pending part of an asynchronous transfer.
+  struct Transfer {
+    char *                               data;
+    size_t                               size;
+    std::shared_ptr<SharedMemoryRequest> request;
+  };
+
+  void *         address;
+  size_t         length;
+  ChannelHeader *header;
+  RingHeader *   outRing;
+  RingHeader *   inRing;
+  char *         outData;
+  char *         inData;
+  size_t         capacity;
+  Doorbell *     ownBell;
+  Doorbell *     peerBell;
+
+  /// Protects the transfer queues and the stop flag of the worker.
+  std::mutex           mutex;
+  std::deque<Transfer> sends;
+  std::deque<Transfer> receives;
+  std::thread          worker;
+  bool                 stopWorker = false;
+
+  Channel(void *address_, size_t length_, bool isAcceptor)
+      : address(address_),
+        length(length_),
+        header(static_cast<ChannelHeader *>(address_)),
+        capacity(header->capacity)
+  {
+    char *toAcceptorData  = static_cast<char *>(address) + sizeof(ChannelHeader);
+    char *toRequesterData = toAcceptorData + capacity;
+    if (isAcceptor) {
+      outRing  = &header->toRequester;
+      outData  = toRequesterData;
+      inRing   = &header->toAcceptor;
+      inData   = toAcceptorData;
+      ownBell  = &header->acceptorBell;
+      peerBell = &header->requesterBell;
+    } else {
+      outRing  = &header->toAcceptor;
+      outData  = toAcceptorData;
+      inRing   = &header->toRequester;
+      inData   = toRequesterData;
+      ownBell  = &header->requesterBell;
+      peerBell = &header->acceptorBell;
+    }
+  }
+
+  ~Channel()
+  {
+    if (worker.joinable()) {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopWorker = true;
+      }
+      ring(*ownBell);
+      worker.join();
+    }
+    munmap(address, length);
+  }
+
+  /// Writes as many bytes as currently fit into the outgoing ring buffer.
+  size_t tryWrite(const char *data, size_t size)
+  {
+    const std::uint64_t head = outRing->head.load(std::memory_order_relaxed);
+    const std::uint64_t tail = outRing->tail.load(std::memory_order_acquire);
+    const size_t        n    = std::min<size_t>(size, capacity - (head - tail));
+    if (n == 0) {
+      return 0;
+    }
+    const size_t offset = head % capacity;
+    const size_t first  = std::min(n, capacity - offset);
+    std::memcpy(outData + offset, data, first);
+    std::memcpy(outData, data + first, n - first);
+    outRing->head.store(head + n, std::memory_order_release);
+    ring(*peerBell);
+    return n;
+  }
+
+  /// Reads as many bytes as currently available from the incoming ring buffer.
+  size_t tryRead(char *data, size_t size)
+  {
+    const std::uint64_t tail = inRing->tail.load(std::memory_order_relaxed);
+    const std::uint64_t head = inRing->head.load(std::memory_order_acquire);
+    const size_t        n    = std::min<size_t>(size, head - tail);
+    if (n == 0) {
+      return 0;
+    }
+    const size_t offset = tail % capacity;
+    const size_t first  = std::min(n, capacity - offset);
+    std::memcpy(data, inData + offset, first);
+    std::memcpy(data + first, inData, n - first);
+    inRing->tail.store(tail + n, std::memory_order_release);
+    ring(*peerBell);
+    return n;
+  }
+
+  /// Transfers all bytes, waiting for the peer whenever the ring buffer is full or empty.
+  template <typename TryTransfer>
+  void transferAll(TryTransfer tryTransfer, char *data, size_t size)
+  {
+    while (size > 0) {
+      const std::uint32_t seen = ownBell->counter.load();
+      const size_t        n    = tryTransfer(data, size);
+      if (n == 0) {
+        waitForRing(*ownBell, seen);
+      }
+      data += n;
+      size -= n;
+    }
+  }
+
+  void send(const char *data, size_t size)
+  {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      if (not sends.empty()) {
+        lock.unlock();
+        aSend(data, size)->wait();
+        return;
+      }
+    }
+    transferAll([this](char *d, size_t s) { return tryWrite(d, s); }, const_cast<char *>(data), size);
+  }
+
+  void receive(char *data, size_t size)
+  {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      if (not receives.empty()) {
+        lock.unlock();
+        aReceive(data, size)->wait();
+        return;
+      }
+    }
+    transferAll([this](char *d, size_t s) { return tryRead(d, s); }, data, size);
+  }
+
+  PtrRequest aSend(const char *data, size_t size)
+  {
+    auto request = std::make_shared<SharedMemoryRequest>();
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (sends.empty()) {
+        const size_t n = tryWrite(data, size);
+        data += n;
+        size -= n;
+      }
+      if (size > 0) {
+        sends.push_back(Transfer{const_cast<char *>(data), size, request});
+        startWorker();
+      }
+    }
+    if (size == 0) {
+      request->complete();
+    } else {
+      ring(*ownBell);
+    }
+    return request;
+  }
+
+  PtrRequest aReceive(char *data, size_t size)
+  {
+    auto request = std::make_shared<SharedMemoryRequest>();
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (receives.empty()) {
+        const size_t n = tryRead(data, size);
+        data += n;
+        size -= n;
+      }
+      if (size > 0) {
+        receives.push_back(Transfer{data, size, request});
+        startWorker();
+      }
+    }
+    if (size == 0) {
+      request->complete();
+    } else {
+      ring(*ownBell);
+    }
+    return request;
+  }
+
+  /// Must be called with the mutex locked.
+  void startWorker()
+  {
+    if (not worker.joinable()) {
+      worker = std::thread([this] { work(); });
+    }
+  }
+
+  /// Advances the first transfer of a queue, returns true on progress.
+  template <typename TryTransfer>
+  bool advance(std::deque<Transfer> &queue, Transfer &transfer, TryTransfer tryTransfer)
+  {
+    const size_t n = tryTransfer(transfer.data, transfer.size);
+    transfer.data += n;
+    transfer.size -= n;
+    if (transfer.size > 0) {
+      return n > 0;
+    }
+    auto request = transfer.request;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      queue.pop_front();
+    }
+    request->complete();
+    return true;
+  }
+
+  /// Processes the queued transfers in order until the worker is stopped.
+  void work()
+  {
+    while (true) {
+      const std::uint32_t seen    = ownBell->counter.load();
+      Transfer *          send    = nullptr;
+      Transfer *          receive = nullptr;
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (stopWorker) {
+          return;
+        }
+        if (not sends.empty()) {
+          send = &sends.front();
+        }
+        if (not receives.empty()) {
+          receive = &receives.front();
+        }
+      }
+      bool progress = false;
+      if (send) {
+        progress |= advance(sends, *send, [this](char *d, size_t s) { return tryWrite(d, s); });
+      }
+      if (receive) {
+        progress |= advance(receives, *receive, [this](char *d, size_t s) { return tryRead(d, s); });
+      }
+      if (not progress) {
+        waitForRing(*ownBell, seen);
+      }
+    }
+  }
+};
+
+SharedMemoryCommunication::SharedMemoryCommunication(std::string const &addressDirectory,
+                                                     size_t             bufferSize)
+    : _addressDirectory(addressDirectory),
+      _bufferSize(bufferSize)
+{
+  if (_addressDirectory.empty()) {
+    _addressDirectory = ".";
+  }
+}
+
+SharedMemoryCommunication::~SharedMemoryCommunication()
+{
+  TRACE(_isConnected);
+  closeConnection();
+}
+
+size_t SharedMemoryCommunication::getRemoteCommunicatorSize()
+{
+  TRACE();
+  assertion(isConnected());
+  return _channels.size();
+}
+
+void SharedMemoryCommunication::acceptConnection(std::string const &acceptorName,
+                                                 std::string const &requesterName,
+                                                 int                acceptorRank)
+{
+  TRACE(acceptorName, requesterName);
+  assertion(not isConnected());
+
+  const std::string addressFileName("." + requesterName + "-" + acceptorName + ".address");
+  acceptChannels(addressFileName, 1, true);
+}
+
+void SharedMemoryCommunication::acceptConnectionAsServer(std::string const &acceptorName,
+                                                         std::string const &requesterName,
+                                                         int                acceptorRank,
+                                                         int                requesterCommunicatorSize)
+{
+  TRACE(acceptorName, requesterName, acceptorRank, requesterCommunicatorSize);
+  CHECK(requesterCommunicatorSize > 0, "Requester communicator size has to be > 0!");
+  assertion(not isConnected());
+
+  const std::string addressFileName("." + requesterName + "-" +
+                                    acceptorName + "-" + std::to_string(acceptorRank) + ".address");
+  acceptChannels(addressFileName, requesterCommunicatorSize, false);
+}
+
+void SharedMemoryCommunication::requestConnection(std::string const &acceptorName,
+                                                  std::string const &requesterName,
+                                                  int                requesterRank,
+                                                  int                requesterCommunicatorSize)
+{
+  TRACE(acceptorName, requesterName);
+  assertion(not isConnected());
+
+  const std::string addressFileName("." + requesterName + "-" + acceptorName + ".address");
+  _channels[0] = requestChannel(addressFileName, requesterRank, requesterCommunicatorSize);
+  _isConnected = true;
+}
+
+void SharedMemoryCommunication::requestConnectionAsClient(std::string const &  acceptorName,
+                                                          std::string const &  requesterName,
+                                                          std::set<int> const &acceptorRanks,
+                                                          int                  requesterRank)
+{
+  TRACE(acceptorName, requesterName, acceptorRanks, requesterRank);
+  assertion(not isConnected());
+
+  for (int acceptorRank : acceptorRanks) {
+    const std::string addressFileName("." + requesterName + "-" +
+                                      acceptorName + "-" + std::to_string(acceptorRank) + ".address");
+    _channels[acceptorRank] = requestChannel(addressFileName, requesterRank, 1);
+  }
+  _isConnected = true;
+}
+
+void SharedMemoryCommunication::closeConnection()
+{
+  TRACE();
+
+  if (not isConnected())
+    return;
+
+  _channels.clear();
+  _isConnected = false;
+}
+
+void SharedMemoryCommunication::acceptChannels(std::string const &addressFileName,
+                                               int                requesterCount,
+                                               bool               countFromRequester)
+{
+  TRACE(addressFileName, requesterCount, countFromRequester);
+
+  const std::string listenerName   = uniqueSegmentName();
+  size_t            listenerLength = sizeof(ListenerHeader);
+  void *            listenerMemory = mapSegment(listenerName, listenerLength, true);
+  CHECK(listenerMemory != MAP_FAILED,
+        "Creating shared memory segment \"" << listenerName << "\" failed: " << std::strerror(errno));
+  auto listener = new (listenerMemory) ListenerHeader();
+
+  Publisher::ScopedChangePrefixDirectory scpd(_addressDirectory);
+  ScopedPublisher                        p(addressFileName);
+  p.write(hostName() + " " + listenerName);
+  DEBUG("Accept connection at " << listenerName);
+
+  for (int connection = 0; connection < requesterCount; connection++) {
+    CHECK(connection < MAX_REQUESTERS,
+          "Shared memory communication supports at most " << MAX_REQUESTERS << " requesters per acceptor!");
+
+    int requesterRank = -1;
+    while (true) {
+      const std::uint32_t seen = listener->bell.counter.load();
+      requesterRank            = listener->requesterRanks[connection].load() - 1;
+      if (requesterRank >= 0) {
+        break;
+      }
+      waitForRing(listener->bell, seen);
+    }
+
+    const std::string channelName   = listenerName + "-" + std::to_string(requesterRank);
+    size_t            channelLength = 0;
+    void *            channelMemory = mapSegment(channelName, channelLength, false);
+    CHECK(channelMemory != MAP_FAILED,
+          "Opening shared memory segment \"" << channelName << "\" failed: " << std::strerror(errno));
+    shm_unlink(channelName.c_str());
+    std::unique_ptr<Channel> channel(new Channel(channelMemory, channelLength, true));
+    DEBUG("Accepted connection of rank " << requesterRank);
+
+    CHECK(_channels.count(requesterRank) == 0,
+          "Duplicate request to connect by same rank (" << requesterRank << ")!");
+    if (countFromRequester) {
+      const int size = channel->header->requesterCommunicatorSize;
+      if (connection == 0) {
+        requesterCount = size;
+      }
+      CHECK(size == requesterCount, "Requester communicator sizes are inconsistent!");
+      CHECK(size > 0, "Requester communicator size has to be > 0!");
+    }
+    _channels[requesterRank] = std::move(channel);
+    _isConnected             = true;
+  }
+
+  munmap(listenerMemory, listenerLength);
+  shm_unlink(listenerName.c_str());
+}
+
+std::unique_ptr<SharedMemoryCommunication::Channel> SharedMemoryCommunication::requestChannel(
+    std::string const &addressFileName,
+    int                requesterRank,
+    int                requesterCommunicatorSize)
+{
+  TRACE(addressFileName, requesterRank, requesterCommunicatorSize);
+
+  std::string address;
+  {
+    Publisher::ScopedChangePrefixDirectory scpd(_addressDirectory);
+    Publisher                              p(addressFileName);
+    address = p.read();
+  }
+  std::string        acceptorHost;
+  std::string        listenerName;
+  std::istringstream iss(address);
+  iss >> acceptorHost >> listenerName;
+  CHECK(acceptorHost == hostName(),
+        "Shared memory communication requires both participants to run on the same host, "
+            << "but the acceptor runs on \"" << acceptorHost << "\" and the requester on \"" << hostName() << "\"!");
+  DEBUG("Request connection to " << listenerName);
+
+  size_t listenerLength = 0;
+  void * listenerMemory = mapSegment(listenerName, listenerLength, false);
+  CHECK(listenerMemory != MAP_FAILED && listenerLength >= sizeof(ListenerHeader),
+        "Opening shared memory segment \"" << listenerName << "\" failed: " << std::strerror(errno));
+  auto listener = static_cast<ListenerHeader *>(listenerMemory);
+
+  const std::string channelName   = listenerName + "-" + std::to_string(requesterRank);
+  size_t            channelLength = sizeof(ChannelHeader) + 2 * _bufferSize;
+  void *            channelMemory = mapSegment(channelName, channelLength, true);
+  CHECK(channelMemory != MAP_FAILED,
+        "Creating shared memory segment \"" << channelName << "\" failed: " << std::strerror(errno));
+  auto header                       = new (channelMemory) ChannelHeader();
+  header->requesterRank             = requesterRank;
+  header->requesterCommunicatorSize = requesterCommunicatorSize;
+  header->capacity                  = _bufferSize;
+  std::unique_ptr<Channel> channel(new Channel(channelMemory, channelLength, false));
+
+  const int ticket = listener->tickets.fetch_add(1);
+  CHECK(ticket < MAX_REQUESTERS,
+        "Shared memory communication supports at most " << MAX_REQUESTERS << " requesters per acceptor!");
+  listener->requesterRanks[ticket].store(requesterRank + 1);
+  ring(listener->bell);
+  munmap(listenerMemory, listenerLength);
+
+  DEBUG("Requested connection to " << listenerName);
+  return channel;
+}
+
+SharedMemoryCommunication::Channel &SharedMemoryCommunication::channel(int remoteRank)
+{
+  remoteRank = remoteRank - _rankOffset;
+
+  assertion(remoteRank >= 0, remoteRank);
+  assertion(isConnected());
+  auto iter = _channels.find(remoteRank);
+  assertion(iter != _channels.end(), remoteRank);
+  return *iter->second;
+}
+
+void SharedMemoryCommunication::sendBytes(const void *data, size_t size, int rankReceiver)
+{
+  channel(rankReceiver).send(static_cast<const char *>(data), size);
+  countSent(rankReceiver - _rankOffset, size);
+}
+
+void SharedMemoryCommunication::receiveBytes(void *data, size_t size, int rankSender)
+{
+  const auto start = utils::Event::Clock::now();
+  channel(rankSender).receive(static_cast<char *>(data), size);
+  countReceived(rankSender - _rankOffset, size, start);
+}
+
+PtrRequest SharedMemoryCommunication::aSendBytes(const void *data, size_t size, int rankReceiver)
+{
+  return countSent(rankReceiver - _rankOffset, size, channel(rankReceiver).aSend(static_cast<const char *>(data), size));
+}
+
+PtrRequest SharedMemoryCommunication::aReceiveBytes(void *data, size_t size, int rankSender)
+{
+  return countReceived(rankSender - _rankOffset, size, channel(rankSender).aReceive(static_cast<char *>(data), size));
+}
+
+void SharedMemoryCommunication::send(std::string const &itemToSend, int rankReceiver)
+{
+  TRACE(itemToSend, rankReceiver);
+  size_t size = itemToSend.size() + 1;
+  sendBytes(&size, sizeof(size_t), rankReceiver);
+  sendBytes(itemToSend.c_str(), size, rankReceiver);
+}
+
+void SharedMemoryCommunication::send(const int *itemsToSend, int size, int rankReceiver)
+{
+  TRACE(size, rankReceiver);
+  sendBytes(itemsToSend, size * sizeof(int), rankReceiver);
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const int *itemsToSend, int size, int rankReceiver)
+{
+  TRACE(size, rankReceiver);
+  return aSendBytes(itemsToSend, size * sizeof(int), rankReceiver);
+}
+
+void SharedMemoryCommunication::send(const double *itemsToSend, int size, int rankReceiver)
+{
+  TRACE(size, rankReceiver);
+  sendBytes(itemsToSend, size * sizeof(double), rankReceiver);
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const double *itemsToSend, int size, int rankReceiver)
+{
+  TRACE(size, rankReceiver);
+  return aSendBytes(itemsToSend, size * sizeof(double), rankReceiver);
+}
+
+PtrRequest SharedMemoryCommunication::aSend(std::vector<double> const &itemsToSend, int rankReceiver)
+{
+  TRACE(rankReceiver);
+  return aSendBytes(itemsToSend.data(), itemsToSend.size() * sizeof(double), rankReceiver);
+}
+
+void SharedMemoryCommunication::send(double itemToSend, int rankReceiver)
+{
+  TRACE(itemToSend, rankReceiver);
+  sendBytes(&itemToSend, sizeof(double), rankReceiver);
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const double &itemToSend, int rankReceiver)
+{
+  return aSend(&itemToSend, 1, rankReceiver);
+}
+
+void SharedMemoryCommunication::send(int itemToSend, int rankReceiver)
+{
+  TRACE(itemToSend, rankReceiver);
+  sendBytes(&itemToSend, sizeof(int), rankReceiver);
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const int &itemToSend, int rankReceiver)
+{
+  return aSend(&itemToSend, 1, rankReceiver);
+}
+
+void SharedMemoryCommunication::send(bool itemToSend, int rankReceiver)
+{
+  TRACE(itemToSend, rankReceiver);
+  sendBytes(&itemToSend, sizeof(bool), rankReceiver);
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const bool &itemToSend, int rankReceiver)
+{
+  TRACE(rankReceiver);
+  return aSendBytes(&itemToSend, sizeof(bool), rankReceiver);
+}
+
+void SharedMemoryCommunication::receive(std::string &itemToReceive, int rankSender)
+{
+  TRACE(rankSender);
+  size_t size = 0;
+  receiveBytes(&size, sizeof(size_t), rankSender);
+  std::vector<char> msg(size);
+  receiveBytes(msg.data(), size, rankSender);
+  itemToReceive = msg.data();
+}
+
+void SharedMemoryCommunication::receive(int *itemsToReceive, int size, int rankSender)
+{
+  TRACE(size, rankSender);
+  receiveBytes(itemsToReceive, size * sizeof(int), rankSender);
+}
+
+void SharedMemoryCommunication::receive(double *itemsToReceive, int size, int rankSender)
+{
+  TRACE(size, rankSender);
+  receiveBytes(itemsToReceive, size * sizeof(double), rankSender);
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(double *itemsToReceive,
+                                               int     size,
+                                               int     rankSender)
+{
+  TRACE(size, rankSender);
+  return aReceiveBytes(itemsToReceive, size * sizeof(double), rankSender);
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(std::vector<double> &itemsToReceive, int rankSender)
+{
+  TRACE(rankSender);
+  return aReceiveBytes(itemsToReceive.data(), itemsToReceive.size() * sizeof(double), rankSender);
+}
+
+void SharedMemoryCommunication::receive(double &itemToReceive, int rankSender)
+{
+  TRACE(rankSender);
+  receiveBytes(&itemToReceive, sizeof(double), rankSender);
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(double &itemToReceive, int rankSender)
+{
+  return aReceive(&itemToReceive, 1, rankSender);
+}
+
+void SharedMemoryCommunication::receive(int &itemToReceive, int rankSender)
+{
+  TRACE(rankSender);
+  receiveBytes(&itemToReceive, sizeof(int), rankSender);
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(int &itemToReceive, int rankSender)
+{
+  TRACE(rankSender);
+  return aReceiveBytes(&itemToReceive, sizeof(int), rankSender);
+}
+
+void SharedMemoryCommunication::receive(bool &itemToReceive, int rankSender)
+{
+  TRACE(rankSender);
+  receiveBytes(&itemToReceive, sizeof(bool), rankSender);
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(bool &itemToReceive, int rankSender)
+{
+  TRACE(rankSender);
+  return aReceiveBytes(&itemToReceive, sizeof(bool), rankSender);
+}
+
+void SharedMemoryCommunication::send(std::vector<int> const &v, int rankReceiver)
+{
+  TRACE(rankReceiver);
+  size_t size = v.size();
+  sendBytes(&size, sizeof(size_t), rankReceiver);
+  sendBytes(v.data(), size * sizeof(int), rankReceiver);
+}
+
+void SharedMemoryCommunication::receive(std::vector<int> &v, int rankSender)
+{
+  TRACE(rankSender);
+  size_t size = 0;
+  receiveBytes(&size, sizeof(size_t), rankSender);
+  v.resize(size);
+  receiveBytes(v.data(), size * sizeof(int), rankSender);
+}
+
+void SharedMemoryCommunication::send(std::vector<double> const &v, int rankReceiver)
+{
+  TRACE(rankReceiver);
+  size_t size = v.size();
+  sendBytes(&size, sizeof(size_t), rankReceiver);
+  sendBytes(v.data(), size * sizeof(double), rankReceiver);
+}
+
+void SharedMemoryCommunication::receive(std::vector<double> &v, int rankSender)
+{
+  TRACE(rankSender);
+  size_t size = 0;
+  receiveBytes(&size, sizeof(size_t), rankSender);
+  v.resize(size);
+  receiveBytes(v.data(), size * sizeof(double), rankSender);
+}
+
+} // namespace com
+} // namespace precice
+
+#endif // not PRECICE_NO_SHARED_MEMORY
@@ -0,0 +1,170 @@
+#ifndef PRECICE_NO_SHARED_MEMORY
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include "com/Communication.hpp"
+#include "logging/Logger.hpp"
+
+namespace precice
+{
+namespace com
+{
+/**
+ * @brief Implements Communication by ring buffers in POSIX shared memory.
+ *
+ * Both sides of a connection have to run on the same host. Every connected pair of ranks
+ * shares one memory segment holding a ring buffer per direction. A process blocked on a full or
+ * empty ring buffer first polls and then sleeps on a futex, which is woken by the peer.
+ *
+ * The connection is established by a listener segment of the acceptor, whose name is exchanged
+ * by file like for the SocketCommunication. Asynchronous transfers are processed in order by a
+ * worker thread per connection.
+ */
+class SharedMemoryCommunication : public Communication
+{
+public:
+  /// Default capacity of each ring buffer in bytes.
+  static const size_t DEFAULT_BUFFER_SIZE;
+
+  explicit SharedMemoryCommunication(std::string const &addressDirectory = ".",
+                                     size_t             bufferSize       = DEFAULT_BUFFER_SIZE);
+
+  virtual ~SharedMemoryCommunication();
+
+  virtual size_t getRemoteCommunicatorSize() override;
+
+  virtual void acceptConnection(std::string const &acceptorName,
+                                std::string const &requesterName,
+                                int                acceptorRank) override;
+
+  virtual void acceptConnectionAsServer(std::string const &acceptorName,
+                                        std::string const &requesterName,
+                                        int                acceptorRank,
+                                        int                requesterCommunicatorSize) override;
+
+  virtual void requestConnection(std::string const &acceptorName,
+                                 std::string const &requesterName,
+                                 int                requesterRank,
+                                 int                requesterCommunicatorSize) override;
+
+  virtual void requestConnectionAsClient(std::string const &  acceptorName,
+                                         std::string const &  requesterName,
+                                         std::set<int> const &acceptorRanks,
+                                         int                  requesterRank) override;
+
+  virtual void closeConnection() override;
+
+  /// Sends a std::string to process with given rank.
+  virtual void send(std::string const &itemToSend, int rankReceiver) override;
+
+  /// Sends an array of integer values.
+  virtual void send(const int *itemsToSend, int size, int rankReceiver) override;
+
+  /// Asynchronously sends an array of integer values.
+  virtual PtrRequest aSend(const int *itemsToSend, int size, int rankReceiver) override;
+
+  /// Sends an array of double values.
+  virtual void send(const double *itemsToSend, int size, int rankReceiver) override;
+
+  /// Asynchronously sends an array of double values.
+  virtual PtrRequest aSend(const double *itemsToSend, int size, int rankReceiver) override;
+
+  virtual PtrRequest aSend(std::vector<double> const &itemsToSend, int rankReceiver) override;
+
+  /// Sends a double to process with given rank.
+  virtual void send(double itemToSend, int rankReceiver) override;
+
+  /// Asynchronously sends a double to process with given rank.
+  virtual PtrRequest aSend(const double &itemToSend, int rankReceiver) override;
+
+  /// Sends an int to process with given rank.
+  virtual void send(int itemToSend, int rankReceiver) override;
+
+  /// Asynchronously sends an int to process with given rank.
+  virtual PtrRequest aSend(const int &itemToSend, int rankReceiver) override;
+
+  /// Sends a bool to process with given rank.
+  virtual void send(bool itemToSend, int rankReceiver) override;
+
+  /// Asynchronously sends a bool to process with given rank.
+  virtual PtrRequest aSend(const bool &itemToSend, int rankReceiver) override;
+
+  /// Receives a std::string from process with given rank.
+  virtual void receive(std::string &itemToReceive, int rankSender) override;
+
+  /// Receives an array of integer values.
+  virtual void receive(int *itemsToReceive, int size, int rankSender) override;
+
+  /// Receives an array of double values.
+  virtual void receive(double *itemsToReceive, int size, int rankSender) override;
+
+  /// Asynchronously receives an array of double values.
+  virtual PtrRequest aReceive(double *itemsToReceive,
+                              int     size,
+                              int     rankSender) override;
+
+  virtual PtrRequest aReceive(std::vector<double> &itemsToReceive, int rankSender) override;
+
+  /// Receives a double from process with given rank.
+  virtual void receive(double &itemToReceive, int rankSender) override;
+
+  /// Asynchronously receives a double from process with given rank.
+  virtual PtrRequest aReceive(double &itemToReceive, int rankSender) override;
+
+  /// Receives an int from process with given rank.
+  virtual void receive(int &itemToReceive, int rankSender) override;
+
+  /// Asynchronously receives an int from process with given rank.
+  virtual PtrRequest aReceive(int &itemToReceive, int rankSender) override;
+
+  /// Receives a bool from process with given rank.
+  virtual void receive(bool &itemToReceive, int rankSender) override;
+
+  /// Asynchronously receives a bool from process with given rank.
+  virtual PtrRequest aReceive(bool &itemToReceive, int rankSender) override;
+
+  void send(std::vector<int> const &v, int rankReceiver) override;
+  void receive(std::vector<int> &v, int rankSender) override;
+
+  void send(std::vector<double> const &v, int rankReceiver) override;
+  void receive(std::vector<double> &v, int rankSender) override;
+
+private:
+  logging::Logger _log{"com::SharedMemoryCommunication"};
+
+  /// Mapped segment and transfer queues of the connection to one remote rank.
+  struct Channel;
+
+  /// Directory where the name of the listener segment is exchanged by file.
+  std::string _addressDirectory;
+
+  /// Capacity of each ring buffer created by this communication in bytes.
+  size_t _bufferSize;
+
+  /// Remote rank -> channel map
+  std::map<int, std::unique_ptr<Channel>> _channels;
+
+  /// Creates a listener segment, publishes its name and accepts requesterCount connections.
+  void acceptChannels(std::string const &addressFileName, int requesterCount, bool countFromRequester);
+
+  /// Creates a channel segment and registers it at the listener published in the given file.
+  std::unique_ptr<Channel> requestChannel(std::string const &addressFileName,
+                                          int                requesterRank,
+                                          int                requesterCommunicatorSize);
+
+  Channel &channel(int remoteRank);
+
+  void sendBytes(const void *data, size_t size, int rankReceiver);
+
+  void receiveBytes(void *data, size_t size, int rankSender);
+
+  PtrRequest aSendBytes(const void *data, size_t size, int rankReceiver);
+
+  PtrRequest aReceiveBytes(void *data, size_t size, int rankSender);
+};
+} // namespace com
+} // namespace precice
+
+#endif // not PRECICE_NO_SHARED_MEMORY
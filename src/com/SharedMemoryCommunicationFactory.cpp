@@ -0,0 +1,41 @@
+#ifndef PRECICE_NO_SHARED_MEMORY
+
+#include "SharedMemoryCommunication.hpp"
+
+#include "SharedMemoryCommunicationFactory.hpp"
+#include "com/SharedPointer.hpp"
+
+namespace precice
+{
+namespace com
+{
+SharedMemoryCommunicationFactory::SharedMemoryCommunicationFactory(
+    std::string const &addressDirectory,
+    size_t             bufferSize)
+    : _addressDirectory(addressDirectory),
+      _bufferSize(bufferSize)
+{
+  if (_addressDirectory.empty()) {
+    _addressDirectory = ".";
+  }
+}
+
+SharedMemoryCommunicationFactory::SharedMemoryCommunicationFactory(
+    std::string const &addressDirectory)
+    : SharedMemoryCommunicationFactory(addressDirectory, SharedMemoryCommunication::DEFAULT_BUFFER_SIZE)
+{
+}
+
+PtrCommunication SharedMemoryCommunicationFactory::newCommunication()
+{
+  return std::make_shared<SharedMemoryCommunication>(_addressDirectory, _bufferSize);
+}
+
+std::string SharedMemoryCommunicationFactory::addressDirectory()
+{
+  return _addressDirectory;
+}
+} // namespace com
+} // namespace precice
+
+#endif // not PRECICE_NO_SHARED_MEMORY
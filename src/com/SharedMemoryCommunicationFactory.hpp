@@ -0,0 +1,33 @@
+#ifndef PRECICE_NO_SHARED_MEMORY
+
+#pragma once
+
+#include "CommunicationFactory.hpp"
+#include "com/SharedPointer.hpp"
+
+#include <string>
+
+namespace precice
+{
+namespace com
+{
+class SharedMemoryCommunicationFactory : public CommunicationFactory
+{
+public:
+  SharedMemoryCommunicationFactory(std::string const &addressDirectory,
+                                   size_t             bufferSize);
+
+  explicit SharedMemoryCommunicationFactory(std::string const &addressDirectory = ".");
+
+  PtrCommunication newCommunication() override;
+
+  std::string addressDirectory() override;
+
+private:
+  std::string _addressDirectory;
+  size_t      _bufferSize;
+};
+} // namespace com
+} // namespace precice
+
+#endif // not PRECICE_NO_SHARED_MEMORY
@@ -0,0 +1,46 @@
+#ifndef PRECICE_NO_SHARED_MEMORY
+
+#include "SharedMemoryRequest.hpp"
+
+namespace precice
+{
+namespace com
+{
+SharedMemoryRequest::SharedMemoryRequest()
+    : _complete(false)
+{
+}
+
+void SharedMemoryRequest::complete()
+{
+  {
+    std::lock_guard<std::mutex> lock(_completeMutex);
+
+    _complete = true;
+  }
+
+  _completeCondition.notify_one();
+  notifyCompletion();
+}
+
+bool SharedMemoryRequest::test()
+{
+  std::lock_guard<std::mutex> lock(_completeMutex);
+
+  return _complete;
+}
+
+void SharedMemoryRequest::wait()
+{
+  const auto start = utils::Event::Clock::now();
+  {
+    std::unique_lock<std::mutex> lock(_completeMutex);
+
+    _completeCondition.wait(lock, [this] { return _complete; });
+  }
+  countWait(start);
+}
+} // namespace com
+} // namespace precice
+
+#endif // not PRECICE_NO_SHARED_MEMORY
@@ -0,0 +1,39 @@
+#pragma once
+#ifndef PRECICE_NO_SHARED_MEMORY
+
+#include "Request.hpp"
+
+#include <condition_variable>
+#include <mutex>
+
+namespace precice
+{
+namespace com
+{
+/// Request of an asynchronous transfer, which is completed by the worker thread of a SharedMemoryCommunication.
+class SharedMemoryRequest : public Request
+{
+public:
+  SharedMemoryRequest();
+
+  void complete();
+
+  bool test() override;
+
+  void wait() override;
+
+private:
+  bool notifiesCompletion() const override
+  {
+    return true;
+  }
+
+  bool _complete;
+
+  std::condition_variable _completeCondition;
+  std::mutex              _completeMutex;
+};
+} // namespace com
+} // namespace precice
+
+#endif // not PRECICE_NO_SHARED_MEMORY
@@ -7,6 +7,7 @@
 #include "utils/Publisher.hpp"
 #include "utils/assertion.hpp"
 
+#include <memory>
 #include <sstream>
 
 using precice::utils::Publisher;
@@ -103,7 +104,7 @@ void SocketCommunication::acceptConnection(std::string const &acceptorName,
       CHECK(_sockets.count(requesterRank) == 0,
             "Duplicate request to connect by same rank (" << requesterRank << ")!");
       
-      _sockets[requesterRank] = socket;
+      addSocket(requesterRank, socket);
       send(acceptorRank, requesterRank);
       receive(requesterCommunicatorSize, requesterRank);
 
@@ -138,51 +139,37 @@ void SocketCommunication::acceptConnectionAsServer(std::string const &acceptorNa
   CHECK(requesterCommunicatorSize > 0, "Requester communicator size has to be > 0!");
   assertion(not isConnected());
 
-  std::string address;
   const std::string addressFileName("." + requesterName + "-" +
                                     acceptorName + "-" + std::to_string(acceptorRank) + ".address");
 
-  try {
-    std::string ipAddress = getIpAddress();
-
-    CHECK(not ipAddress.empty(), "Network \"" << _networkName << "\" not found for socket connection!");
-
-    using asio::ip::tcp;
-
-    tcp::acceptor acceptor(*_ioService);
-    {
-      tcp::endpoint endpoint(tcp::v4(), _portNumber);
-
-      acceptor.open(endpoint.protocol());
-      acceptor.set_option(tcp::acceptor::reuse_address(_reuseAddress));
-      acceptor.bind(endpoint);
-      acceptor.listen();
-
-      _portNumber = acceptor.local_endpoint().port();
-    }
-
-    address = ipAddress + ":" + std::to_string(_portNumber);
+  // Publish the address by file, unless it has been handed to the requesters otherwise
+  std::unique_ptr<ScopedPublisher> publisher;
+  if (not _acceptor) {
+    prepareConnectionAsServer();
 
     Publisher::ScopedChangePrefixDirectory scpd(_addressDirectory);
-    ScopedPublisher p(addressFileName);
-    p.write(address);
+    publisher.reset(new ScopedPublisher(addressFileName));
+    publisher->write(_acceptorAddress);
+  }
 
-    DEBUG("Accepting connection at " << address);
+  try {
+    DEBUG("Accepting connection at " << _acceptorAddress);
 
     for (int connection = 0; connection < requesterCommunicatorSize; ++connection) {
       auto socket = std::make_shared<Socket>(*_ioService);
-      acceptor.accept(*socket);
-      DEBUG("Accepted connection at " << address);
+      _acceptor->accept(*socket);
+      DEBUG("Accepted connection at " << _acceptorAddress);
       _isConnected = true;
 
       int requesterRank;
       asio::read(*socket, asio::buffer(&requesterRank, sizeof(int)));
-      _sockets[requesterRank] = socket;
+      addSocket(requesterRank, socket);
     }
 
-    acceptor.close();
+    _acceptor->close();
+    _acceptor.reset();
   } catch (std::exception &e) {
-    ERROR("Accepting connection at " << address << " failed: " << e.what());
+    ERROR("Accepting connection at " << _acceptorAddress << " failed: " << e.what());
   }
 
   // NOTE:
@@ -191,6 +178,35 @@ void SocketCommunication::acceptConnectionAsServer(std::string const &acceptorNa
   _thread = std::thread([this]() { _ioService->run(); });  
 }
 
+std::string SocketCommunication::prepareConnectionAsServer()
+{
+  TRACE();
+  assertion(not isConnected());
+  assertion(not _acceptor);
+
+  try {
+    std::string ipAddress = getIpAddress();
+
+    CHECK(not ipAddress.empty(), "Network \"" << _networkName << "\" not found for socket connection!");
+
+    using asio::ip::tcp;
+
+    _acceptor = std::make_shared<tcp::acceptor>(*_ioService);
+    tcp::endpoint endpoint(tcp::v4(), _portNumber);
+
+    _acceptor->open(endpoint.protocol());
+    _acceptor->set_option(tcp::acceptor::reuse_address(_reuseAddress));
+    _acceptor->bind(endpoint);
+    _acceptor->listen();
+
+    _portNumber      = _acceptor->local_endpoint().port();
+    _acceptorAddress = ipAddress + ":" + std::to_string(_portNumber);
+  } catch (std::exception &e) {
+    ERROR("Opening a server socket at port " << _portNumber << " failed: " << e.what());
+  }
+  return _acceptorAddress;
+}
+
 void SocketCommunication::requestConnection(std::string const &acceptorName,
                                             std::string const &requesterName,
                                             int                requesterRank,
@@ -242,7 +258,7 @@ void SocketCommunication::requestConnection(std::string const &acceptorName,
     
     int acceptorRank = -1;
     asio::read(*socket, asio::buffer(&acceptorRank, sizeof(int)));
-    _sockets[0] = socket; // should be acceptorRank instead of 0, likewise all communication below
+    addSocket(0, socket); // should be acceptorRank instead of 0, likewise all communication below
     
     send(requesterCommunicatorSize, 0);
 
@@ -266,57 +282,78 @@ void SocketCommunication::requestConnectionAsClient(std::string      const &acce
   assertion(not isConnected());
   
   for (auto const & acceptorRank : acceptorRanks) {
-    _isConnected = false;
-    std::string address;
     const std::string addressFileName("." + requesterName + "-" +
                                       acceptorName + "-" + std::to_string(acceptorRank) + ".address");
-
-    try {
+    std::string address;
+    {
       Publisher::ScopedChangePrefixDirectory scpd(_addressDirectory);
       Publisher p(addressFileName);
       address = p.read();
-      
-      std::string ipAddress  = address.substr(0, address.find(":"));
-      std::string portNumber = address.substr(ipAddress.length()+1, address.length() - ipAddress.length()-1);
+    }
+    connectAsClient(address, acceptorRank, requesterRank);
+  }
+  // NOTE:
+  // Keep IO service running so that it fires asynchronous handlers from another thread.
+  _work   = std::make_shared<asio::io_service::work>(*_ioService);
+  _thread = std::thread([this]() { _ioService->run(); });
+}
 
-      _portNumber = static_cast<unsigned short>(std::stoi(portNumber));
+void SocketCommunication::requestConnectionAtAddresses(std::map<int, std::string> const &acceptorAddresses,
+                                                       int                               requesterRank)
+{
+  TRACE(acceptorAddresses.size(), requesterRank);
+  assertion(not isConnected());
 
-      auto socket = std::make_shared<Socket>(*_ioService);
+  for (auto const &acceptorAddress : acceptorAddresses) {
+    connectAsClient(acceptorAddress.second, acceptorAddress.first, requesterRank);
+  }
+  // NOTE:
+  // Keep IO service running so that it fires asynchronous handlers from another thread.
+  _work   = std::make_shared<asio::io_service::work>(*_ioService);
+  _thread = std::thread([this]() { _ioService->run(); });
+}
 
-      using asio::ip::tcp;
+void SocketCommunication::connectAsClient(std::string const &address, int acceptorRank, int requesterRank)
+{
+  _isConnected = false;
 
-      DEBUG("Requesting connection to " << ipAddress << ", port " << portNumber);
+  try {
+    std::string ipAddress  = address.substr(0, address.find(":"));
+    std::string portNumber = address.substr(ipAddress.length()+1, address.length() - ipAddress.length()-1);
 
-      tcp::resolver::query query(tcp::v4(), ipAddress, portNumber);
+    _portNumber = static_cast<unsigned short>(std::stoi(portNumber));
 
-      while (not isConnected()) {
-        tcp::resolver resolver(*_ioService);
-        tcp::resolver::iterator endpoint_iterator = resolver.resolve(query);
-        boost::system::error_code error = asio::error::host_not_found;
-        boost::asio::connect(*socket, endpoint_iterator, error);
-          
-        _isConnected = not error;
+    auto socket = std::make_shared<Socket>(*_ioService);
 
-        if (not isConnected()) {
-          // Wait a little, since after a couple of ten-thousand trials the system
-          // seems to get confused and the requester connects wrongly to itself.
-          boost::asio::deadline_timer timer(*_ioService, boost::posix_time::milliseconds(1));
-          timer.wait();
-        }
-      }
-      
-      DEBUG("Requested connection to " << address << ", rank = " << acceptorRank);
-      _sockets[acceptorRank] = socket;
-      send(requesterRank, acceptorRank); // send my rank
+    using asio::ip::tcp;
+
+    DEBUG("Requesting connection to " << ipAddress << ", port " << portNumber);
+
+    tcp::resolver::query query(tcp::v4(), ipAddress, portNumber);
+
+    while (not isConnected()) {
+      tcp::resolver resolver(*_ioService);
+      tcp::resolver::iterator endpoint_iterator = resolver.resolve(query);
+      boost::system::error_code error = asio::error::host_not_found;
+      boost::asio::connect(*socket, endpoint_iterator, error);
+        
+      _isConnected = not error;
 
-    } catch (std::exception &e) {
-      ERROR("Requesting connection to " << address << " failed: " << e.what());
+      if (not isConnected()) {
+        // Wait a little, since after a couple of ten-thousand trials the system
+        // seems to get confused and the requester connects wrongly to itself.
+        boost::asio::deadline_timer timer(*_ioService, boost::posix_time::milliseconds(1));
+        timer.wait();
+      }
     }
+    
+    DEBUG("Requested connection to " << address << ", rank = " << acceptorRank);
+    addSocket(acceptorRank, socket);
+    send(requesterRank, acceptorRank); // send my rank
+
+  } catch (std::exception &e) {
+    ERROR("Requesting connection to " << address << " failed: " << e.what());
   }
-  // NOTE:
-  // Keep IO service running so that it fires asynchronous handlers from another thread.
-  _work   = std::make_shared<asio::io_service::work>(*_ioService);
-  _thread = std::thread([this]() { _ioService->run(); });
 }
 
 void SocketCommunication::closeConnection()
@@ -341,6 +378,41 @@ void SocketCommunication::closeConnection()
   _isConnected            = false;
 }
 
+void SocketCommunication::addSocket(int remoteRank, std::shared_ptr<Socket> socket)
+{
+  _sockets[remoteRank]    = socket;
+  _sendQueues[remoteRank] = std::make_shared<SocketSendQueue>(*socket);
+}
+
+void SocketCommunication::sendBuffer(int rankReceiver, asio::const_buffer data)
+{
+  SocketSendQueue &queue = *_sendQueues[rankReceiver];
+  if (queue.isBusy()) {
+    // Enqueue behind the pending asynchronous writes to keep the order of messages.
+    // The request is shared, since the IO thread may still use it after wait() returned.
+    auto request = std::make_shared<SocketRequest>();
+    auto result  = std::make_shared<boost::system::error_code>();
+    queue.dispatch(data, [request, result](boost::system::error_code const &error) {
+      *result = error;
+      request->complete();
+    });
+    request->wait();
+    if (*result) {
+      throw boost::system::system_error(*result);
+    }
+  } else {
+    asio::write(*_sockets[rankReceiver], asio::buffer(data));
+  }
+  countSent(rankReceiver, asio::buffer_size(data));
+}
+
+void SocketCommunication::receiveBuffer(int rankSender, asio::mutable_buffer data)
+{
+  const auto start = utils::Event::Clock::now();
+  asio::read(*_sockets[rankSender], asio::buffer(data));
+  countReceived(rankSender, asio::buffer_size(data), start);
+}
+
 void SocketCommunication::send(std::string const &itemToSend, int rankReceiver)
 {
   TRACE(itemToSend, rankReceiver);
@@ -352,8 +424,8 @@ void SocketCommunication::send(std::string const &itemToSend, int rankReceiver)
 
   size_t size = itemToSend.size() + 1;
   try {
-    asio::write(*_sockets[rankReceiver], asio::buffer(&size, sizeof(size_t)));
-    asio::write(*_sockets[rankReceiver], asio::buffer(itemToSend.c_str(), size));
+    sendBuffer(rankReceiver, asio::buffer(&size, sizeof(size_t)));
+    sendBuffer(rankReceiver, asio::buffer(itemToSend.c_str(), size));
   } catch (std::exception &e) {
     ERROR("Send failed: " << e.what());
   }
@@ -369,7 +441,7 @@ void SocketCommunication::send(const int *itemsToSend, int size, int rankReceive
   assertion(isConnected());
 
   try {
-    asio::write(*_sockets[rankReceiver], asio::buffer(itemsToSend, size * sizeof(int)));
+    sendBuffer(rankReceiver, asio::buffer(itemsToSend, size * sizeof(int)));
   } catch (std::exception &e) {
     ERROR("Send failed: " << e.what());
   }
@@ -386,17 +458,11 @@ PtrRequest SocketCommunication::aSend(const int *itemsToSend, int size, int rank
 
   PtrRequest request(new SocketRequest);
 
-  try {
-    asio::async_write(*_sockets[rankReceiver],
-                      asio::buffer(itemsToSend, size * sizeof(int)),
-                      [request](boost::system::error_code const &, std::size_t) {
-                        std::static_pointer_cast<SocketRequest>(request)->complete();
-                      });
-  } catch (std::exception &e) {
-    ERROR("Send failed: " << e.what());
-  }
+  _sendQueues[rankReceiver]->dispatch(asio::buffer(itemsToSend, size * sizeof(int)), [request](boost::system::error_code const &error) {
+    std::static_pointer_cast<SocketRequest>(request)->complete(error);
+  });
 
-  return request;
+  return countSent(rankReceiver, size * sizeof(int), request);
 }
 
 void SocketCommunication::send(const double *itemsToSend, int size, int rankReceiver)
@@ -409,7 +475,7 @@ void SocketCommunication::send(const double *itemsToSend, int size, int rankRece
   assertion(isConnected());
 
   try {
-    asio::write(*_sockets[rankReceiver], asio::buffer(itemsToSend, size * sizeof(double)));
+    sendBuffer(rankReceiver, asio::buffer(itemsToSend, size * sizeof(double)));
   } catch (std::exception &e) {
     ERROR("Send failed: " << e.what());
   }
@@ -426,17 +492,11 @@ PtrRequest SocketCommunication::aSend(const double *itemsToSend, int size, int r
 
   PtrRequest request(new SocketRequest);
 
-  try {
-    asio::async_write(*_sockets[rankReceiver],
-                      asio::buffer(itemsToSend, size * sizeof(double)),
-                      [request](boost::system::error_code const &, std::size_t) {
-                        std::static_pointer_cast<SocketRequest>(request)->complete();
-                      });
-  } catch (std::exception &e) {
-    ERROR("Send failed: " << e.what());
-  }
+  _sendQueues[rankReceiver]->dispatch(asio::buffer(itemsToSend, size * sizeof(double)), [request](boost::system::error_code const &error) {
+    std::static_pointer_cast<SocketRequest>(request)->complete(error);
+  });
 
-  return request;
+  return countSent(rankReceiver, size * sizeof(double), request);
 }
 
 PtrRequest SocketCommunication::aSend(std::vector<double> const & itemsToSend, int rankReceiver)
@@ -450,17 +510,11 @@ PtrRequest SocketCommunication::aSend(std::vector<double> const & itemsToSend, i
 
   PtrRequest request(new SocketRequest);
 
-  try {
-    asio::async_write(*_sockets[rankReceiver],
-                      asio::buffer(itemsToSend),
-                      [request](boost::system::error_code const &, std::size_t) {
-                        std::static_pointer_cast<SocketRequest>(request)->complete();
-                      });
-  } catch (std::exception &e) {
-    ERROR("Send failed: " << e.what());
-  }
+  _sendQueues[rankReceiver]->dispatch(asio::buffer(itemsToSend), [request](boost::system::error_code const &error) {
+    std::static_pointer_cast<SocketRequest>(request)->complete(error);
+  });
 
-  return request;
+  return countSent(rankReceiver, itemsToSend.size() * sizeof(double), request);
 }
 
 
@@ -474,7 +528,7 @@ void SocketCommunication::send(double itemToSend, int rankReceiver)
   assertion(isConnected());
 
   try {
-    asio::write(*_sockets[rankReceiver], asio::buffer(&itemToSend, sizeof(double)));
+    sendBuffer(rankReceiver, asio::buffer(&itemToSend, sizeof(double)));
   } catch (std::exception &e) {
     ERROR("Send failed: " << e.what());
   }
@@ -495,7 +549,7 @@ void SocketCommunication::send(int itemToSend, int rankReceiver)
   assertion(isConnected());
 
   try {
-    asio::write(*_sockets[rankReceiver], asio::buffer(&itemToSend, sizeof(int)));
+    sendBuffer(rankReceiver, asio::buffer(&itemToSend, sizeof(int)));
   } catch (std::exception &e) {
     ERROR("Send failed: " << e.what());
   }
@@ -516,7 +570,7 @@ void SocketCommunication::send(bool itemToSend, int rankReceiver)
   assertion(isConnected());
 
   try {
-    asio::write(*_sockets[rankReceiver], asio::buffer(&itemToSend, sizeof(bool)));
+    sendBuffer(rankReceiver, asio::buffer(&itemToSend, sizeof(bool)));
   } catch (std::exception &e) {
     ERROR("Send failed: " << e.what());
   }
@@ -533,17 +587,11 @@ PtrRequest SocketCommunication::aSend(const bool & itemToSend, int rankReceiver)
 
   PtrRequest request(new SocketRequest);
 
-  try {
-    asio::async_write(*_sockets[rankReceiver],
-                      asio::buffer(&itemToSend, sizeof(bool)),
-                      [request](boost::system::error_code const &, std::size_t) {
-                        std::static_pointer_cast<SocketRequest>(request)->complete();
-                      });
-  } catch (std::exception &e) {
-    ERROR("Send failed: " << e.what());
-  }
+  _sendQueues[rankReceiver]->dispatch(asio::buffer(&itemToSend, sizeof(bool)), [request](boost::system::error_code const &error) {
+    std::static_pointer_cast<SocketRequest>(request)->complete(error);
+  });
 
-  return request;
+  return countSent(rankReceiver, sizeof(bool), request);
 }
 
 void SocketCommunication::receive(std::string &itemToReceive, int rankSender)
@@ -558,9 +606,9 @@ void SocketCommunication::receive(std::string &itemToReceive, int rankSender)
   size_t size = 0;
 
   try {
-    asio::read(*_sockets[rankSender], asio::buffer(&size, sizeof(size_t)));
+    receiveBuffer(rankSender, asio::buffer(&size, sizeof(size_t)));
     char msg[size];
-    asio::read(*_sockets[rankSender], asio::buffer(msg, size));
+    receiveBuffer(rankSender, asio::buffer(msg, size));
     itemToReceive = msg;
   } catch (std::exception &e) {
     ERROR("Receive failed: " << e.what());
@@ -577,7 +625,7 @@ void SocketCommunication::receive(int *itemsToReceive, int size, int rankSender)
   assertion(isConnected());
 
   try {
-    asio::read(*_sockets[rankSender], asio::buffer(itemsToReceive, size * sizeof(int)));
+    receiveBuffer(rankSender, asio::buffer(itemsToReceive, size * sizeof(int)));
   } catch (std::exception &e) {
     ERROR("Receive failed: " << e.what());
   }
@@ -593,7 +641,7 @@ void SocketCommunication::receive(double *itemsToReceive, int size, int rankSend
   assertion(isConnected());
 
   try {
-    asio::read(*_sockets[rankSender], asio::buffer(itemsToReceive, size * sizeof(double)));
+    receiveBuffer(rankSender, asio::buffer(itemsToReceive, size * sizeof(double)));
   } catch (std::exception &e) {
     ERROR("Receive failed: " << e.what());
   }
@@ -615,14 +663,14 @@ PtrRequest SocketCommunication::aReceive(double *itemsToReceive,
   try {
     asio::async_read(*_sockets[rankSender],
                      asio::buffer(itemsToReceive, size * sizeof(double)),
-                     [request](boost::system::error_code const &, std::size_t) {
-                       std::static_pointer_cast<SocketRequest>(request)->complete();
+                     [request](boost::system::error_code const &error, std::size_t) {
+                       std::static_pointer_cast<SocketRequest>(request)->complete(error);
                      });
   } catch (std::exception &e) {
     ERROR("Receive failed: " << e.what());
   }
 
-  return request;
+  return countReceived(rankSender, size * sizeof(double), request);
 }
 
 PtrRequest SocketCommunication::aReceive(std::vector<double> & itemsToReceive, int rankSender)
@@ -639,14 +687,14 @@ PtrRequest SocketCommunication::aReceive(std::vector<double> & itemsToReceive, i
   try {
     asio::async_read(*_sockets[rankSender],
                      asio::buffer(itemsToReceive),
-                     [request](boost::system::error_code const &, std::size_t) {
-                       std::static_pointer_cast<SocketRequest>(request)->complete();
+                     [request](boost::system::error_code const &error, std::size_t) {
+                       std::static_pointer_cast<SocketRequest>(request)->complete(error);
                      });
   } catch (std::exception &e) {
     ERROR("Receive failed: " << e.what());
   }
 
-  return request;
+  return countReceived(rankSender, itemsToReceive.size() * sizeof(double), request);
 }
 
 void SocketCommunication::receive(double &itemToReceive, int rankSender)
@@ -659,7 +707,7 @@ void SocketCommunication::receive(double &itemToReceive, int rankSender)
   assertion(isConnected());
 
   try {
-    asio::read(*_sockets[rankSender], asio::buffer(&itemToReceive, sizeof(double)));
+    receiveBuffer(rankSender, asio::buffer(&itemToReceive, sizeof(double)));
   } catch (std::exception &e) {
     ERROR("Receive failed: " << e.what());
   }
@@ -680,7 +728,7 @@ void SocketCommunication::receive(int &itemToReceive, int rankSender)
   assertion(isConnected());
 
   try {
-    asio::read(*_sockets[rankSender], asio::buffer(&itemToReceive, sizeof(int)));
+    receiveBuffer(rankSender, asio::buffer(&itemToReceive, sizeof(int)));
   } catch (std::exception &e) {
     ERROR("Receive failed: " << e.what());
   }
@@ -701,14 +749,14 @@ PtrRequest SocketCommunication::aReceive(int &itemToReceive, int rankSender)
   try {
     asio::async_read(*_sockets[rankSender],
                      asio::buffer(&itemToReceive, sizeof(int)),
-                     [request](boost::system::error_code const &, std::size_t) {
-                       std::static_pointer_cast<SocketRequest>(request)->complete();
+                     [request](boost::system::error_code const &error, std::size_t) {
+                       std::static_pointer_cast<SocketRequest>(request)->complete(error);
                      });
   } catch (std::exception &e) {
     ERROR("Receive failed: " << e.what());
   }
 
-  return request;
+  return countReceived(rankSender, sizeof(int), request);
 }
 
 void SocketCommunication::receive(bool &itemToReceive, int rankSender)
@@ -721,7 +769,7 @@ void SocketCommunication::receive(bool &itemToReceive, int rankSender)
   assertion(isConnected());
 
   try {
-    asio::read(*_sockets[rankSender], asio::buffer(&itemToReceive, sizeof(bool)));
+    receiveBuffer(rankSender, asio::buffer(&itemToReceive, sizeof(bool)));
   } catch (std::exception &e) {
     ERROR("Receive failed: " << e.what());
   }
@@ -741,14 +789,14 @@ PtrRequest SocketCommunication::aReceive(bool &itemToReceive, int rankSender)
   try {
     asio::async_read(*_sockets[rankSender],
                      asio::buffer(&itemToReceive, sizeof(bool)),
-                     [request](boost::system::error_code const &, std::size_t) {
-                        std::static_pointer_cast<SocketRequest>(request)->complete();
+                     [request](boost::system::error_code const &error, std::size_t) {
+                        std::static_pointer_cast<SocketRequest>(request)->complete(error);
                      });
   } catch (std::exception &e) {
     ERROR("Receive failed: " << e.what());
   }
 
-  return request;
+  return countReceived(rankSender, sizeof(bool), request);
 }
 
 void SocketCommunication::send(std::vector<int> const &v, int rankReceiver)
@@ -762,8 +810,8 @@ void SocketCommunication::send(std::vector<int> const &v, int rankReceiver)
 
   size_t size = v.size();
   try {
-    asio::write(*_sockets[rankReceiver], asio::buffer(&size, sizeof(size_t)));
-    asio::write(*_sockets[rankReceiver], asio::buffer(v));
+    sendBuffer(rankReceiver, asio::buffer(&size, sizeof(size_t)));
+    sendBuffer(rankReceiver, asio::buffer(v));
   } catch (std::exception &e) {
     ERROR("Send failed: " << e.what());
   }
@@ -781,9 +829,9 @@ void SocketCommunication::receive(std::vector<int> &v, int rankSender)
   size_t size = 0;
 
   try {
-    asio::read(*_sockets[rankSender], asio::buffer(&size, sizeof(size_t)));
+    receiveBuffer(rankSender, asio::buffer(&size, sizeof(size_t)));
     v.resize(size);
-    asio::read(*_sockets[rankSender], asio::buffer(v));
+    receiveBuffer(rankSender, asio::buffer(v));
   } catch (std::exception &e) {
     ERROR("Receive failed: " << e.what());
   }
@@ -800,8 +848,8 @@ void SocketCommunication::send(std::vector<double> const &v, int rankReceiver)
 
   size_t size = v.size();
   try {
-    asio::write(*_sockets[rankReceiver], asio::buffer(&size, sizeof(size_t)));
-    asio::write(*_sockets[rankReceiver], asio::buffer(v));
+    sendBuffer(rankReceiver, asio::buffer(&size, sizeof(size_t)));
+    sendBuffer(rankReceiver, asio::buffer(v));
   } catch (std::exception &e) {
     ERROR("Send failed: " << e.what());
   }
@@ -819,9 +867,9 @@ void SocketCommunication::receive(std::vector<double> &v, int rankSender)
   size_t size = 0;
 
   try {
-    asio::read(*_sockets[rankSender], asio::buffer(&size, sizeof(size_t)));
+    receiveBuffer(rankSender, asio::buffer(&size, sizeof(size_t)));
     v.resize(size);
-    asio::read(*_sockets[rankSender], asio::buffer(v));
+    receiveBuffer(rankSender, asio::buffer(v));
   } catch (std::exception &e) {
     ERROR("Receive failed: " << e.what());
   }
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "com/Communication.hpp"
+#include "com/SocketSendQueue.hpp"
 #include <boost/asio.hpp>
 #include "logging/Logger.hpp"
 #include <thread>
@@ -45,6 +46,10 @@ public:
                                          std::set<int> const &acceptorRanks,
                                          int                  requesterRank) override;
 
+  virtual std::string prepareConnectionAsServer() override;
+
+  virtual void requestConnectionAtAddresses(std::map<int, std::string> const &acceptorAddresses,
+                                            int                               requesterRank) override;
 
   virtual void closeConnection() override;
 
@@ -137,19 +142,39 @@ private:
   /// Directory where IP address is exchanged by file.
   std::string _addressDirectory;
 
-  using IOService     = boost::asio::io_service;
-  using TCP           = boost::asio::ip::tcp;
-  using SocketService = boost::asio::stream_socket_service<TCP>;
-  using Socket        = boost::asio::basic_stream_socket<TCP, SocketService>;
-  using Work          = boost::asio::io_service::work;
+  using IOService = boost::asio::io_service;
+  using TCP       = boost::asio::ip::tcp;
+  using Socket    = TCP::socket;
+  using Work      = boost::asio::io_service::work;
   
   std::shared_ptr<IOService> _ioService;
   std::shared_ptr<Work> _work;
   std::thread _thread;
+
+  /// Acceptor opened by prepareConnectionAsServer() for the next acceptConnectionAsServer().
+  std::shared_ptr<TCP::acceptor> _acceptor;
+
+  /// Address of _acceptor, i.e. "ip:port".
+  std::string _acceptorAddress;
   
   /// Remote rank -> socket map
   std::map<int, std::shared_ptr<Socket>> _sockets;
 
+  /// Remote rank -> queue of the writes to the socket
+  std::map<int, std::shared_ptr<SocketSendQueue>> _sendQueues;
+
+  /// Connects to the server of the given acceptor rank at "ip:port" and sends it the requester rank.
+  void connectAsClient(std::string const &address, int acceptorRank, int requesterRank);
+
+  /// Adds a connected socket of the given remote rank.
+  void addSocket(int remoteRank, std::shared_ptr<Socket> socket);
+
+  /// Writes data to the socket of the remote rank after all pending asynchronous writes.
+  void sendBuffer(int rankReceiver, boost::asio::const_buffer data);
+
+  /// Reads data from the socket of the remote rank.
+  void receiveBuffer(int rankSender, boost::asio::mutable_buffer data);
+
   bool isClient();
   bool isServer();
 
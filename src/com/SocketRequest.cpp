@@ -9,29 +9,46 @@ SocketRequest::SocketRequest()
 {
 }
 
-void SocketRequest::complete()
+void SocketRequest::complete(boost::system::error_code const &error)
 {
   {
     std::lock_guard<std::mutex> lock(_completeMutex);
 
     _complete = true;
+    _error    = error;
   }
 
   _completeCondition.notify_one();
+  notifyCompletion();
 }
 
 bool SocketRequest::test()
 {
   std::lock_guard<std::mutex> lock(_completeMutex);
 
+  if (_complete) {
+    checkError();
+  }
   return _complete;
 }
 
 void SocketRequest::wait()
 {
-  std::unique_lock<std::mutex> lock(_completeMutex);
+  const auto start = utils::Event::Clock::now();
+  {
+    std::unique_lock<std::mutex> lock(_completeMutex);
 
-  _completeCondition.wait(lock, [this] { return _complete; });
+    _completeCondition.wait(lock, [this] { return _complete; });
+    checkError();
+  }
+  countWait(start);
+}
+
+void SocketRequest::checkError()
+{
+  if (_error) {
+    ERROR("Asynchronous socket communication failed: " << _error.message());
+  }
 }
 } // namespace com
 } // namespace precice
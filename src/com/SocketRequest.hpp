@@ -3,8 +3,10 @@
 
 #include "Request.hpp"
 
+#include <boost/system/error_code.hpp>
 #include <condition_variable>
 #include <mutex>
+#include "logging/Logger.hpp"
 
 namespace precice
 {
@@ -15,15 +17,28 @@ class SocketRequest : public Request
 public:
   SocketRequest();
 
-  void complete();
+  /// Completes the request with the result of the asynchronous operation, which is checked by test() and wait().
+  void complete(boost::system::error_code const &error = boost::system::error_code());
 
   bool test() override;
 
   void wait() override;
 
 private:
+  bool notifiesCompletion() const override
+  {
+    return true;
+  }
+
+  /// Exits with an error, if the asynchronous operation failed.
+  void checkError();
+
+  logging::Logger _log{"com::SocketRequest"};
+
   bool _complete;
 
+  boost::system::error_code _error;
+
   std::condition_variable _completeCondition;
   std::mutex              _completeMutex;
 };
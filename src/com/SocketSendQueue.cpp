@@ -0,0 +1,52 @@
+#ifndef PRECICE_NO_SOCKETS
+
+#include "SocketSendQueue.hpp"
+
+namespace precice
+{
+namespace com
+{
+namespace asio = boost::asio;
+
+SocketSendQueue::SocketSendQueue(Socket &socket)
+    : _socket(socket)
+{
+}
+
+void SocketSendQueue::dispatch(asio::const_buffer data, Callback callback)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _items.push_back({data, std::move(callback)});
+  process();
+}
+
+bool SocketSendQueue::isBusy()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _writing or not _items.empty();
+}
+
+void SocketSendQueue::process()
+{
+  if (_writing or _items.empty()) {
+    return;
+  }
+  _writing = true;
+  asio::async_write(_socket,
+                    asio::buffer(_items.front().data),
+                    [this](boost::system::error_code const &error, std::size_t) {
+                      Callback callback;
+                      {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        callback = std::move(_items.front().callback);
+                        _items.pop_front();
+                        _writing = false;
+                        process();
+                      }
+                      callback(error);
+                    });
+}
+} // namespace com
+} // namespace precice
+
+#endif // not PRECICE_NO_SOCKETS
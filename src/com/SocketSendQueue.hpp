@@ -0,0 +1,63 @@
+#ifndef PRECICE_NO_SOCKETS
+
+#pragma once
+
+#include <boost/asio.hpp>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+namespace precice
+{
+namespace com
+{
+/**
+ * @brief Serializes the writes to one socket.
+ *
+ * The data of concurrent asio::async_write calls on the same socket may interleave. This queue
+ * starts a write only after the previous one has completed, such that messages arrive in the order
+ * in which they have been dispatched.
+ */
+class SocketSendQueue
+{
+public:
+  using Socket   = boost::asio::ip::tcp::socket;
+  using Callback = std::function<void(boost::system::error_code const &)>;
+
+  explicit SocketSendQueue(Socket &socket);
+
+  SocketSendQueue(SocketSendQueue const &) = delete;
+  SocketSendQueue &operator=(SocketSendQueue const &) = delete;
+
+  /**
+   * @brief Enqueues data to be written to the socket.
+   *
+   * @param[in] data Buffer, which has to stay valid until the callback has been called.
+   * @param[in] callback Called from the IO service thread with the result of the write.
+   */
+  void dispatch(boost::asio::const_buffer data, Callback callback);
+
+  /// Returns true, if a write is in progress or pending.
+  bool isBusy();
+
+private:
+  struct Item {
+    boost::asio::const_buffer data;
+    Callback                  callback;
+  };
+
+  /// Starts writing the first item, if no write is in progress. Requires a locked mutex.
+  void process();
+
+  Socket &_socket;
+
+  std::deque<Item> _items;
+
+  bool _writing = false;
+
+  std::mutex _mutex;
+};
+} // namespace com
+} // namespace precice
+
+#endif // not PRECICE_NO_SOCKETS
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <chrono>
+#include <thread>
+#include "utils/EventUtils.hpp"
+
 using namespace precice;
 
 /// Generic test function that is called from the tests for MPIPortsCommunication,
@@ -269,6 +273,50 @@ void TestSendAndReceive()
   TestSendAndReceiveVectors<T>();
 }
 
+/// Tests the counted bytes, messages and wait time of synchronous and asynchronous transfers
+template<typename T>
+void TestStatistics()
+{
+  T com;
+  const int rank = utils::Parallel::getProcessRank();
+  std::vector<double> values(10, 1.0);
+  int message = 0;
+
+  if (rank == 0) {
+    com.acceptConnection("process0", "process1", rank);
+    // Some communications exchange messages to set up the connection
+    auto const before = com.getStatistics()[0];
+    com.aSend(values.data(), values.size(), 0)->wait();
+    com.send(message, 0);
+    com.receive(message, 0);
+    auto statistics = com.getStatistics();
+    BOOST_TEST(statistics.size() == 1);
+    auto const & channel = statistics[0];
+    BOOST_TEST(channel.bytesSent - before.bytesSent == 10 * sizeof(double) + sizeof(int));
+    BOOST_TEST(channel.messagesSent - before.messagesSent == 2);
+    BOOST_TEST(channel.bytesReceived - before.bytesReceived == sizeof(int));
+    BOOST_TEST(channel.messagesReceived - before.messagesReceived == 1);
+    // The remote rank waits before it answers
+    BOOST_TEST(channel.getWaitTime() - before.getWaitTime() >= 40.0);
+    com.closeConnection();
+  } else if (rank == 1) {
+    com.requestConnection("process0", "process1", 0, 1);
+    auto const before = com.getStatistics()[0];
+    com.receive(values.data(), values.size(), 0);
+    com.receive(message, 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    com.send(message, 0);
+    auto statistics = com.getStatistics();
+    BOOST_TEST(statistics.size() == 1);
+    auto const & channel = statistics[0];
+    BOOST_TEST(channel.bytesReceived - before.bytesReceived == 10 * sizeof(double) + sizeof(int));
+    BOOST_TEST(channel.messagesReceived - before.messagesReceived == 2);
+    BOOST_TEST(channel.bytesSent - before.bytesSent == sizeof(int));
+    BOOST_TEST(channel.messagesSent - before.messagesSent == 1);
+    com.closeConnection();
+  }
+}
+
 /// Tests connecting two processes using acceptConnectionAsServer and requestConnectionAsClient
 template<typename T>
 void TestSendReceiveTwoProcessesServerClient()
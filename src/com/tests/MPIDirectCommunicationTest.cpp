@@ -19,6 +19,14 @@ BOOST_AUTO_TEST_CASE(SendAndReceive,
   TestSendAndReceive<MPIDirectCommunication>();
 }
 
+BOOST_AUTO_TEST_CASE(Statistics,
+                     * testing::MinRanks(2)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>()
+                     * boost::unit_test::fixture<testing::MPICommRestrictFixture>(std::vector<int>({0, 1})))
+{
+  TestStatistics<MPIDirectCommunication>();
+}
+
 BOOST_AUTO_TEST_SUITE_END() // MPIDirectCommunication
 
 BOOST_AUTO_TEST_SUITE_END() // Communication
@@ -0,0 +1,93 @@
+#ifndef PRECICE_NO_SHARED_MEMORY
+
+#include "com/SharedMemoryCommunication.hpp"
+#include "testing/Testing.hpp"
+#include "GenericTestFunctions.hpp"
+
+using namespace precice;
+using namespace precice::com;
+
+BOOST_TEST_SPECIALIZED_COLLECTION_COMPARE(std::vector<int>)
+
+BOOST_AUTO_TEST_SUITE(CommunicationTests)
+
+BOOST_AUTO_TEST_SUITE(SharedMemory)
+
+BOOST_AUTO_TEST_CASE(SendAndReceive,
+                     * testing::MinRanks(2))
+{
+  TestSendAndReceive<SharedMemoryCommunication>();
+}
+
+BOOST_AUTO_TEST_CASE(Statistics,
+                     * testing::MinRanks(2)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  TestStatistics<SharedMemoryCommunication>();
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveFourProcesses,
+                     * testing::MinRanks(4)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  TestSendReceiveFourProcesses<SharedMemoryCommunication>();
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveTwoProcessesServerClient,
+                     * testing::MinRanks(2)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  TestSendReceiveTwoProcessesServerClient<SharedMemoryCommunication>();
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveFourProcessesServerClient,
+                     * testing::MinRanks(4)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  TestSendReceiveFourProcessesServerClient<SharedMemoryCommunication>();
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveFourProcessesServerClientV2,
+                     * testing::MinRanks(4)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  TestSendReceiveFourProcessesServerClientV2<SharedMemoryCommunication>();
+}
+
+/// Messages larger than the ring buffers are transferred in parts, also asynchronously in both directions.
+BOOST_AUTO_TEST_CASE(SendLargerThanBuffer,
+                     * testing::MinRanks(2)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  const int rank = utils::Parallel::getProcessRank();
+  if (rank > 1) {
+    return;
+  }
+  SharedMemoryCommunication com(".", 1024);
+  std::vector<double>       sent(10000, rank);
+  std::vector<double>       received(10000, -1.0);
+
+  if (rank == 0) {
+    com.acceptConnection("A", "B", rank);
+  } else {
+    com.requestConnection("A", "B", 0, 1);
+  }
+  PtrRequest sendRequest    = com.aSend(sent, 0);
+  PtrRequest receiveRequest = com.aReceive(received, 0);
+  int        message        = 5;
+  com.send(message, 0);
+  sendRequest->wait();
+  receiveRequest->wait();
+  com.receive(message, 0);
+
+  BOOST_TEST(message == 5);
+  for (double value : received) {
+    BOOST_TEST(value == 1 - rank);
+  }
+  com.closeConnection();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // SharedMemory
+BOOST_AUTO_TEST_SUITE_END() // Communication
+
+#endif // not PRECICE_NO_SHARED_MEMORY
@@ -1,3 +1,4 @@
+#include "com/Request.hpp"
 #include "com/SocketCommunication.hpp"
 #include "testing/Testing.hpp"
 #include "GenericTestFunctions.hpp"
@@ -19,6 +20,13 @@ BOOST_AUTO_TEST_CASE(SendAndReceive,
   TestSendAndReceive<SocketCommunication>();
 }
 
+BOOST_AUTO_TEST_CASE(Statistics,
+                     * testing::MinRanks(2)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  TestStatistics<SocketCommunication>();
+}
+
 BOOST_AUTO_TEST_CASE(SendReceiveFourProcesses,
                      * testing::MinRanks(4)
                      * boost::unit_test::fixture<testing::SyncProcessesFixture>())
@@ -56,6 +64,80 @@ BOOST_AUTO_TEST_CASE(SendReceiveFourProcessesServerClientV2,
   TestSendReceiveFourProcessesServerClientV2<SocketCommunication>();
 }
 
+/// Asynchronous sends and subsequent blocking sends to the same rank must arrive in order.
+BOOST_AUTO_TEST_CASE(SendOrder,
+                     * testing::MinRanks(2)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  const int rank = utils::Parallel::getProcessRank();
+  const int messages = 10;
+  const int size     = 100000;
+
+  if (rank == 0) {
+    SocketCommunication com;
+    com.acceptConnection("A", "B", rank);
+    std::vector<std::vector<double>> buffers(messages);
+    std::vector<PtrRequest>          requests;
+    for (int i = 0; i < messages; i++) {
+      buffers[i].assign(size, i);
+      requests.push_back(com.aSend(buffers[i], 0));
+      com.send(i, 0);
+    }
+    Request::wait(requests);
+    com.closeConnection();
+  } else if (rank == 1) {
+    SocketCommunication com;
+    com.requestConnection("A", "B", 0, 1);
+    std::vector<double> buffer(size);
+    for (int i = 0; i < messages; i++) {
+      com.receive(buffer.data(), size, 0);
+      BOOST_TEST(buffer.front() == i);
+      BOOST_TEST(buffer.back() == i);
+      int message = -1;
+      com.receive(message, 0);
+      BOOST_TEST(message == i);
+    }
+    com.closeConnection();
+  }
+}
+
+/// Request::waitAny returns the receive which completes first, not the first one posted.
+BOOST_AUTO_TEST_CASE(WaitAny,
+                     * testing::MinRanks(3)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  const int rank = utils::Parallel::getProcessRank();
+
+  if (rank == 0) {
+    SocketCommunication com;
+    com.acceptConnection("A", "B", rank);
+    std::vector<int>        messages(2, -1);
+    std::vector<PtrRequest> requests(2);
+    for (int remoteRank = 0; remoteRank < 2; remoteRank++) {
+      requests[remoteRank] = com.aReceive(messages[remoteRank], remoteRank);
+    }
+    BOOST_TEST(Request::waitAny(requests) == 1);
+    BOOST_TEST(messages[1] == 2);
+    requests[1].reset();
+
+    com.send(true, 0); // Allows remote rank 0 to send
+    BOOST_TEST(Request::waitAny(requests) == 0);
+    BOOST_TEST(messages[0] == 1);
+    com.closeConnection();
+  } else if (rank == 1) {
+    SocketCommunication com;
+    com.requestConnection("A", "B", 0, 2);
+    bool go = false;
+    com.receive(go, 0);
+    com.send(rank, 0);
+    com.closeConnection();
+  } else if (rank == 2) {
+    SocketCommunication com;
+    com.requestConnection("A", "B", 1, 2);
+    com.send(rank, 0);
+    com.closeConnection();
+  }
+}
 
 BOOST_AUTO_TEST_SUITE_END() // Socket
 BOOST_AUTO_TEST_SUITE_END() // Communication
@@ -13,11 +13,14 @@
 #include "math/math.hpp"
 #include "mesh/Mesh.hpp"
 #include "utils/EigenHelperFunctions.hpp"
+#include "utils/Event.hpp"
 #include "utils/Helpers.hpp"
 #include "utils/MasterSlave.hpp"
 
 namespace precice
 {
+extern bool syncMode;
+
 namespace cplscheme
 {
 
@@ -135,14 +138,15 @@ void BaseCouplingScheme::sendDt()
 }
 
 void BaseCouplingScheme::addDataToSend(
-    mesh::PtrData data,
-    mesh::PtrMesh mesh,
-    bool          initialize)
+    mesh::PtrData           data,
+    mesh::PtrMesh           mesh,
+    bool                    initialize,
+    const m2n::Compression &compression)
 {
   TRACE();
   int id = data->getID();
   if (!utils::contained(id, _sendData)) {
-    PtrCouplingData     ptrCplData(new CouplingData(&(data->values()), mesh, initialize, data->getDimensions()));
+    PtrCouplingData     ptrCplData(new CouplingData(&(data->values()), mesh, initialize, data->getDimensions(), compression));
     DataMap::value_type pair = std::make_pair(id, ptrCplData);
     _sendData.insert(pair);
   } else {
@@ -151,14 +155,15 @@ void BaseCouplingScheme::addDataToSend(
 }
 
 void BaseCouplingScheme::addDataToReceive(
-    mesh::PtrData data,
-    mesh::PtrMesh mesh,
-    bool          initialize)
+    mesh::PtrData           data,
+    mesh::PtrMesh           mesh,
+    bool                    initialize,
+    const m2n::Compression &compression)
 {
   TRACE();
   int id = data->getID();
   if (!utils::contained(id, _receiveData)) {
-    PtrCouplingData     ptrCplData(new CouplingData(&(data->values()), mesh, initialize, data->getDimensions()));
+    PtrCouplingData     ptrCplData(new CouplingData(&(data->values()), mesh, initialize, data->getDimensions(), compression));
     DataMap::value_type pair = std::make_pair(id, ptrCplData);
     _receiveData.insert(pair);
   } else {
@@ -234,10 +239,12 @@ std::vector<int> BaseCouplingScheme::sendData(m2n::PtrM2N m2n)
   std::vector<int> sentDataIDs;
   assertion(m2n.get() != nullptr);
   assertion(m2n->isConnected());
+  // The sends of the last exchange have been received by now, release their buffers
+  m2n->finishSends();
   for (const DataMap::value_type &pair : _sendData) {
     //std::cout<<"\nsend data id="<<pair.first<<": "<<*(pair.second->values)<<std::endl;
     int size = pair.second->values->size();
-    m2n->send(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
+    m2n->startSend(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension, pair.second->compression);
     sentDataIDs.push_back(pair.first);
   }
   DEBUG("Number of sent data sets = " << sentDataIDs.size());
@@ -255,9 +262,10 @@ std::vector<int> BaseCouplingScheme::receiveData(
   for (DataMap::value_type &pair : _receiveData) {
     int size = pair.second->values->size();
     //std::cout<<"\nreceive data id="<<pair.first<<": "<<*(pair.second->values)<<std::endl;
-    m2n->receive(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
+    m2n->startReceive(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension, pair.second->compression);
     receivedDataIDs.push_back(pair.first);
   }
+  m2n->finishReceives();
   DEBUG("Number of received data sets = " << receivedDataIDs.size());
 
   return receivedDataIDs;
@@ -633,6 +641,7 @@ bool BaseCouplingScheme::measureConvergence(
 {
   TRACE();
   assertion(not doesFirstStep());
+  utils::Event e("cpl.measureConvergence", precice::syncMode);
   bool allConverged = true;
   bool oneSuffices  = false;
   assertion(_convergenceMeasures.size() > 0);
@@ -640,6 +649,8 @@ bool BaseCouplingScheme::measureConvergence(
     _convergenceWriter->writeData("Timestep", _timesteps);
     _convergenceWriter->writeData("Iteration", _iterations);
   }
+  std::vector<int> offsets;
+  Eigen::VectorXd  sums = reduceConvergenceSums(designSpecifications, false, offsets);
   for (size_t i = 0; i < _convergenceMeasures.size(); i++) {
     ConvergenceMeasure &convMeasure = _convergenceMeasures[i];
 
@@ -647,14 +658,7 @@ bool BaseCouplingScheme::measureConvergence(
     if (convMeasure.level > 0)
       continue;
 
-    assertion(convMeasure.data != nullptr);
-    assertion(convMeasure.measure.get() != nullptr);
-    const auto &    oldValues = convMeasure.data->oldValues.col(0);
-    Eigen::VectorXd q         = Eigen::VectorXd::Zero(convMeasure.data->values->size());
-    if (designSpecifications.find(convMeasure.dataID) != designSpecifications.end())
-      q = designSpecifications.at(convMeasure.dataID);
-
-    convMeasure.measure->measure(oldValues, *convMeasure.data->values, q);
+    convMeasure.measure->measureSums(sums.segment(offsets[i], offsets[i + 1] - offsets[i]));
 
     if (not utils::MasterSlave::_slaveMode) {
       std::stringstream sstm;
@@ -691,21 +695,17 @@ bool BaseCouplingScheme::measureConvergenceCoarseModelOptimization(
   bool allConverged = true;
   bool oneSuffices  = false;
   assertion(_convergenceMeasures.size() > 0);
-  for (ConvergenceMeasure &convMeasure : _convergenceMeasures) {
+  std::vector<int> offsets;
+  Eigen::VectorXd  sums = reduceConvergenceSums(designSpecifications, true, offsets);
+  for (size_t i = 0; i < _convergenceMeasures.size(); i++) {
+    ConvergenceMeasure &convMeasure = _convergenceMeasures[i];
 
     // only apply convergence measures for coarse model optimization
     if (convMeasure.level == 0)
       continue;
 
     std::cout << "  measure convergence coarse measure, id:" << convMeasure.dataID << std::endl;
-    assertion(convMeasure.data != nullptr);
-    assertion(convMeasure.measure.get() != nullptr);
-    const auto &    oldValues = convMeasure.data->oldValues.col(0);
-    Eigen::VectorXd q         = Eigen::VectorXd::Zero(convMeasure.data->values->size());
-    if (designSpecifications.find(convMeasure.dataID) != designSpecifications.end())
-      q = designSpecifications.at(convMeasure.dataID);
-
-    convMeasure.measure->measure(oldValues, *convMeasure.data->values, q);
+    convMeasure.measure->measureSums(sums.segment(offsets[i], offsets[i + 1] - offsets[i]));
 
     if (not convMeasure.measure->isConvergence()) {
       allConverged = false;
@@ -724,6 +724,36 @@ bool BaseCouplingScheme::measureConvergenceCoarseModelOptimization(
   return allConverged || oneSuffices;
 }
 
+Eigen::VectorXd BaseCouplingScheme::reduceConvergenceSums(
+    std::map<int, Eigen::VectorXd> &designSpecifications,
+    bool                            coarseModel,
+    std::vector<int> &              offsets)
+{
+  TRACE(coarseModel);
+  std::vector<Eigen::VectorXd> localSums(_convergenceMeasures.size());
+  offsets.assign(1, 0);
+  for (size_t i = 0; i < _convergenceMeasures.size(); i++) {
+    ConvergenceMeasure &convMeasure = _convergenceMeasures[i];
+    if ((convMeasure.level > 0) == coarseModel) {
+      assertion(convMeasure.data != nullptr);
+      assertion(convMeasure.measure.get() != nullptr);
+      const auto &    oldValues = convMeasure.data->oldValues.col(0);
+      Eigen::VectorXd q         = Eigen::VectorXd::Zero(convMeasure.data->values->size());
+      if (designSpecifications.find(convMeasure.dataID) != designSpecifications.end())
+        q = designSpecifications.at(convMeasure.dataID);
+
+      localSums[i] = convMeasure.measure->localSums(oldValues, *convMeasure.data->values, q);
+    }
+    offsets.push_back(offsets.back() + localSums[i].size());
+  }
+
+  Eigen::VectorXd sums(offsets.back());
+  for (size_t i = 0; i < localSums.size(); i++) {
+    sums.segment(offsets[i], localSums[i].size()) = localSums[i];
+  }
+  return utils::MasterSlave::allreduceSum(sums);
+}
+
 void BaseCouplingScheme::initializeTXTWriters()
 {
   if (not utils::MasterSlave::_slaveMode) {
@@ -849,6 +879,31 @@ void BaseCouplingScheme::updateTimeAndIterations(
   }
 }
 
+void BaseCouplingScheme::postProcessingIterationsConverged(
+    DataMap &data)
+{
+  TRACE();
+  if (_postProcessing.get() != nullptr) {
+    utils::Event e("cpl.iterationsConverged", precice::syncMode);
+    _deletedColumnsPPFiltering = _postProcessing->getDeletedColumns();
+    _postProcessing->iterationsConverged(data);
+  }
+}
+
+void BaseCouplingScheme::storeOldValues()
+{
+  for (DataMap::value_type &pair : _sendData) {
+    if (pair.second->oldValues.size() > 0) {
+      pair.second->oldValues.col(0) = *pair.second->values;
+    }
+  }
+  for (DataMap::value_type &pair : _receiveData) {
+    if (pair.second->oldValues.size() > 0) {
+      pair.second->oldValues.col(0) = *pair.second->values;
+    }
+  }
+}
+
 void BaseCouplingScheme::timestepCompleted()
 {
   TRACE(getTimesteps(), getTime());
@@ -83,15 +83,17 @@ public:
 
   /// Adds data to be sent on data exchange and possibly be modified during coupling iterations.
   void addDataToSend(
-      mesh::PtrData data,
-      mesh::PtrMesh mesh,
-      bool          initialize);
+      mesh::PtrData           data,
+      mesh::PtrMesh           mesh,
+      bool                    initialize,
+      const m2n::Compression &compression = m2n::Compression());
 
   /// Adds data to be received on data exchange.
   void addDataToReceive(
-      mesh::PtrData data,
-      mesh::PtrMesh mesh,
-      bool          initialize);
+      mesh::PtrData           data,
+      mesh::PtrMesh           mesh,
+      bool                    initialize,
+      const m2n::Compression &compression = m2n::Compression());
 
   /// Returns true, if initialize has been called.
   virtual bool isInitialized() const
@@ -246,6 +248,24 @@ public:
    */
   void setExtrapolationOrder(int order);
 
+  /**
+   * @brief Enables pipelining of the implicit coupling iterations.
+   *
+   * The second participant then sends convergence and data as soon as the sent values are final.
+   * The post-processing bookkeeping after convergence and the storage of old values, which do not
+   * modify the sent values, are done afterwards, i.e., while the data is in flight and the first
+   * participant continues. The deferred work is logged as event "cpl.overlappedPostProcessing".
+   */
+  void setPipelining(bool pipelining)
+  {
+    _pipelining = pipelining;
+  }
+
+  bool isPipelining() const
+  {
+    return _pipelining;
+  }
+
   typedef std::map<int, PtrCouplingData> DataMap; // move that back to protected
 
   void extrapolateData(DataMap &data);
@@ -457,9 +477,37 @@ protected:
   bool measureConvergence(
       std::map<int, Eigen::VectorXd> &designSpecification);
 
+  /**
+   * @brief Returns the sums of all convergence measures of the fine or coarse model, which are
+   *        reduced over all ranks at once.
+   *
+   * @param[out] offsets Position of the sums of each convergence measure, followed by the total size.
+   */
+  Eigen::VectorXd reduceConvergenceSums(
+      std::map<int, Eigen::VectorXd> &designSpecification,
+      bool                            coarseModel,
+      std::vector<int> &              offsets);
+
   bool measureConvergenceCoarseModelOptimization(
       std::map<int, Eigen::VectorXd> &designSpecification);
 
+  /// Informs the post-processing, if any, about the convergence of the coupling iterations.
+  void postProcessingIterationsConverged(DataMap &data);
+
+  /// Stores the current values of all send and receive data as old values.
+  void storeOldValues();
+
+  /**
+   * @brief Returns true, if work not modifying the sent values is done after sending them.
+   *
+   * After convergence, extrapolation modifies the sent values based on the old values, hence,
+   * nothing is deferred then.
+   */
+  bool isPostProcessingDeferred(bool convergence) const
+  {
+    return _pipelining && not(convergence && _extrapolationOrder > 0);
+  }
+
   /**
    * @brief Sets up _dataStorage to store data values of last timestep.
    *
@@ -542,6 +590,9 @@ private:
   /// Extrapolation order of coupling data for first iteration of every dt.
   int _extrapolationOrder = 0;
 
+  /// True, if the second participant sends data before finishing the post-processing bookkeeping.
+  bool _pipelining = false;
+
   int _validDigits;
 
   /// True, if local participant is the one starting the explicit scheme.
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "m2n/Compression.hpp"
 #include "mesh/SharedPointer.hpp"
 #include "utils/assertion.hpp"
 #include "mesh/Data.hpp"
@@ -26,6 +27,9 @@ struct CouplingData
   /// dimension of one data value (scalar=1, or vectorial=interface-dimension)
   int dimension;
 
+  /// Encoding of the values for the exchange with the other participant.
+  m2n::Compression compression;
+
   /**
    * @brief Default constructor, not to be used!
    *
@@ -40,12 +44,14 @@ struct CouplingData
     Eigen::VectorXd*  values,
     mesh::PtrMesh     mesh,
     bool              initialize,
-    int               dimension)
+    int               dimension,
+    m2n::Compression  compression = m2n::Compression())
     :
     values ( values ),
     mesh(mesh),
     initialize ( initialize ),
-    dimension(dimension)
+    dimension(dimension),
+    compression(compression)
     {
       assertion ( values != NULL );
       assertion ( mesh.use_count()>0);
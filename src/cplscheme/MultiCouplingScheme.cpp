@@ -218,14 +218,15 @@ void MultiCouplingScheme::mergeData()
 
 void MultiCouplingScheme:: addDataToSend
 (
-  mesh::PtrData data,
-  mesh::PtrMesh mesh,
-  bool          initialize,
-  int           index)
+  mesh::PtrData           data,
+  mesh::PtrMesh           mesh,
+  bool                    initialize,
+  int                     index,
+  const m2n::Compression &compression)
 {
   int id = data->getID();
   if(! utils::contained(id, _sendDataVector[index])) {
-    PtrCouplingData ptrCplData (new CouplingData(& (data->values()), mesh, initialize, data->getDimensions()));
+    PtrCouplingData ptrCplData (new CouplingData(& (data->values()), mesh, initialize, data->getDimensions(), compression));
     DataMap::value_type pair = std::make_pair (id, ptrCplData);
     _sendDataVector[index].insert(pair);
   }
@@ -238,14 +239,15 @@ void MultiCouplingScheme:: addDataToSend
 
 void MultiCouplingScheme:: addDataToReceive
 (
-  mesh::PtrData data,
-  mesh::PtrMesh mesh,
-  bool          initialize,
-  int           index)
+  mesh::PtrData           data,
+  mesh::PtrMesh           mesh,
+  bool                    initialize,
+  int                     index,
+  const m2n::Compression &compression)
 {
   int id = data->getID();
   if(! utils::contained(id, _receiveDataVector[index])) {
-    PtrCouplingData ptrCplData (new CouplingData(& (data->values()), mesh, initialize, data->getDimensions()));
+    PtrCouplingData ptrCplData (new CouplingData(& (data->values()), mesh, initialize, data->getDimensions(), compression));
     DataMap::value_type pair = std::make_pair (id, ptrCplData);
     _receiveDataVector[index].insert(pair);
   }
@@ -260,14 +262,17 @@ void MultiCouplingScheme:: sendData()
 {
   TRACE();
 
+  // The sends to all partners are started before any of them is waited for
   for(size_t i=0;i<_communications.size();i++){
     assertion(_communications[i].get() != nullptr);
     assertion(_communications[i]->isConnected());
+    _communications[i]->finishSends();
 
     for (DataMap::value_type& pair : _sendDataVector[i]) {
       int size = pair.second->values->size();
       if (size > 0) {
-        _communications[i]->send(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
+        _communications[i]->startSend(pair.second->values->data(), size, pair.second->mesh->getID(),
+                                      pair.second->dimension, pair.second->compression);
       }
     }
   }
@@ -277,6 +282,7 @@ void MultiCouplingScheme:: receiveData()
 {
   TRACE();
 
+  // The receives from all partners are posted first and completed together
   for(size_t i=0;i<_communications.size();i++){
     assertion(_communications[i].get() != nullptr);
     assertion(_communications[i]->isConnected());
@@ -284,10 +290,14 @@ void MultiCouplingScheme:: receiveData()
     for (DataMap::value_type& pair : _receiveDataVector[i]) {
       int size = pair.second->values->size();
       if (size > 0) {
-        _communications[i]->receive(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
+        _communications[i]->startReceive(pair.second->values->data(), size, pair.second->mesh->getID(),
+                                         pair.second->dimension, pair.second->compression);
       }
     }
   }
+  for (m2n::PtrM2N m2n : _communications) {
+    m2n->finishReceives();
+  }
 }
 
 
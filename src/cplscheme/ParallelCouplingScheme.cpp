@@ -2,6 +2,7 @@
 #include "impl/PostProcessing.hpp"
 #include "m2n/M2N.hpp"
 #include "utils/EigenHelperFunctions.hpp"
+#include "utils/Event.hpp"
 #include "utils/MasterSlave.hpp"
 #include "math/math.hpp"
 
@@ -260,14 +261,16 @@ void ParallelCouplingScheme::implicitAdvance()
       }
 
 
+      // in pipelined mode, work which does not modify the sent values is done after sending them
+      const bool deferred = not doOnlySolverEvaluation && isPostProcessingDeferred(convergence);
+
       // for multi-level case, i.e., manifold mapping: after convergence of coarse problem
       // we only want to evaluate the fine model for the new input, no post-processing etc..
       if (not doOnlySolverEvaluation)
       {
         if (convergence) {
-          if (getPostProcessing().get() != nullptr) {
-            _deletedColumnsPPFiltering = getPostProcessing()->getDeletedColumns();
-            getPostProcessing()->iterationsConverged(getAllData());
+          if (not deferred) {
+            postProcessingIterationsConverged(getAllData());
           }
           newConvergenceMeasurements();
           timestepCompleted();
@@ -280,17 +283,8 @@ void ParallelCouplingScheme::implicitAdvance()
         if (convergence && (getExtrapolationOrder() > 0)) {
           extrapolateData(getAllData()); // Also stores data
         }
-        else { // Store data for conv. measurement, post-processing, or extrapolation
-          for (DataMap::value_type& pair : getSendData()) {
-            if (pair.second->oldValues.size() > 0) {
-              pair.second->oldValues.col(0) = *pair.second->values;
-            }
-          }
-          for (DataMap::value_type& pair : getReceiveData()) {
-            if (pair.second->oldValues.size() > 0) {
-              pair.second->oldValues.col(0) = *pair.second->values;
-            }
-          }
+        else if (not deferred) { // Store data for conv. measurement, post-processing, or extrapolation
+          storeOldValues();
         }
       }else {
 
@@ -312,6 +306,14 @@ void ParallelCouplingScheme::implicitAdvance()
       getM2N()->send(_isCoarseModelOptimizationActive);
 
       sendData(getM2N());
+
+      if (deferred) {
+        utils::Event e("cpl.overlappedPostProcessing");
+        if (convergence) {
+          postProcessingIterationsConverged(getAllData());
+        }
+        storeOldValues();
+      }
     }
 
     // both participants
@@ -1,6 +1,7 @@
 #include "SerialCouplingScheme.hpp"
 #include "impl/PostProcessing.hpp"
 #include "utils/EigenHelperFunctions.hpp"
+#include "utils/Event.hpp"
 #include "utils/MasterSlave.hpp"
 #include "m2n/M2N.hpp"
 #include "math/math.hpp"
@@ -250,15 +251,17 @@ void SerialCouplingScheme::advance()
           getPostProcessing()->setCoarseModelOptimizationActive(&_isCoarseModelOptimizationActive);
         }
 
+        // in pipelined mode, work which does not modify the sent values is done after sending them
+        const bool deferred = not doOnlySolverEvaluation && isPostProcessingDeferred(convergence);
+
         // for multi-level case, i.e., manifold mapping: after convergence of coarse problem
         // we only want to evaluate the fine model for the new input, no post-processing etc..
         if (not doOnlySolverEvaluation)
         {
           // coupling iteration converged for current time step. Advance in time.
           if (convergence) {
-            if (getPostProcessing().get() != nullptr) {
-              _deletedColumnsPPFiltering = getPostProcessing()->getDeletedColumns();
-              getPostProcessing()->iterationsConverged(getSendData());
+            if (not deferred) {
+              postProcessingIterationsConverged(getSendData());
             }
             newConvergenceMeasurements();
             timestepCompleted();
@@ -272,17 +275,8 @@ void SerialCouplingScheme::advance()
           if (convergence && (getExtrapolationOrder() > 0)) {
             extrapolateData(getSendData()); // Also stores data
           }
-          else { // Store data for conv. measurement, post-processing, or extrapolation
-            for (DataMap::value_type& pair : getSendData()) {
-              if (pair.second->oldValues.size() > 0) {
-                pair.second->oldValues.col(0) = *pair.second->values;
-              }
-            }
-            for (DataMap::value_type& pair : getReceiveData()) {
-              if (pair.second->oldValues.size() > 0) {
-                pair.second->oldValues.col(0) = *pair.second->values;
-              }
-            }
+          else if (not deferred) { // Store data for conv. measurement, post-processing, or extrapolation
+            storeOldValues();
           }
 
           /*
@@ -317,7 +311,15 @@ void SerialCouplingScheme::advance()
         getM2N()->send(_isCoarseModelOptimizationActive);
 
         sendData(getM2N());
-        
+
+        if (deferred) {
+          utils::Event e("cpl.overlappedPostProcessing");
+          if (convergence) {
+            postProcessingIterationsConverged(getSendData());
+          }
+          storeOldValues();
+        }
+
         // the second participant does not want new data in the last iteration of the last timestep
         if (isCouplingOngoing() || not convergence) {
           receiveAndSetDt();
@@ -47,6 +47,7 @@ CouplingSchemeConfiguration::CouplingSchemeConfiguration(
       TAG_MIN_ITER_CONV_MEASURE("min-iteration-convergence-measure"),
       TAG_MAX_ITERATIONS("max-iterations"),
       TAG_EXTRAPOLATION("extrapolation-order"),
+      TAG_PIPELINING("pipelining"),
       ATTR_DATA("data"),
       ATTR_MESH("mesh"),
       ATTR_PARTICIPANT("participant"),
@@ -55,6 +56,7 @@ CouplingSchemeConfiguration::CouplingSchemeConfiguration(
       ATTR_FIRST("first"),
       ATTR_SECOND("second"),
       ATTR_VALUE("value"),
+      ATTR_ENABLED("enabled"),
       ATTR_VALID_DIGITS("valid-digits"),
       ATTR_METHOD("method"),
       ATTR_LIMIT("limit"),
@@ -66,6 +68,10 @@ CouplingSchemeConfiguration::CouplingSchemeConfiguration(
       ATTR_SUFFICES("suffices"),
       ATTR_CONTROL("control"),
       ATTR_LEVEL("level"),
+      ATTR_COMPRESSION("compression"),
+      ATTR_COMPRESSION_TOLERANCE("compression-tolerance"),
+      ATTR_DELTA("delta"),
+      ATTR_DELTA_TOLERANCE("delta-tolerance"),
       VALUE_SERIAL_EXPLICIT("serial-explicit"),
       VALUE_PARALLEL_EXPLICIT("parallel-explicit"),
       VALUE_SERIAL_IMPLICIT("serial-implicit"),
@@ -73,6 +79,10 @@ CouplingSchemeConfiguration::CouplingSchemeConfiguration(
       VALUE_MULTI("multi"),
       VALUE_FIXED("fixed"),
       VALUE_FIRST_PARTICIPANT("first-participant"),
+      VALUE_NONE("none"),
+      VALUE_LOSSLESS("lossless"),
+      VALUE_FLOAT("float"),
+      VALUE_QUANTIZE("quantize"),
       _config(),
       _meshConfig(meshConfig),
       _m2nConfig(m2nConfig),
@@ -213,11 +223,22 @@ void CouplingSchemeConfiguration::xmlTagCallback(
     assertion(_config.type == VALUE_SERIAL_IMPLICIT || _config.type == VALUE_PARALLEL_IMPLICIT || _config.type == VALUE_MULTI);
     addMinIterationConvergenceMeasure(dataName, meshName, minIterations, suffices, level);
   } else if (tag.getName() == TAG_EXCHANGE) {
-    std::string   nameData            = tag.getStringAttributeValue(ATTR_DATA);
-    std::string   nameMesh            = tag.getStringAttributeValue(ATTR_MESH);
-    std::string   nameParticipantFrom = tag.getStringAttributeValue(ATTR_FROM);
-    std::string   nameParticipantTo   = tag.getStringAttributeValue(ATTR_TO);
-    bool          initialize          = tag.getBooleanAttributeValue(ATTR_INITIALIZE);
+    std::string   nameData             = tag.getStringAttributeValue(ATTR_DATA);
+    std::string   nameMesh             = tag.getStringAttributeValue(ATTR_MESH);
+    std::string   nameParticipantFrom  = tag.getStringAttributeValue(ATTR_FROM);
+    std::string   nameParticipantTo    = tag.getStringAttributeValue(ATTR_TO);
+    bool          initialize           = tag.getBooleanAttributeValue(ATTR_INITIALIZE);
+    std::string   compressionType      = tag.getStringAttributeValue(ATTR_COMPRESSION);
+    double        compressionTolerance = tag.getDoubleAttributeValue(ATTR_COMPRESSION_TOLERANCE);
+    bool          delta                = tag.getBooleanAttributeValue(ATTR_DELTA);
+    double        deltaTolerance       = tag.getDoubleAttributeValue(ATTR_DELTA_TOLERANCE);
+    CHECK(compressionType != VALUE_QUANTIZE || compressionTolerance > 0.0,
+          "The compression \"" << VALUE_QUANTIZE << "\" of data \"" << nameData
+                                << "\" requires a positive compression tolerance.");
+    CHECK(deltaTolerance >= 0.0,
+          "The delta tolerance of data \"" << nameData << "\" must not be negative.");
+    m2n::Compression compression(m2n::Compression::parseType(compressionType), compressionTolerance,
+                                 delta, deltaTolerance);
     mesh::PtrData exchangeData;
     mesh::PtrMesh exchangeMesh;
     for (mesh::PtrMesh mesh : _meshConfig->meshes()) {
@@ -240,13 +261,16 @@ void CouplingSchemeConfiguration::xmlTagCallback(
     _meshConfig->addNeededMesh(nameParticipantFrom, nameMesh);
     _meshConfig->addNeededMesh(nameParticipantTo, nameMesh);
     _config.exchanges.push_back(std::make_tuple(exchangeData, exchangeMesh,
-                                                nameParticipantFrom, nameParticipantTo, initialize));
+                                                nameParticipantFrom, nameParticipantTo, initialize, compression));
   } else if (tag.getName() == TAG_MAX_ITERATIONS) {
     assertion(_config.type == VALUE_SERIAL_IMPLICIT || _config.type == VALUE_PARALLEL_IMPLICIT || _config.type == VALUE_MULTI);
     _config.maxIterations = tag.getIntAttributeValue(ATTR_VALUE);
   } else if (tag.getName() == TAG_EXTRAPOLATION) {
     assertion(_config.type == VALUE_SERIAL_IMPLICIT || _config.type == VALUE_PARALLEL_IMPLICIT || _config.type == VALUE_MULTI);
     _config.extrapolationOrder = tag.getIntAttributeValue(ATTR_VALUE);
+  } else if (tag.getName() == TAG_PIPELINING) {
+    assertion(_config.type == VALUE_SERIAL_IMPLICIT || _config.type == VALUE_PARALLEL_IMPLICIT);
+    _config.pipelining = tag.getBooleanAttributeValue(ATTR_ENABLED);
   }
 }
 
@@ -364,6 +388,7 @@ void CouplingSchemeConfiguration::addTypespecifcSubtags(
     addTagMinIterationConvergenceMeasure(tag);
     addTagMaxIterations(tag);
     addTagExtrapolation(tag);
+    addTagPipelining(tag);
   } else if (type == VALUE_MULTI) {
     addTagParticipant(tag);
     addTagExchange(tag);
@@ -384,6 +409,7 @@ void CouplingSchemeConfiguration::addTypespecifcSubtags(
     addTagMinIterationConvergenceMeasure(tag);
     addTagMaxIterations(tag);
     addTagExtrapolation(tag);
+    addTagPipelining(tag);
   } else {
     ERROR("Unknown coupling scheme type!");
   }
@@ -461,6 +487,34 @@ void CouplingSchemeConfiguration::addTagExchange(
   XMLAttribute<bool> attrInitialize(ATTR_INITIALIZE);
   attrInitialize.setDefaultValue(false);
   tagExchange.addAttribute(attrInitialize);
+  XMLAttribute<std::string> attrCompression(ATTR_COMPRESSION);
+  attrCompression.setDocumentation(
+      "Encoding of the data values for the exchange. \"lossless\" compresses smooth fields without "
+      "any error, \"float\" sends single precision values, and \"quantize\" rounds the values "
+      "with an absolute error bounded by the compression tolerance.");
+  attrCompression.setDefaultValue(VALUE_NONE);
+  ValidatorEquals<std::string> validNone(VALUE_NONE);
+  ValidatorEquals<std::string> validLossless(VALUE_LOSSLESS);
+  ValidatorEquals<std::string> validFloat(VALUE_FLOAT);
+  ValidatorEquals<std::string> validQuantize(VALUE_QUANTIZE);
+  attrCompression.setValidator(validNone || validLossless || validFloat || validQuantize);
+  tagExchange.addAttribute(attrCompression);
+  XMLAttribute<double> attrCompressionTolerance(ATTR_COMPRESSION_TOLERANCE);
+  attrCompressionTolerance.setDocumentation(
+      "Maximal absolute error of the data values for the compression \"quantize\".");
+  attrCompressionTolerance.setDefaultValue(0.0);
+  tagExchange.addAttribute(attrCompressionTolerance);
+  XMLAttribute<bool> attrDelta(ATTR_DELTA);
+  attrDelta.setDocumentation(
+      "If true, only blocks of values which changed by more than the delta tolerance since the last "
+      "exchange are sent. This saves bandwidth when parts of the interface converge early.");
+  attrDelta.setDefaultValue(false);
+  tagExchange.addAttribute(attrDelta);
+  XMLAttribute<double> attrDeltaTolerance(ATTR_DELTA_TOLERANCE);
+  attrDeltaTolerance.setDocumentation(
+      "Maximal absolute change of the values of a block, which is not sent in the delta exchange.");
+  attrDeltaTolerance.setDefaultValue(0.0);
+  tagExchange.addAttribute(attrDeltaTolerance);
   tag.addSubtag(tagExchange);
 }
 
@@ -549,6 +603,21 @@ void CouplingSchemeConfiguration::addTagExtrapolation(
   tag.addSubtag(tagExtrapolation);
 }
 
+void CouplingSchemeConfiguration::addTagPipelining(
+    xml::XMLTag &tag)
+{
+  using namespace xml;
+  XMLTag             tagPipelining(*this, TAG_PIPELINING, XMLTag::OCCUR_NOT_OR_ONCE);
+  XMLAttribute<bool> attrEnabled(ATTR_ENABLED);
+  tagPipelining.addAttribute(attrEnabled);
+  tagPipelining.setDocumentation(
+      "If enabled, the second participant sends convergence and data as soon as the sent values "
+      "are final. Bookkeeping of the post-processing after convergence and storing of old values "
+      "is then done while the data is in flight and the first participant continues. "
+      "Not available with manifold mapping.");
+  tag.addSubtag(tagPipelining);
+}
+
 void CouplingSchemeConfiguration::addTagPostProcessing(
     xml::XMLTag &tag)
 {
@@ -704,6 +773,13 @@ PtrCouplingScheme CouplingSchemeConfiguration::createSerialImplicitCouplingSchem
     }
     scheme->setIterationPostProcessing(_postProcConfig->getPostProcessing());
   }
+
+  if (_config.pipelining) {
+    CHECK(_postProcConfig->getCoarseModelOptimizationConfig().get() == nullptr ||
+              _postProcConfig->getCoarseModelOptimizationConfig()->getPostProcessing().get() == nullptr,
+          "Pipelining of the coupling scheme is not available with manifold mapping!");
+    scheme->setPipelining(true);
+  }
   return PtrCouplingScheme(scheme);
 }
 
@@ -745,6 +821,13 @@ PtrCouplingScheme CouplingSchemeConfiguration::createParallelImplicitCouplingSch
     }
     scheme->setIterationPostProcessing(_postProcConfig->getPostProcessing());
   }
+
+  if (_config.pipelining) {
+    CHECK(_postProcConfig->getCoarseModelOptimizationConfig().get() == nullptr ||
+              _postProcConfig->getCoarseModelOptimizationConfig()->getPostProcessing().get() == nullptr,
+          "Pipelining of the coupling scheme is not available with manifold mapping!");
+    scheme->setPipelining(true);
+  }
   return PtrCouplingScheme(scheme);
 }
 
@@ -849,11 +932,12 @@ void CouplingSchemeConfiguration::addDataToBeExchanged(
       throw std::string("Participant \"" + to + "\" is not configured for coupling scheme");
     }
 
-    bool initialize = get<4>(tuple);
+    bool                    initialize  = get<4>(tuple);
+    const m2n::Compression &compression = get<5>(tuple);
     if (from == accessor) {
-      scheme.addDataToSend(data, mesh, initialize);
+      scheme.addDataToSend(data, mesh, initialize, compression);
     } else if (to == accessor) {
-      scheme.addDataToReceive(data, mesh, initialize);
+      scheme.addDataToReceive(data, mesh, initialize, compression);
     } else {
       assertion(_config.type == VALUE_MULTI);
     }
@@ -880,7 +964,8 @@ void CouplingSchemeConfiguration::addMultiDataToBeExchanged(
       throw std::string("Participant \"" + to + "\" is not configured for coupling scheme");
     }
 
-    bool initialize = get<4>(tuple);
+    bool                    initialize  = get<4>(tuple);
+    const m2n::Compression &compression = get<5>(tuple);
     if (from == accessor) {
       size_t index = 0;
       for (const std::string &participant : _config.participants) {
@@ -891,7 +976,7 @@ void CouplingSchemeConfiguration::addMultiDataToBeExchanged(
         index++;
       }
       assertion(index < _config.participants.size(), index, _config.participants.size());
-      scheme.addDataToSend(data, mesh, initialize, index);
+      scheme.addDataToSend(data, mesh, initialize, index, compression);
     } else {
       size_t index = 0;
       for (const std::string &participant : _config.participants) {
@@ -902,7 +987,7 @@ void CouplingSchemeConfiguration::addMultiDataToBeExchanged(
         index++;
       }
       assertion(index < _config.participants.size(), index, _config.participants.size());
-      scheme.addDataToReceive(data, mesh, initialize, index);
+      scheme.addDataToReceive(data, mesh, initialize, index, compression);
     }
   }
 }
@@ -9,6 +9,7 @@
 #include "cplscheme/SharedPointer.hpp"
 #include "cplscheme/impl/SharedPointer.hpp"
 #include "logging/Logger.hpp"
+#include "m2n/Compression.hpp"
 #include "m2n/config/M2NConfiguration.hpp"
 #include "mesh/SharedPointer.hpp"
 #include "precice/config/SharedPointer.hpp"
@@ -96,6 +97,7 @@ private:
   const std::string TAG_MIN_ITER_CONV_MEASURE;
   const std::string TAG_MAX_ITERATIONS;
   const std::string TAG_EXTRAPOLATION;
+  const std::string TAG_PIPELINING;
 
   const std::string ATTR_DATA;
   const std::string ATTR_MESH;
@@ -105,6 +107,7 @@ private:
   const std::string ATTR_FIRST;
   const std::string ATTR_SECOND;
   const std::string ATTR_VALUE;
+  const std::string ATTR_ENABLED;
   const std::string ATTR_VALID_DIGITS;
   const std::string ATTR_METHOD;
   const std::string ATTR_LIMIT;
@@ -116,6 +119,10 @@ private:
   const std::string ATTR_SUFFICES;
   const std::string ATTR_CONTROL;
   const std::string ATTR_LEVEL;
+  const std::string ATTR_COMPRESSION;
+  const std::string ATTR_COMPRESSION_TOLERANCE;
+  const std::string ATTR_DELTA;
+  const std::string ATTR_DELTA_TOLERANCE;
 
   const std::string VALUE_SERIAL_EXPLICIT;
   const std::string VALUE_PARALLEL_EXPLICIT;
@@ -124,6 +131,10 @@ private:
   const std::string VALUE_MULTI;
   const std::string VALUE_FIXED;
   const std::string VALUE_FIRST_PARTICIPANT;
+  const std::string VALUE_NONE;
+  const std::string VALUE_LOSSLESS;
+  const std::string VALUE_FLOAT;
+  const std::string VALUE_QUANTIZE;
 
   struct Config {
     std::string                   type;
@@ -136,13 +147,14 @@ private:
     double                        timestepLength = CouplingScheme::UNDEFINED_TIMESTEP_LENGTH;
     int                           validDigits = 16;
     constants::TimesteppingMethod dtMethod = constants::FIXED_DT;
-    /// Tuples of exchange data, mesh, and participant name.
-    typedef std::tuple<mesh::PtrData, mesh::PtrMesh, std::string, std::string, bool> Exchange;
-    std::vector<Exchange>                                                            exchanges;
+    /// Tuples of exchange data, mesh, participant names, initialization, and compression.
+    typedef std::tuple<mesh::PtrData, mesh::PtrMesh, std::string, std::string, bool, m2n::Compression> Exchange;
+    std::vector<Exchange>                                                                              exchanges;
     /// Tuples of data ID, mesh ID, and convergence measure.
     std::vector<std::tuple<int, bool, std::string, int, impl::PtrConvergenceMeasure>> convMeasures;
     int                                                                               maxIterations = -1;
     int                                                                               extrapolationOrder = 0;
+    bool                                                                              pipelining = false;
 
   } _config;
 
@@ -182,6 +194,8 @@ private:
 
   void addTagExtrapolation(xml::XMLTag &tag);
 
+  void addTagPipelining(xml::XMLTag &tag);
+
   void addTagPostProcessing(xml::XMLTag &tag);
 
   void addAbsoluteConvergenceMeasure(
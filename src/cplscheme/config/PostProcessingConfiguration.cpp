@@ -48,6 +48,7 @@ PostProcessingConfiguration::PostProcessingConfiguration(
       ATTR_IMVJCHUNKSIZE("chunk-size"),
       ATTR_RSLS_REUSEDTSTEPS("reused-timesteps-at-restart"),
       ATTR_RSSVD_TRUNCATIONEPS("truncation-threshold"),
+      ATTR_MAX_STORED_COLUMNS("max-stored-columns"),
       ATTR_PRECOND_NONCONST_TIMESTEPS("freeze-after"),
       VALUE_CONSTANT("constant"),
       VALUE_AITKEN("aitken"),
@@ -67,6 +68,7 @@ PostProcessingConfiguration::PostProcessingConfiguration(
       VALUE_ZERO_RESTART("RS-0"),
       VALUE_SVD_RESTART("RS-SVD"),
       VALUE_SLIDE_RESTART("RS-SLIDE"),
+      VALUE_MATRIX_FREE("matrix-free"),
       VALUE_NO_RESTART("no-restart"),
       _meshConfig(meshConfig),
       _postProcessing(),
@@ -237,6 +239,10 @@ void PostProcessingConfiguration::xmlTagCallback(
       _config.imvjRestartType         = impl::MVQNPostProcessing::RS_SVD;
     } else if (f == VALUE_SLIDE_RESTART) {
       _config.imvjRestartType = impl::MVQNPostProcessing::RS_SLIDE;
+    } else if (f == VALUE_MATRIX_FREE) {
+      _config.imvjMaxStoredColumns = callingTag.getIntAttributeValue(ATTR_MAX_STORED_COLUMNS);
+      CHECK(_config.imvjMaxStoredColumns > 0, "The maximal number of stored columns of IMVJ has to be positive!");
+      _config.imvjRestartType = impl::MVQNPostProcessing::MATRIX_FREE;
     } else {
       _config.imvjChunkSize = 0;
       assertion(false);
@@ -257,7 +263,9 @@ void PostProcessingConfiguration::xmlEndTagCallback(
     if (callingTag.getName() == VALUE_IQNILS || callingTag.getName() == VALUE_MVQN || callingTag.getName() == VALUE_ManifoldMapping) {
 
       // if imvj restart-mode is of type RS-SVD, max number of non-const preconditioned time steps is limited by the chunksize
-      if (callingTag.getName() == VALUE_MVQN && _config.imvjRestartType > 0)
+      // the matrix-free mode stores unscaled matrices only and does not restart
+      if (callingTag.getName() == VALUE_MVQN && _config.imvjRestartType > 0 &&
+          _config.imvjRestartType != impl::MVQNPostProcessing::MATRIX_FREE)
         if (_config.precond_nbNonConstTSteps > _config.imvjChunkSize)
           _config.precond_nbNonConstTSteps = _config.imvjChunkSize;
 
@@ -320,7 +328,8 @@ void PostProcessingConfiguration::xmlEndTagCallback(
               _config.imvjRestartType,
               _config.imvjChunkSize,
               _config.imvjRSLS_reustedTimesteps,
-              _config.imvjRSSVD_truncationEps));
+              _config.imvjRSSVD_truncationEps,
+              _config.imvjMaxStoredColumns));
 #else
       ERROR("Post processing IQN-IMVJ only works if preCICE is compiled with MPI");
 #endif
@@ -489,7 +498,8 @@ void PostProcessingConfiguration::addTypeSpecificSubtags(
     ValidatorEquals<std::string> validRS_LS(VALUE_LS_RESTART);
     ValidatorEquals<std::string> validRS_SVD(VALUE_SVD_RESTART);
     ValidatorEquals<std::string> validRS_SLIDE(VALUE_SLIDE_RESTART);
-    attrRestartName.setValidator(validNO_RS || validRS_ZERO || validRS_LS || validRS_SVD || validRS_SLIDE);
+    ValidatorEquals<std::string> validMatrixFree(VALUE_MATRIX_FREE);
+    attrRestartName.setValidator(validNO_RS || validRS_ZERO || validRS_LS || validRS_SVD || validRS_SLIDE || validMatrixFree);
     attrRestartName.setDefaultValue(VALUE_SVD_RESTART);
     tagIMVJRESTART.addAttribute(attrRestartName);
     tagIMVJRESTART.setDocumentation("Type of IMVJ restart mode that is used\n"
@@ -497,7 +507,9 @@ void PostProcessingConfiguration::addTypeSpecificSubtags(
                                     "  RS-ZERO:    IMVJ runs in restart mode. After M time steps all Jacobain information is dropped, restart with no information\n"
                                     "  RS-LS:      IMVJ runs in restart mode. After M time steps a IQN-LS like approximation for the initial guess of the Jacobian is computed.\n"
                                     "  RS-SVD:     IMVJ runs in restart mode. After M time steps a truncated SVD of the Jacobian is updated.\n"
-                                    "  RS-SLIDE:   IMVJ runs in sliding window restart mode.\n");
+                                    "  RS-SLIDE:   IMVJ runs in sliding window restart mode.\n"
+                                    "  matrix-free: IMVJ never restarts and applies the Jacobian implicitly by the stored matrices of previous time steps. "
+                                    "The matrices of the oldest time steps are dropped if more columns than max-stored-columns are stored.\n");
     XMLAttribute<int> attrChunkSize(ATTR_IMVJCHUNKSIZE);
     attrChunkSize.setDocumentation("Specifies the number of time steps M after which the IMVJ restarts, if run in restart-mode. Defaul value is M=8.");
     attrChunkSize.setDefaultValue(8);
@@ -507,9 +519,14 @@ void PostProcessingConfiguration::addTypeSpecificSubtags(
     XMLAttribute<double> attrRSSVD_truncationEps(ATTR_RSSVD_TRUNCATIONEPS);
     attrRSSVD_truncationEps.setDocumentation("If IMVJ restart-mode=RS-SVD, the truncation threshold for the updated SVD can be set.");
     attrRSSVD_truncationEps.setDefaultValue(1e-4);
+    XMLAttribute<int> attrMaxStoredColumns(ATTR_MAX_STORED_COLUMNS);
+    attrMaxStoredColumns.setDocumentation("If IMVJ restart-mode=matrix-free, the maximal number of columns stored for previous time steps. "
+                                          "Every column takes three vectors of the size of the local interface values.");
+    attrMaxStoredColumns.setDefaultValue(500);
     tagIMVJRESTART.addAttribute(attrChunkSize);
     tagIMVJRESTART.addAttribute(attrReusedTimeStepsAtRestart);
     tagIMVJRESTART.addAttribute(attrRSSVD_truncationEps);
+    tagIMVJRESTART.addAttribute(attrMaxStoredColumns);
     tag.addSubtag(tagIMVJRESTART);
 
     XMLTag            tagMaxUsedIter(*this, TAG_MAX_USED_ITERATIONS, XMLTag::OCCUR_ONCE);
@@ -73,6 +73,7 @@ private:
   const std::string ATTR_IMVJCHUNKSIZE;
   const std::string ATTR_RSLS_REUSEDTSTEPS;
   const std::string ATTR_RSSVD_TRUNCATIONEPS;
+  const std::string ATTR_MAX_STORED_COLUMNS;
   const std::string ATTR_PRECOND_NONCONST_TIMESTEPS;
 
   const std::string VALUE_CONSTANT;
@@ -93,6 +94,7 @@ private:
   const std::string VALUE_ZERO_RESTART;
   const std::string VALUE_SVD_RESTART;
   const std::string VALUE_SLIDE_RESTART;
+  const std::string VALUE_MATRIX_FREE;
   const std::string VALUE_NO_RESTART;
 
   const mesh::PtrMeshConfiguration _meshConfig;
@@ -121,6 +123,7 @@ private:
     int                   imvjRestartType = 0;
     int                   imvjChunkSize = 0;
     int                   imvjRSLS_reustedTimesteps = 0;
+    int                   imvjMaxStoredColumns = 0;
     int                   precond_nbNonConstTSteps = -1;
     double                singularityLimit= 0;
     double                imvjRSSVD_truncationEps = 0;
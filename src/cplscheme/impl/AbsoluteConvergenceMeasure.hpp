@@ -44,12 +44,19 @@ public:
     _isConvergence = false;
   }
 
-  virtual void measure(
+  virtual Eigen::VectorXd localSums(
       const Eigen::VectorXd &oldValues,
       const Eigen::VectorXd &newValues,
-      const Eigen::VectorXd &designSpecification)
+      const Eigen::VectorXd &designSpecification) const
   {
-    _normDiff      = utils::MasterSlave::l2norm((newValues - oldValues) - designSpecification);
+    Eigen::VectorXd sums(1);
+    sums(0) = utils::MasterSlave::localSquaredNorm((newValues - oldValues) - designSpecification);
+    return sums;
+  }
+
+  virtual void measureSums(const Eigen::VectorXd &sums)
+  {
+    _normDiff      = std::sqrt(sums(0));
     _isConvergence = _normDiff <= _convergenceLimit;
     //      INFO("Absolute convergence measure: "
     //                     << "two-norm differences = " << normDiff
@@ -84,10 +84,13 @@ void AitkenPostProcessing::performPostProcessing(
   if (_iterationCounter == 0) {
     _aitkenFactor = math::sign(_aitkenFactor) * std::min(_initialRelaxation, std::abs(_aitkenFactor));
   } else {
-    // compute fraction of aitken factor with residuals and residual deltas
-    double nominator   = utils::MasterSlave::dot(_residuals, residualDeltas);
-    double denominator = utils::MasterSlave::dot(residualDeltas, residualDeltas);
-    _aitkenFactor      = -_aitkenFactor * (nominator / denominator);
+    // compute fraction of aitken factor with residuals and residual deltas, reduced at once
+    Eigen::VectorXd dots(2);
+    dots << utils::MasterSlave::localDot(_residuals, residualDeltas), utils::MasterSlave::localDot(residualDeltas, residualDeltas);
+    dots                     = utils::MasterSlave::allreduceSum(dots);
+    const double nominator   = dots(0);
+    const double denominator = dots(1);
+    _aitkenFactor            = -_aitkenFactor * (nominator / denominator);
   }
 
   DEBUG("AitkenFactor: " << _aitkenFactor);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include "utils/MasterSlave.hpp"
 
 namespace precice
 {
@@ -21,6 +22,10 @@ namespace impl
  * -# call newMeasurementSeries() for one set of iterations
  * -# call measure() for convergence measurement
  * -# retrieve the convergence status via isConvergence()
+ *
+ * A measurement is split into the computation of local sums, e.g., of squared differences,
+ * and the evaluation of the sums over all ranks. This allows to reduce the sums of several
+ * measures at once, see BaseCouplingScheme::measureConvergence().
  */
 class ConvergenceMeasure
 {
@@ -37,10 +42,30 @@ public:
    * @param[in] oldValues Old iterate values.
    * @param[in] newValues New iterate values.
    */
-  virtual void measure(
+  void measure(
+      const Eigen::VectorXd &oldValues,
+      const Eigen::VectorXd &newValues,
+      const Eigen::VectorXd &designSpecification)
+  {
+    measureSums(utils::MasterSlave::allreduceSum(localSums(oldValues, newValues, designSpecification)));
+  }
+
+  /**
+   * @brief Returns the contributions of the local values to the sums the measurement is based on.
+   *
+   * @param[in] oldValues Old iterate values.
+   * @param[in] newValues New iterate values.
+   */
+  virtual Eigen::VectorXd localSums(
       const Eigen::VectorXd &oldValues,
       const Eigen::VectorXd &newValues,
-      const Eigen::VectorXd &designSpecification) = 0;
+      const Eigen::VectorXd &designSpecification) const
+  {
+    return Eigen::VectorXd();
+  }
+
+  /// Performs convergence measurement given the sums of localSums() over all ranks.
+  virtual void measureSums(const Eigen::VectorXd &sums) = 0;
 
   /// Returns true, if the last measurement indicates convergence.
   virtual bool isConvergence() const = 0;
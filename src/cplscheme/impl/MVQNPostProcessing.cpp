@@ -38,7 +38,8 @@ MVQNPostProcessing::MVQNPostProcessing(
     int               imvjRestartType,
     int               chunkSize,
     int               RSLSreusedTimesteps,
-    double            RSSVDtruncationEps)
+    double            RSSVDtruncationEps,
+    int               maxStoredColumns)
     : BaseQNPostProcessing(initialRelaxation, forceInitialRelaxation, maxIterationsUsed, timestepsReused,
                            filter, singularityLimit, dataIDs, preconditioner),
       //  _secondaryOldXTildes(),
@@ -47,6 +48,7 @@ MVQNPostProcessing::MVQNPostProcessing(
       _Wtil(),
       _WtilChunk(),
       _pseudoInverseChunk(),
+      _matrixVChunk(),
       _matrixV_RSLS(),
       _matrixW_RSLS(),
       _matrixCols_RSLS(),
@@ -59,6 +61,7 @@ MVQNPostProcessing::MVQNPostProcessing(
       _imvjRestart(false),
       _chunkSize(chunkSize),
       _RSLSreusedTimesteps(RSLSreusedTimesteps),
+      _maxStoredColumns(maxStoredColumns),
       _usedColumnsPerTstep(5),
       _nbRestarts(0),
       //_info2(),
@@ -179,7 +182,7 @@ void MVQNPostProcessing::initialize(
   _Wtil = Eigen::MatrixXd::Zero(entries, 0);
 
   if (utils::MasterSlave::_masterMode || (not utils::MasterSlave::_masterMode && not utils::MasterSlave::_slaveMode))
-    _infostringstream << " IMVJ restart mode: " << _imvjRestart << "\n chunk size: " << _chunkSize << "\n trunc eps: " << _svdJ.getThreshold() << "\n R_RS: " << _RSLSreusedTimesteps << "\n--------\n"
+    _infostringstream << " IMVJ restart mode: " << _imvjRestart << "\n chunk size: " << _chunkSize << "\n trunc eps: " << _svdJ.getThreshold() << "\n R_RS: " << _RSLSreusedTimesteps << "\n max stored cols: " << _maxStoredColumns << "\n--------\n"
                       << std::endl;
 }
 
@@ -237,15 +240,9 @@ void MVQNPostProcessing::updateDifferenceMatrices(
         //                                         |--- J_prev ---|
         // iterate over all stored Wtil and Z matrices in current chunk
         if (_imvjRestart) {
-          for (int i = 0; i < (int) _WtilChunk.size(); i++) {
-            int colsLSSystemBackThen = _pseudoInverseChunk[i].rows();
-            assertion(colsLSSystemBackThen == _WtilChunk[i].cols(), colsLSSystemBackThen, _WtilChunk[i].cols());
-            Eigen::VectorXd Zv = Eigen::VectorXd::Zero(colsLSSystemBackThen);
-            // multiply: Zv := Z^q * V(:,0) of size (m x 1)
-            _parMatrixOps->multiply(_pseudoInverseChunk[i], v, Zv, colsLSSystemBackThen, getLSSystemRows(), 1);
-            // multiply: Wtil^q * Zv  dimensions: (n x m) * (m x 1), fully local
-            wtil += _WtilChunk[i] * Zv;
-          }
+          Eigen::MatrixXd Jv;
+          multiplyPreviousJacobian(v, Jv);
+          wtil = Jv.col(0);
 
           // store columns if restart mode = RS-LS
           if (_imvjRestartType == RS_LS) {
@@ -359,15 +356,7 @@ void MVQNPostProcessing::buildWtil()
   //                                                      |--- J_prev ---|
   // iterate over all stored Wtil and Z matrices in current chunk
   if (_imvjRestart) {
-    for (int i = 0; i < (int) _WtilChunk.size(); i++) {
-      int colsLSSystemBackThen = _pseudoInverseChunk[i].rows();
-      assertion(colsLSSystemBackThen == _WtilChunk[i].cols(), colsLSSystemBackThen, _WtilChunk[i].cols());
-      Eigen::MatrixXd ZV = Eigen::MatrixXd::Zero(colsLSSystemBackThen, _qrV.cols());
-      // multiply: ZV := Z^q * V of size (m x m) with m=#cols, stored on each proc.
-      _parMatrixOps->multiply(_pseudoInverseChunk[i], _matrixV, ZV, colsLSSystemBackThen, getLSSystemRows(), _qrV.cols());
-      // multiply: Wtil^q * ZV  dimensions: (n x m) * (m x m), fully local and embarrassingly parallel
-      _Wtil += _WtilChunk[i] * ZV;
-    }
+    multiplyPreviousJacobian(_matrixV, _Wtil);
 
     // imvj without restart is used, i.e., recompute Wtil: Wtil = W - J_prev * V
   } else {
@@ -423,6 +412,87 @@ void MVQNPostProcessing::buildJacobian()
   _invJacobian = _invJacobian + _oldInvJacobian;
 }
 
+// ==================================================================================
+void MVQNPostProcessing::multiplyPreviousJacobian(
+    const Eigen::MatrixXd &matrix,
+    Eigen::MatrixXd &      result)
+{
+  TRACE();
+  assertion(_WtilChunk.size() == _pseudoInverseChunk.size(), _WtilChunk.size(), _pseudoInverseChunk.size());
+
+  result = Eigen::MatrixXd::Zero(matrix.rows(), matrix.cols());
+  int stackedRows = 0;
+  for (const Eigen::MatrixXd &Z : _pseudoInverseChunk) {
+    stackedRows += Z.rows();
+  }
+  if (stackedRows == 0) {
+    return;
+  }
+
+  // multiply: ZV := [Z^0; Z^1; ...] * V of size (sum_q m_q x cols), locally and reduced at once
+  Eigen::MatrixXd localZV(stackedRows, matrix.cols());
+  int             row = 0;
+  for (const Eigen::MatrixXd &Z : _pseudoInverseChunk) {
+    localZV.middleRows(row, Z.rows()).noalias() = Z * matrix;
+    row += Z.rows();
+  }
+  Eigen::MatrixXd ZV(stackedRows, matrix.cols());
+  if (not utils::MasterSlave::_masterMode && not utils::MasterSlave::_slaveMode) {
+    ZV = localZV;
+  } else {
+    utils::MasterSlave::allreduceSum(localZV.data(), ZV.data(), localZV.size());
+  }
+
+  // multiply: Wtil^q * (Z^q * V)  dimensions: (n x m_q) * (m_q x cols), fully local
+  row = 0;
+  for (size_t q = 0; q < _WtilChunk.size(); q++) {
+    int colsLSSystemBackThen = _pseudoInverseChunk[q].rows();
+    assertion(colsLSSystemBackThen == _WtilChunk[q].cols(), colsLSSystemBackThen, _WtilChunk[q].cols());
+    result.noalias() += _WtilChunk[q] * ZV.middleRows(row, colsLSSystemBackThen);
+    row += colsLSSystemBackThen;
+  }
+}
+
+// ==================================================================================
+void MVQNPostProcessing::dropOldestChunks()
+{
+  TRACE(_WtilChunk.size());
+  int storedColumns = 0;
+  for (const Eigen::MatrixXd &Wtil : _WtilChunk) {
+    storedColumns += Wtil.cols();
+  }
+  assertion(_matrixVChunk.size() == _WtilChunk.size(), _matrixVChunk.size(), _WtilChunk.size());
+  // the most recent time step is always kept
+  while (storedColumns > _maxStoredColumns && _WtilChunk.size() > 1) {
+    storedColumns -= _WtilChunk.front().cols();
+
+    // re-compute Wtil -- compensate for dropping of Wtil^0 and Z^0:
+    //                    Wtil^q <-- Wtil^q +  Wtil^0 * (Z^0*V^q)
+    // multiply: ZV := Z^0 * [V^1, V^2, ...] of size (m_0 x sum_q m_q), reduced at once
+    Eigen::MatrixXd V(_matrixVChunk.front().rows(), storedColumns);
+    int             col = 0;
+    for (size_t q = 1; q < _matrixVChunk.size(); q++) {
+      V.middleCols(col, _matrixVChunk[q].cols()) = _matrixVChunk[q];
+      col += _matrixVChunk[q].cols();
+    }
+    int             colsLSSystemBackThen = _pseudoInverseChunk.front().rows();
+    Eigen::MatrixXd ZV(colsLSSystemBackThen, storedColumns);
+    _parMatrixOps->multiply(_pseudoInverseChunk.front(), V, ZV, colsLSSystemBackThen, getLSSystemRows(), storedColumns);
+
+    // multiply: Wtil^0 * (Z^0*V^q)  dimensions: (n x m_0) * (m_0 x m_q), fully local
+    col = 0;
+    for (size_t q = 1; q < _WtilChunk.size(); q++) {
+      _WtilChunk[q].noalias() += _WtilChunk.front() * ZV.middleCols(col, _WtilChunk[q].cols());
+      col += _WtilChunk[q].cols();
+    }
+
+    _WtilChunk.erase(_WtilChunk.begin());
+    _pseudoInverseChunk.erase(_pseudoInverseChunk.begin());
+    _matrixVChunk.erase(_matrixVChunk.begin());
+  }
+  DEBUG("Stored columns of matrix-free IMVJ: " << storedColumns << " of " << _WtilChunk.size() << " time steps");
+}
+
 // ==================================================================================
 void MVQNPostProcessing::computeNewtonUpdateEfficient(
     PostProcessing::DataMap &cplData,
@@ -498,15 +568,9 @@ void MVQNPostProcessing::computeNewtonUpdateEfficient(
    *  where r_til = Z^q * (-res) is computed first and then xUp := Wtil^q * r_til
    */
   if (_imvjRestart) {
-    for (int i = 0; i < (int) _WtilChunk.size(); i++) {
-      int colsLSSystemBackThen = _pseudoInverseChunk[i].rows();
-      assertion(colsLSSystemBackThen == _WtilChunk[i].cols(), colsLSSystemBackThen, _WtilChunk[i].cols());
-      r_til = Eigen::VectorXd::Zero(colsLSSystemBackThen);
-      // multiply: r_til := Z^q * (-res) of size (m x 1) with m=#cols of LS at that time, result stored on each proc.
-      _parMatrixOps->multiply(_pseudoInverseChunk[i], negativeResiduals, r_til, colsLSSystemBackThen, getLSSystemRows(), 1);
-      // multiply: Wtil^q * r_til  dimensions: (n x m) * (m x 1), fully local and embarrassingly parallel
-      xUpdate += _WtilChunk[i] * r_til;
-    }
+    Eigen::MatrixXd JnegativeResiduals;
+    multiplyPreviousJacobian(negativeResiduals, JnegativeResiduals);
+    xUpdate = JnegativeResiduals.col(0);
 
     // imvj without restart is used, i.e., compute directly J_prev * (-res)
   } else {
@@ -816,9 +880,13 @@ void MVQNPostProcessing::specializedIterationsConverged(
       _pseudoInverseChunk.push_back(Z);
 
       /**
-       *  Restart the IMVJ according to restart type
+       *  Restart the IMVJ according to restart type, or only bound the
+       *  stored matrices in matrix-free mode
        */
-      if ((int) _WtilChunk.size() >= _chunkSize + 1) {
+      if (_imvjRestartType == MATRIX_FREE) {
+        _matrixVChunk.push_back(_matrixV);
+        dropOldestChunks();
+      } else if ((int) _WtilChunk.size() >= _chunkSize + 1) {
 
         // < RESTART >
         _nbRestarts++;
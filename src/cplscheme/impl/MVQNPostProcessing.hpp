@@ -38,6 +38,7 @@ public:
   static const int RS_LS      = 2;
   static const int RS_SVD     = 3;
   static const int RS_SLIDE   = 4;
+  static const int MATRIX_FREE = 5;
 
   /**
    * @brief Constructor.
@@ -55,7 +56,8 @@ public:
       int               imvjRestartType,
       int               chunkSize,
       int               RSLSreusedTimesteps,
-      double            RSSVDtruncationEps);
+      double            RSSVDtruncationEps,
+      int               maxStoredColumns);
 
   /**
     * @brief Destructor, empty.
@@ -91,6 +93,9 @@ private:
   /// @brief stores all pseudo inverses within the current chunk of the imvj restart mode, disabled if _imvjRestart = false.
   std::vector<Eigen::MatrixXd> _pseudoInverseChunk;
 
+  /// @brief stores the matrices V belonging to the pseudo inverses in the matrix-free mode, to compensate for dropped time steps.
+  std::vector<Eigen::MatrixXd> _matrixVChunk;
+
   /// @brief stores columns from previous  #_RSLSreusedTimesteps time steps if RS-LS restart-mode is active
   Eigen::MatrixXd _matrixV_RSLS;
 
@@ -123,6 +128,8 @@ private:
     *  - RS-ZERO:    imvj is run in restart-mode. After M time steps all stored matrices are dropped
     *  - RS-LS:      imvj in restart-mode. After M time steps restart with LS approximation for initial Jacobian
     *  - RS-SVD:     imvj in restart mode. After M time steps, update of an truncated SVD of the Jacobian.
+    *  - MATRIX_FREE: imvj never restarts, but drops the oldest Wtil, Z matrices if more than
+    *                 _maxStoredColumns columns are stored.
     */
   int _imvjRestartType;
 
@@ -138,6 +145,9 @@ private:
   /// @brief: Number of reused time steps at restart if restart-mode = RS-LS
   int _RSLSreusedTimesteps;
 
+  /// @brief: Maximal number of columns of all stored Wtil and Z matrices if restart-mode = MATRIX_FREE
+  int _maxStoredColumns;
+
   /// @brief: Number of used columns per time step. Always the first _usedColumnsPerTstep are used.
   int _usedColumnsPerTstep;
 
@@ -186,6 +196,17 @@ private:
     */
   void buildJacobian();
 
+  /** @brief: multiplies the Jacobian of the previous time steps, given implicitly by the stored
+    *  Wtil and Z matrices, with the matrix, i.e., result = sum_q [ Wtil^q * (Z^q * matrix) ].
+    *  The products of all Z^q are reduced over the ranks at once.
+    */
+  void multiplyPreviousJacobian(const Eigen::MatrixXd &matrix, Eigen::MatrixXd &result);
+
+  /** @brief: drops the oldest Wtil and Z matrices until at most _maxStoredColumns columns are stored.
+    *  As in the RS-SLIDE restart, the remaining Wtil matrices compensate for each dropped pair.
+    */
+  void dropOldestChunks();
+
   /** @brief: re-computes the matrix _Wtil = ( W - J_prev * V) instead of updating it according to V
     */
   void buildWtil();
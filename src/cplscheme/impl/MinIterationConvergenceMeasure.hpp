@@ -20,10 +20,7 @@ public:
 
   virtual void newMeasurementSeries();
 
-  virtual void measure(
-      const Eigen::VectorXd &oldValues,
-      const Eigen::VectorXd &newValues,
-      const Eigen::VectorXd &designSpecification)
+  virtual void measureSums(const Eigen::VectorXd &sums)
   {
     TRACE();
     _currentIteration++;
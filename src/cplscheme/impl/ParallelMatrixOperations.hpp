@@ -8,6 +8,8 @@
 #include "utils/MasterSlave.hpp"
 #include "utils/assertion.hpp"
 #include <Eigen/Core>
+#include <utility>
+#include <vector>
 
 namespace precice
 {
@@ -137,81 +139,77 @@ private:
     assertion(leftMatrix.rows() == rightMatrix.cols(), leftMatrix.rows(), rightMatrix.cols());
     assertion(result.rows() == p, result.rows(), p);
 
-    //int nextProc = (utils::MasterSlave::_rank + 1) % utils::MasterSlave::_size;
-    int prevProc = (utils::MasterSlave::_rank - 1 < 0) ? utils::MasterSlave::_size - 1 : utils::MasterSlave::_rank - 1;
-    int rows_rcv = (prevProc > 0) ? offsets[prevProc + 1] - offsets[prevProc] : offsets[1];
-    //Eigen::MatrixXd leftMatrix_rcv = Eigen::MatrixXd::Zero(rows_rcv, q);
-    Eigen::MatrixXd leftMatrix_rcv(rows_rcv, q);
+    const int rank = utils::MasterSlave::_rank;
+    const int size = utils::MasterSlave::_size;
+
+    // proc that owned the block of leftMatrix (W_til) at the very beginning, which is multiplied in the given cycle
+    auto sourceProc = [rank, size](int cycle) { return (rank - cycle + size) % size; };
+    auto localRows  = [&offsets](int proc) { return offsets[proc + 1] - offsets[proc]; };
+
+    // The blocks of the current and the next cycle are double-buffered, such that the communication
+    // of the next cycle runs while the current block is multiplied. The buffers keep their capacity
+    // over all cycles and calls.
+    std::vector<double> *current     = &_cyclicBuffers[0];
+    std::vector<double> *next        = &_cyclicBuffers[1];
+    int                  rowsCurrent = 0;
 
     com::PtrRequest requestSend;
     com::PtrRequest requestRcv;
 
-    // initiate asynchronous send operation of leftMatrix (W_til) --> nextProc (this data is needed in cycle 1)    dim: n_local x cols
-    if (leftMatrix.size() > 0)
-      requestSend = _cyclicCommRight->aSend(leftMatrix.data(), leftMatrix.size(), 0);
+    if (size > 1) {
+      // initiate asynchronous send operation of leftMatrix (W_til) --> nextProc (this data is needed in cycle 1)    dim: n_local x cols
+      if (leftMatrix.size() > 0)
+        requestSend = _cyclicCommRight->aSend(leftMatrix.data(), leftMatrix.size(), 0);
 
-    // initiate asynchronous receive operation for leftMatrix (W_til) from previous processor --> W_til      dim: rows_rcv x cols
-    if (leftMatrix_rcv.size() > 0)
-      requestRcv = _cyclicCommLeft->aReceive(leftMatrix_rcv.data(), leftMatrix_rcv.size(), 0);
+      // initiate asynchronous receive operation for leftMatrix (W_til) from previous processor --> W_til      dim: rows_rcv x cols
+      rowsCurrent = localRows(sourceProc(1));
+      current->resize(rowsCurrent * q);
+      if (not current->empty())
+        requestRcv = _cyclicCommLeft->aReceive(current->data(), current->size(), 0);
+    }
 
     // compute diagonal blocks where all data is local and no communication is needed
     // compute block matrices of J_inv of size (n_til x n_til), n_til = local n
-    Eigen::MatrixXd diagBlock(leftMatrix.rows(), leftMatrix.rows());
-    diagBlock.noalias() = leftMatrix * rightMatrix;
-
-    // set block at corresponding row-index on proc
-    int off = offsets[utils::MasterSlave::_rank];
-    assertion(result.cols() == diagBlock.cols(), result.cols(), diagBlock.cols());
-    result.block(off, 0, diagBlock.rows(), diagBlock.cols()) = diagBlock;
+    assertion(result.cols() == rightMatrix.cols(), result.cols(), rightMatrix.cols());
+    result.block(offsets[rank], 0, leftMatrix.rows(), result.cols()).noalias() = leftMatrix * rightMatrix;
 
     /**
-		 * cyclic send-receive operation
-		 */
-    for (int cycle = 1; cycle < utils::MasterSlave::_size; cycle++) {
+     * cyclic send-receive operation
+     */
+    for (int cycle = 1; cycle < size; cycle++) {
 
-      // wait until W_til from previous processor is fully received
-      if (requestSend != NULL)
+      // wait until W_til from previous processor is fully received and the previous block is handed over
+      if (requestSend != nullptr) {
         requestSend->wait();
-      if (requestRcv != NULL)
+        requestSend = nullptr;
+      }
+      if (requestRcv != nullptr) {
         requestRcv->wait();
-
-      // leftMatrix (leftMatrix_rcv) is available - needed for local multiplication and hand over to next proc
-      Eigen::MatrixXd leftMatrix_copy(leftMatrix_rcv);
-
-      // initiate async send to hand over leftMatrix (W_til) to the next proc (this data will be needed in the next cycle)    dim: n_local x cols
-      if (cycle < utils::MasterSlave::_size - 1) {
-        if (leftMatrix_copy.size() > 0)
-          requestSend = _cyclicCommRight->aSend(leftMatrix_copy.data(), leftMatrix_copy.size(), 0);
+        requestRcv = nullptr;
       }
 
-      // compute proc that owned leftMatrix_rcv (Wtil_rcv) at the very beginning for each cylce
-      int sourceProc_nextCycle = (utils::MasterSlave::_rank - (cycle + 1) < 0) ? utils::MasterSlave::_size + (utils::MasterSlave::_rank - (cycle + 1)) : utils::MasterSlave::_rank - (cycle + 1);
-
-      int sourceProc = (utils::MasterSlave::_rank - cycle < 0) ? utils::MasterSlave::_size + (utils::MasterSlave::_rank - cycle) : utils::MasterSlave::_rank - cycle;
-
-      int rows_rcv_nextCycle = (sourceProc_nextCycle > 0) ? offsets[sourceProc_nextCycle + 1] - offsets[sourceProc_nextCycle] : offsets[1];
-      rows_rcv               = (sourceProc > 0) ? offsets[sourceProc + 1] - offsets[sourceProc] : offsets[1];
-      leftMatrix_rcv         = Eigen::MatrixXd::Zero(rows_rcv_nextCycle, q);
-
-      // initiate asynchronous receive operation for leftMatrix (W_til) from previous processor --> W_til (this data is needed in the next cycle)
-      if (cycle < utils::MasterSlave::_size - 1) {
-        if (leftMatrix_rcv.size() > 0) // only receive data, if data has been sent
-          requestRcv = _cyclicCommLeft->aReceive(leftMatrix_rcv.data(), leftMatrix_rcv.size(), 0);
+      // hand over the received block to the next proc and receive the block of the next cycle,
+      // before the received block is multiplied
+      int rowsNext = 0;
+      if (cycle < size - 1) {
+        if (not current->empty())
+          requestSend = _cyclicCommRight->aSend(current->data(), current->size(), 0);
+
+        rowsNext = localRows(sourceProc(cycle + 1));
+        next->resize(rowsNext * q);
+        if (not next->empty()) // only receive data, if data has been sent
+          requestRcv = _cyclicCommLeft->aReceive(next->data(), next->size(), 0);
       }
 
-      if (requestSend != NULL)
-        requestSend->wait();
-      // compute block with new local data
-      Eigen::MatrixXd block(rows_rcv, rightMatrix.cols());
-      block.noalias() = leftMatrix_copy * rightMatrix;
-
       // set block at corresponding index in J_inv
       // the row-offset of the current block is determined by the proc that sends the part of the W_til matrix
       // note: the direction and ordering of the cyclic sending operation is chosen s.t. the computed block is
       //       local on the current processor (in J_inv).
-      off = offsets[sourceProc];
-      assertion(result.cols() == block.cols(), result.cols(), block.cols());
-      result.block(off, 0, block.rows(), block.cols()) = block;
+      Eigen::Map<const Eigen::MatrixXd> block(current->data(), rowsCurrent, q);
+      result.block(offsets[sourceProc(cycle)], 0, rowsCurrent, result.cols()).noalias() = block * rightMatrix;
+
+      std::swap(current, next);
+      rowsCurrent = rowsNext;
     }
   }
 
@@ -312,6 +310,9 @@ private:
   com::PtrCommunication _cyclicCommRight = nullptr;
 
   bool _needCycliclComm = true;
+
+  /// Receive buffers of the blocks of the left matrix passed around in the cyclic multiplication.
+  std::vector<double> _cyclicBuffers[2];
 };
 }
 }
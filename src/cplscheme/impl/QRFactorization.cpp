@@ -332,18 +332,16 @@ int QRFactorization::orthogonalize(
   while (!termination) {
 
     // take a gram-schmidt iteration
+    // dot products <_Q(:,j), v> =: r_ij of all columns by one distributed reduction, saved in s = column of R
     u = Eigen::VectorXd::Zero(_rows);
     for (int j = 0; j < colNum; j++) {
-
-      // dot-product <_Q(:,j), v >
       Eigen::VectorXd Qc = _Q.col(j);
-
-      // dot product <_Q(:,j), v> =: r_ij
-      double r_ij = utils::MasterSlave::dot(Qc, v);
-      // save r_ij in s(j) = column of R
-      s(j) = r_ij;
+      s(j)               = utils::MasterSlave::localDot(Qc, v);
+    }
+    s = utils::MasterSlave::allreduceSum(s);
+    for (int j = 0; j < colNum; j++) {
       // u is the sum of projections r_ij * _Q(:,j) =  _Q(:,j) * <_Q(:,j), v>
-      u += _Q.col(j) * r_ij;
+      u += _Q.col(j) * s(j);
     }
     // add the furier coefficients over all orthogonalize iterations
     for (int j = 0; j < colNum; j++) {
@@ -354,10 +352,13 @@ int QRFactorization::orthogonalize(
       v(i) = v(i) - u(i);
     }
     // rho1 = norm of orthogonalized new column v_tilde (though not normalized)
-    rho1 = utils::MasterSlave::l2norm(v); // distributed l2norm
-
     // t = norm of r_(:,j) with j = colNum-1
-    double norm_coefficients = utils::MasterSlave::l2norm(s); // distributed l2norm
+    // Both distributed l2norms by one reduction
+    Eigen::VectorXd squaredNorms(2);
+    squaredNorms << utils::MasterSlave::localSquaredNorm(v), utils::MasterSlave::localSquaredNorm(s);
+    squaredNorms             = utils::MasterSlave::allreduceSum(squaredNorms);
+    rho1                     = std::sqrt(squaredNorms(0));
+    double norm_coefficients = std::sqrt(squaredNorms(1));
     k++;
 
     // treat the special case m=n
@@ -452,22 +453,17 @@ int QRFactorization::orthogonalize_stable(
   int k = 0;
   while (!termination) {
     // take a gram-schmidt iteration, ignoring r on later steps if previous v was null
+    // dot products <_Q(:,j), v> =: r_ij of all columns by one distributed reduction, saved in s = column of R
     u = Eigen::VectorXd::Zero(_rows);
     for (int j = 0; j < colNum; j++) {
-
-      /*
-			 * dot-product <_Q(:,j), v >
-			 */
       Eigen::VectorXd Qc = _Q.col(j);
-
-      // dot product <_Q(:,j), v> =: r_ij
-      double ss = utils::MasterSlave::dot(Qc, v);
-      t         = ss;
-      // save r_ij in s(j) = column of R
-      s(j) = t;
+      s(j)               = utils::MasterSlave::localDot(Qc, v);
+    }
+    s = utils::MasterSlave::allreduceSum(s);
+    for (int j = 0; j < colNum; j++) {
       // u is the sum of projections r_ij * _Q(i,:) =  _Q(i,:) * <_Q(:,j), v>
       for (int i = 0; i < _rows; i++) {
-        u(i) = u(i) + _Q(i, j) * t;
+        u(i) = u(i) + _Q(i, j) * s(j);
       }
     }
     if (!null) {
@@ -481,10 +477,13 @@ int QRFactorization::orthogonalize_stable(
       v(i) = v(i) - u(i);
     }
     // rho1 = norm of orthogonalized new column v_tilde (though not normalized)
-    rho1 = utils::MasterSlave::l2norm(v); // distributed l2norm
-
     // t = norm of r_(:,j) with j = colNum-1
-    t = utils::MasterSlave::l2norm(s); // distributed l2norm
+    // Both distributed l2norms by one reduction
+    Eigen::VectorXd squaredNorms(2);
+    squaredNorms << utils::MasterSlave::localSquaredNorm(v), utils::MasterSlave::localSquaredNorm(s);
+    squaredNorms = utils::MasterSlave::allreduceSum(squaredNorms);
+    rho1         = std::sqrt(squaredNorms(0));
+    t            = std::sqrt(squaredNorms(1));
     k++;
 
     // treat the special case m=n
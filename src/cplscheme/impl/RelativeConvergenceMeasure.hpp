@@ -56,21 +56,21 @@ public:
     _isConvergence = false;
   }
 
-  virtual void measure(
+  virtual Eigen::VectorXd localSums(
       const Eigen::VectorXd &oldValues,
       const Eigen::VectorXd &newValues,
-      const Eigen::VectorXd &designSpecification)
+      const Eigen::VectorXd &designSpecification) const
   {
-    /*
-     std::cout<<"\n-------"<<std::endl;
-     std::cout<<"   old val: \n"<<oldValues<<std::endl;
-     std::cout<<"   new val: \n"<<newValues<<"\n"<<std::endl;
-     std::cout<<"   design spec: \n"<<designSpecification<<"\n"<<std::endl;
-     std::cout<<"-------\n"<<std::endl;
-*/
-
-    _normDiff      = utils::MasterSlave::l2norm((newValues - oldValues) - designSpecification);
-    _norm          = utils::MasterSlave::l2norm(newValues + designSpecification);
+    Eigen::VectorXd sums(2);
+    sums(0) = utils::MasterSlave::localSquaredNorm((newValues - oldValues) - designSpecification);
+    sums(1) = utils::MasterSlave::localSquaredNorm(newValues + designSpecification);
+    return sums;
+  }
+
+  virtual void measureSums(const Eigen::VectorXd &sums)
+  {
+    _normDiff      = std::sqrt(sums(0));
+    _norm          = std::sqrt(sums(1));
     _isConvergence = _normDiff <= _norm * _convergenceLimitPercent;
     //      INFO("Relative convergence measure: "
     //                    << "two-norm differences = " << normDiff
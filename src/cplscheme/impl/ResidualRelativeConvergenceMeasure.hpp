@@ -45,12 +45,19 @@ public:
     _normFirstResidual = std::numeric_limits<double>::max();
   }
 
-  virtual void measure(
+  virtual Eigen::VectorXd localSums(
       const Eigen::VectorXd &oldValues,
       const Eigen::VectorXd &newValues,
-      const Eigen::VectorXd &designSpecification)
+      const Eigen::VectorXd &designSpecification) const
   {
-    _normDiff = utils::MasterSlave::l2norm((newValues - oldValues) - designSpecification);
+    Eigen::VectorXd sums(1);
+    sums(0) = utils::MasterSlave::localSquaredNorm((newValues - oldValues) - designSpecification);
+    return sums;
+  }
+
+  virtual void measureSums(const Eigen::VectorXd &sums)
+  {
+    _normDiff = std::sqrt(sums(0));
     if (_isFirstIteration) {
       _normFirstResidual = _normDiff;
       _isFirstIteration  = false;
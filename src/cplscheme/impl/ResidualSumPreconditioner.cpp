@@ -31,16 +31,18 @@ void ResidualSumPreconditioner::_update_(bool timestepComplete,
 
     double sum = 0.0;
 
-    int offset = 0;
+    // Distributed squared l2norms of all sub-vectors by one reduction
+    Eigen::VectorXd squaredNorms(_subVectorSizes.size());
+    int             offset = 0;
     for (size_t k = 0; k < _subVectorSizes.size(); k++) {
-      Eigen::VectorXd part = Eigen::VectorXd::Zero(_subVectorSizes[k]);
-      for (size_t i = 0; i < _subVectorSizes[k]; i++) {
-        part(i) = res(i + offset);
-      }
-      norms[k] = utils::MasterSlave::dot(part, part);
-      sum += norms[k];
+      Eigen::VectorXd part = res.segment(offset, _subVectorSizes[k]);
+      squaredNorms(k)      = utils::MasterSlave::localDot(part, part);
       offset += _subVectorSizes[k];
-      norms[k] = std::sqrt(norms[k]);
+    }
+    squaredNorms = utils::MasterSlave::allreduceSum(squaredNorms);
+    for (size_t k = 0; k < _subVectorSizes.size(); k++) {
+      sum += squaredNorms(k);
+      norms[k] = std::sqrt(squaredNorms(k));
     }
     sum = std::sqrt(sum);
     assertion(sum > 0);
@@ -23,14 +23,17 @@ void ValuePreconditioner::_update_(bool timestepComplete,
 
     std::vector<double> norms(_subVectorSizes.size(), 0.0);
 
-    int offset = 0;
+    // Distributed l2norms of all sub-vectors by one reduction
+    Eigen::VectorXd squaredNorms(_subVectorSizes.size());
+    int             offset = 0;
     for (size_t k = 0; k < _subVectorSizes.size(); k++) {
-      Eigen::VectorXd part = Eigen::VectorXd::Zero(_subVectorSizes[k]);
-      for (size_t i = 0; i < _subVectorSizes[k]; i++) {
-        part(i) = oldValues(i + offset);
-      }
-      norms[k] = utils::MasterSlave::l2norm(part);
+      Eigen::VectorXd part = oldValues.segment(offset, _subVectorSizes[k]);
+      squaredNorms(k)      = utils::MasterSlave::localSquaredNorm(part);
       offset += _subVectorSizes[k];
+    }
+    squaredNorms = utils::MasterSlave::allreduceSum(squaredNorms);
+    for (size_t k = 0; k < _subVectorSizes.size(); k++) {
+      norms[k] = std::sqrt(squaredNorms(k));
       assertion(norms[k] > 0.0);
     }
 
@@ -0,0 +1,138 @@
+#include "LinearCoupling.hpp"
+#include <cmath>
+#include <map>
+#include <memory>
+#include "cplscheme/Constants.hpp"
+#include "cplscheme/CouplingData.hpp"
+#include "cplscheme/ParallelCouplingScheme.hpp"
+#include "cplscheme/SerialCouplingScheme.hpp"
+#include "cplscheme/impl/AbsoluteConvergenceMeasure.hpp"
+#include "cplscheme/impl/ConstantPreconditioner.hpp"
+#include "cplscheme/impl/IQNILSPostProcessing.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Mesh.hpp"
+#include "utils/Parallel.hpp"
+
+namespace precice {
+namespace cplscheme {
+namespace tests {
+
+LinearRun runLinearPostProcessing(impl::PostProcessing &postProcessing)
+{
+  const int       n = 8;
+  Eigen::MatrixXd A(n, n);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      A(i, j) = 0.3 * std::sin(1.0 + i * i + 2.0 * j + 0.5 * i * j);
+    }
+  }
+
+  mesh::PtrMesh   dummyMesh(new mesh::Mesh("DummyMesh", 3, false));
+  Eigen::VectorXd values = Eigen::VectorXd::Zero(n);
+  PtrCouplingData data(new CouplingData(&values, dummyMesh, false, 1));
+  std::map<int, PtrCouplingData> dataMap;
+  dataMap.insert(std::make_pair(0, data));
+  postProcessing.initialize(dataMap);
+
+  LinearRun       run;
+  Eigen::VectorXd x = Eigen::VectorXd::Zero(n);
+  for (int timestep = 0; timestep < 6; timestep++) {
+    Eigen::VectorXd b = Eigen::VectorXd::LinSpaced(n, 1.0, 2.0) * (1.0 + 0.1 * timestep);
+    int iteration = 0;
+    for (; iteration < 30; iteration++) {
+      data->oldValues.col(0) = x;
+      values                 = A * x + b;
+      if ((values - x).norm() < 1e-9) {
+        break;
+      }
+      postProcessing.performPostProcessing(dataMap);
+      x = values;
+      run.iterates.push_back(x);
+    }
+    postProcessing.iterationsConverged(dataMap);
+    x = values;
+    run.iterations.push_back(iteration);
+    run.converged.push_back(x);
+  }
+  return run;
+}
+
+LinearRun runLinearCoupling(m2n::PtrM2N m2n, bool parallel, bool pipelining)
+{
+  const int     size = 20;
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 3, false));
+  const int     dataID0 = mesh->createData("Data0", 1)->getID();
+  const int     dataID1 = mesh->createData("Data1", 1)->getID();
+  for (int i = 0; i < size; i++) {
+    mesh->createVertex(Eigen::Vector3d::Constant(i));
+  }
+  mesh->allocateDataValues();
+  auto &values0 = mesh->data(dataID0)->values();
+  auto &values1 = mesh->data(dataID1)->values();
+
+  const bool  first = utils::Parallel::getProcessRank() == 0;
+  std::string nameLocalParticipant(first ? "Participant0" : "Participant1");
+  std::unique_ptr<BaseCouplingScheme> cplScheme;
+  if (parallel) {
+    cplScheme.reset(new ParallelCouplingScheme(
+        1.0, 4, 0.1, 16, "Participant0", "Participant1", nameLocalParticipant, m2n,
+        constants::FIXED_DT, BaseCouplingScheme::Implicit, 100));
+  } else {
+    cplScheme.reset(new SerialCouplingScheme(
+        1.0, 4, 0.1, 16, "Participant0", "Participant1", nameLocalParticipant, m2n,
+        constants::FIXED_DT, BaseCouplingScheme::Implicit, 100));
+  }
+  cplScheme->addDataToSend(mesh->data(first ? dataID0 : dataID1), mesh, false);
+  cplScheme->addDataToReceive(mesh->data(first ? dataID1 : dataID0), mesh, false);
+
+  // The serial scheme post-processes the data of the second participant only
+  std::vector<int> postProcessedIDs{dataID1};
+  if (parallel) {
+    postProcessedIDs.insert(postProcessedIDs.begin(), dataID0);
+  }
+  for (int dataID : postProcessedIDs) {
+    cplScheme->addConvergenceMeasure(dataID, false, false,
+        impl::PtrConvergenceMeasure(new impl::AbsoluteConvergenceMeasure(1e-10)));
+  }
+  if (not first) {
+    std::vector<double>     factors(postProcessedIDs.size(), 1.0);
+    impl::PtrPreconditioner prec(new impl::ConstantPreconditioner(factors));
+    cplScheme->setIterationPostProcessing(impl::PtrPostProcessing(new impl::IQNILSPostProcessing(
+        0.5, false, 10, 2, impl::BaseQNPostProcessing::QR1FILTER, 1e-12, postProcessedIDs, prec)));
+  }
+  cplScheme->setPipelining(pipelining);
+
+  LinearRun       run;
+  Eigen::VectorXd rhs        = Eigen::VectorXd::LinSpaced(size, 1.0, 2.0);
+  int             iterations = 1;
+  cplScheme->initialize(0.0, 1);
+  while (cplScheme->isCouplingOngoing()) {
+    if (cplScheme->isActionRequired(constants::actionWriteIterationCheckpoint())) {
+      cplScheme->performedAction(constants::actionWriteIterationCheckpoint());
+    }
+    const double timeFactor = 1.0 + cplScheme->getTime();
+    const double mean0      = values0.mean();
+    for (int i = 0; i < size; i++) {
+      if (first) {
+        values0(i) = 0.5 * values1(i) + rhs(i) * timeFactor;
+      } else {
+        values1(i) = 0.7 * values0(i) - 0.4 * mean0 + 1.0;
+      }
+    }
+    cplScheme->addComputedTime(cplScheme->getNextTimestepMaxLength());
+    cplScheme->advance();
+    run.iterates.push_back(first ? values1 : values0);
+    if (cplScheme->isActionRequired(constants::actionReadIterationCheckpoint())) {
+      cplScheme->performedAction(constants::actionReadIterationCheckpoint());
+      iterations++;
+    } else {
+      run.iterations.push_back(iterations);
+      run.converged.push_back(run.iterates.back());
+      iterations = 1;
+    }
+  }
+  cplScheme->finalize();
+  return run;
+}
+
+}}} // namespace precice, cplscheme, tests
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <vector>
+#include "cplscheme/impl/SharedPointer.hpp"
+#include "m2n/SharedPointer.hpp"
+
+namespace precice {
+namespace cplscheme {
+namespace tests {
+
+/// Values seen while solving a linear fixed-point problem over several time steps.
+struct LinearRun
+{
+  /// Values after every iteration
+  std::vector<Eigen::VectorXd> iterates;
+  /// Number of iterations of every time step
+  std::vector<int> iterations;
+  /// Converged values of every time step
+  std::vector<Eigen::VectorXd> converged;
+};
+
+/**
+ * @brief Iterates x = A x + b of size 8 over 6 time steps, accelerated by the given post-processing.
+ *
+ * The right-hand side b changes with every time step. The post-processing has to be configured
+ * for one data of ID 0 with one component. Every time step is limited to 30 iterations.
+ */
+LinearRun runLinearPostProcessing(impl::PostProcessing &postProcessing);
+
+/**
+ * @brief Couples two linear solvers by an implicit scheme with IQN-ILS, returns what the local participant received.
+ *
+ * Participant0 on rank 0 computes data0 from data1 and Participant1 on rank 1 vice versa. Both solvers
+ * are stateless, hence the checkpointing actions are only acknowledged.
+ *
+ * @param[in] m2n Connection between the participants.
+ * @param[in] parallel Couples by a parallel scheme, which post-processes both data, otherwise by a serial one.
+ * @param[in] pipelining Passed to BaseCouplingScheme::setPipelining().
+ */
+LinearRun runLinearCoupling(m2n::PtrM2N m2n, bool parallel, bool pipelining);
+
+}}} // namespace precice, cplscheme, tests
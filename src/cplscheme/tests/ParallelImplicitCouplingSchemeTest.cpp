@@ -9,6 +9,7 @@
 #include "cplscheme/impl/BaseQNPostProcessing.hpp"
 #include "cplscheme/impl/ConstantPreconditioner.hpp"
 #include "cplscheme/SharedPointer.hpp"
+#include "cplscheme/tests/LinearCoupling.hpp"
 #include "cplscheme/impl/SharedPointer.hpp"
 #include "cplscheme/Constants.hpp"
 #include "mesh/Mesh.hpp"
@@ -80,6 +81,7 @@ BOOST_AUTO_TEST_CASE(testMVQNPP)
   int restartType = cplscheme::impl::MVQNPostProcessing::NO_RESTART;
   double singularityLimit = 1e-10;
   double svdTruncationEps = 0.0;
+  int maxStoredColumns = 0;
   bool enforceInitialRelaxation = false;
   bool alwaysBuildJacobian = false;
   std::vector<int> dataIDs;
@@ -93,7 +95,8 @@ BOOST_AUTO_TEST_CASE(testMVQNPP)
 
   cplscheme::impl::MVQNPostProcessing pp(initialRelaxation, enforceInitialRelaxation, maxIterationsUsed,
       timestepsReused, filter, singularityLimit, dataIDs, prec, alwaysBuildJacobian,
-      restartType, chunkSize, reusedTimestepsAtRestart, svdTruncationEps);
+      restartType, chunkSize, reusedTimestepsAtRestart, svdTruncationEps,
+      maxStoredColumns);
 
   Eigen::VectorXd dvalues;
   Eigen::VectorXd dcol1;
@@ -262,6 +265,71 @@ BOOST_AUTO_TEST_CASE(testVIQNPP)
   BOOST_TEST(testing::equals((*data.at(1)->values)(3), 8.28025852497733944046e-02));
 }
 
+BOOST_AUTO_TEST_CASE(testMatrixFreeMVQNPP)
+{
+  using namespace cplscheme::impl;
+  using cplscheme::tests::LinearRun;
+  std::vector<double> factors(1, 1.0);
+  std::vector<int>    dataIDs(1, 0);
+  auto                runMVQN = [&](int restartType, int maxStoredColumns) {
+    PtrPreconditioner  prec(new ConstantPreconditioner(factors));
+    MVQNPostProcessing pp(0.1, false, 6, 0, PostProcessing::QR1FILTER, 1e-12, dataIDs, prec, false,
+                          restartType, 8, 0, 0.0, maxStoredColumns);
+    return cplscheme::tests::runLinearPostProcessing(pp);
+  };
+  LinearRun explicitJacobian = runMVQN(MVQNPostProcessing::NO_RESTART, 0);
+  LinearRun matrixFree       = runMVQN(MVQNPostProcessing::MATRIX_FREE, 500);
+
+  // As long as no columns are dropped, the implicit Jacobian equals the explicit one
+  BOOST_TEST(explicitJacobian.iterations == matrixFree.iterations, boost::test_tools::per_element());
+  BOOST_TEST(explicitJacobian.iterates.size() == matrixFree.iterates.size());
+  for (size_t i = 0; i < std::min(explicitJacobian.iterates.size(), matrixFree.iterates.size()); i++) {
+    BOOST_TEST(testing::equals(explicitJacobian.iterates[i], matrixFree.iterates[i], 1e-8));
+  }
+
+  // The first time step fills the bounded storage, hence the first two time steps are unaffected
+  LinearRun bounded = runMVQN(MVQNPostProcessing::MATRIX_FREE, 4);
+  BOOST_TEST(matrixFree.iterations[0] > 4);
+  int unaffected = matrixFree.iterations[0] + matrixFree.iterations[1];
+  BOOST_TEST_REQUIRE(bounded.iterates.size() >= unaffected);
+  for (int i = 0; i < unaffected; i++) {
+    BOOST_TEST(testing::equals(bounded.iterates[i], matrixFree.iterates[i], 1e-8));
+  }
+
+  // Afterwards, the bounded Jacobian converges to the same values, with at most one more iteration per time step
+  for (size_t t = 0; t < matrixFree.converged.size(); t++) {
+    BOOST_TEST(bounded.iterations[t] < 30);
+    BOOST_TEST(bounded.iterations[t] <= matrixFree.iterations[t] + 1);
+    BOOST_TEST(testing::equals(bounded.converged[t], matrixFree.converged[t], 1e-8));
+  }
+}
+
+/// Test that runs on 2 processors.
+BOOST_FIXTURE_TEST_CASE(testPipeliningKeepsIterates, testing::M2NFixture,
+                        * testing::MinRanks(2)
+                        * boost::unit_test::fixture<testing::MPICommRestrictFixture>(std::vector<int>({0, 1})))
+{
+  if (utils::Parallel::getCommunicatorSize() != 2) // only run test on ranks {0,1}, for other ranks return
+    return;
+
+  cplscheme::tests::LinearRun plain     = cplscheme::tests::runLinearCoupling(m2n, true, false);
+  cplscheme::tests::LinearRun pipelined = cplscheme::tests::runLinearCoupling(m2n, true, true);
+
+  // Post-processing converges within a few iterations, not only by reaching the maximum
+  BOOST_TEST(plain.iterations.size() == 4);
+  for (int iterations : plain.iterations) {
+    BOOST_TEST(iterations > 1);
+    BOOST_TEST(iterations < 20);
+  }
+
+  // The deferred bookkeeping does not change anything the participants see
+  BOOST_TEST(pipelined.iterations == plain.iterations, boost::test_tools::per_element());
+  BOOST_TEST_REQUIRE(pipelined.iterates.size() == plain.iterates.size());
+  for (size_t i = 0; i < plain.iterates.size(); i++) {
+    BOOST_TEST(testing::equals(pipelined.iterates[i], plain.iterates[i]));
+  }
+}
+
 /// Test that runs on 2 processors.
 BOOST_FIXTURE_TEST_CASE(testInitializeData, testing::M2NFixture,
 		              * testing::MinRanks(2)
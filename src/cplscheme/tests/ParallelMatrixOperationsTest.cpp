@@ -18,6 +18,38 @@ using namespace precice;
 BOOST_AUTO_TEST_SUITE(ParallelMatrixOperations,
                       *testing::OnSize(4))
 
+namespace
+{
+/// Initializes the cyclic communication between successive slaves.
+void connectCyclic(com::PtrCommunication &left, com::PtrCommunication &right)
+{
+  int prevProc = (utils::Parallel::getProcessRank() - 1 < 0) ? utils::Parallel::getCommunicatorSize() - 1 : utils::Parallel::getProcessRank() - 1;
+  if ((utils::Parallel::getProcessRank() % 2) == 0) {
+    left->acceptConnection("cyclicComm-" + std::to_string(prevProc), "", utils::Parallel::getProcessRank());
+    right->requestConnection("cyclicComm-" + std::to_string(utils::Parallel::getProcessRank()), "", 0, 1);
+  } else {
+    right->requestConnection("cyclicComm-" + std::to_string(utils::Parallel::getProcessRank()), "", 0, 1);
+    left->acceptConnection("cyclicComm-" + std::to_string(prevProc), "", utils::Parallel::getProcessRank());
+  }
+}
+
+/// Closes and shuts down the cyclic communication connections.
+void closeCyclic(com::PtrCommunication &left, com::PtrCommunication &right)
+{
+  if (right != nullptr || left != nullptr) {
+    if ((utils::Parallel::getProcessRank() % 2) == 0) {
+      left->closeConnection();
+      right->closeConnection();
+    } else {
+      right->closeConnection();
+      left->closeConnection();
+    }
+    right = nullptr;
+    left  = nullptr;
+  }
+}
+} // namespace
+
 void validate_result_equals_reference(
     Eigen::MatrixXd & result_local,
     Eigen::MatrixXd & reference_global,
@@ -154,16 +186,7 @@ BOOST_AUTO_TEST_CASE(ParallelMatrixMatrixOp,  * boost::unit_test::fixture<testin
 {
   com::PtrCommunication _cyclicCommLeft  = com::PtrCommunication(new com::MPIPortsCommunication("."));
   com::PtrCommunication _cyclicCommRight = com::PtrCommunication(new com::MPIPortsCommunication("."));
-
-  // initialize cyclic communication between successive slaves
-  int prevProc = (utils::Parallel::getProcessRank() - 1 < 0) ? utils::Parallel::getCommunicatorSize() - 1 : utils::Parallel::getProcessRank() - 1;
-  if ((utils::Parallel::getProcessRank() % 2) == 0) {
-    _cyclicCommLeft->acceptConnection("cyclicComm-" + std::to_string(prevProc), "", utils::Parallel::getProcessRank());
-    _cyclicCommRight->requestConnection("cyclicComm-" + std::to_string(utils::Parallel::getProcessRank()), "", 0, 1);
-  } else {
-    _cyclicCommRight->requestConnection("cyclicComm-" + std::to_string(utils::Parallel::getProcessRank()), "", 0, 1);
-    _cyclicCommLeft->acceptConnection("cyclicComm-" + std::to_string(prevProc), "", utils::Parallel::getProcessRank());
-  }
+  connectCyclic(_cyclicCommLeft, _cyclicCommRight);
 
   int              n_global = 10, m_global = 5;
   int              n_local;
@@ -328,18 +351,7 @@ BOOST_AUTO_TEST_CASE(ParallelMatrixMatrixOp,  * boost::unit_test::fixture<testin
   Eigen::MatrixXd matrix_cast = resJres_local2;
   validate_result_equals_reference(matrix_cast, Jres_global, vertexOffsets, true);
 
-  // close and shut down cyclic communication connections
-  if (_cyclicCommRight != nullptr || _cyclicCommLeft != nullptr) {
-    if ((utils::Parallel::getProcessRank() % 2) == 0) {
-      _cyclicCommLeft->closeConnection();
-      _cyclicCommRight->closeConnection();
-    } else {
-      _cyclicCommRight->closeConnection();
-      _cyclicCommLeft->closeConnection();
-    }
-    _cyclicCommRight = nullptr;
-    _cyclicCommLeft  = nullptr;
-  }
+  closeCyclic(_cyclicCommLeft, _cyclicCommRight);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -275,6 +275,7 @@ BOOST_AUTO_TEST_CASE(testVIQNIMVJpp, * testing::OnSize(4) * boost::unit_test::fi
   int reusedTimeStepsAtRestart = 0;
   double singularityLimit = 1e-10;
   double svdTruncationEps = 0.0;
+  int maxStoredColumns = 0;
   bool enforceInitialRelaxation = false;
   bool alwaysBuildJacobian = false;
 
@@ -291,7 +292,8 @@ BOOST_AUTO_TEST_CASE(testVIQNIMVJpp, * testing::OnSize(4) * boost::unit_test::fi
 
   cplscheme::impl::MVQNPostProcessing pp(initialRelaxation, enforceInitialRelaxation, maxIterationsUsed,
       timestepsReused, filter, singularityLimit, dataIDs, prec, alwaysBuildJacobian,
-      restartType, chunkSize, reusedTimeStepsAtRestart, svdTruncationEps);
+      restartType, chunkSize, reusedTimeStepsAtRestart, svdTruncationEps,
+      maxStoredColumns);
 
   Eigen::VectorXd dvalues;
   Eigen::VectorXd dcol1;
@@ -504,6 +506,7 @@ BOOST_AUTO_TEST_CASE(testIMVJ_effUpdate_pp, * testing::OnSize(4) * boost::unit_t
   int reusedTimeStepsAtRestart = 0;
   double singularityLimit = 1e-2;
   double svdTruncationEps = 0.0;
+  int maxStoredColumns = 0;
   bool enforceInitialRelaxation = false;
   bool alwaysBuildJacobian = false;
 
@@ -518,7 +521,8 @@ BOOST_AUTO_TEST_CASE(testIMVJ_effUpdate_pp, * testing::OnSize(4) * boost::unit_t
 
   cplscheme::impl::MVQNPostProcessing pp(initialRelaxation, enforceInitialRelaxation, maxIterationsUsed,
       timestepsReused, filter, singularityLimit, dataIDs, _preconditioner, alwaysBuildJacobian,
-      restartType, chunkSize, reusedTimeStepsAtRestart, svdTruncationEps);
+      restartType, chunkSize, reusedTimeStepsAtRestart, svdTruncationEps,
+      maxStoredColumns);
 
   Eigen::VectorXd dvalues;
   Eigen::VectorXd doldValues;
@@ -973,6 +977,66 @@ BOOST_AUTO_TEST_CASE(testIMVJ_effUpdate_pp, * testing::OnSize(4) * boost::unit_t
   }
 }
 
+/// Test that runs on 4 processors.
+BOOST_AUTO_TEST_CASE(testMatrixFreeIMVJpp, * testing::OnSize(4) * boost::unit_test::fixture<testing::MasterComFixture>())
+{
+  // Linear fixed-point problem x = A*x + b with 2 unknowns per processor, bounded column
+  // storage to drop old time steps. The products with the stored matrices are reduced over all processors.
+  const int n = 8;
+  const int localN = 2;
+  const int offset = localN * utils::MasterSlave::_rank;
+  Eigen::MatrixXd A(n, n);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      A(i, j) = 0.3 * std::sin(1.0 + i * i + 2.0 * j + 0.5 * i * j);
+    }
+  }
+
+  std::vector<double> factors(1, 1.0);
+  impl::PtrPreconditioner prec(new impl::ConstantPreconditioner(factors));
+  std::vector<int> dataIDs(1, 0);
+  cplscheme::impl::MVQNPostProcessing pp(0.1, false, 6, 0, impl::BaseQNPostProcessing::QR1FILTER, 1e-12, dataIDs, prec, false,
+      impl::MVQNPostProcessing::MATRIX_FREE, 8, 0, 0.0, 4);
+
+  std::vector<int> vertexOffsets {2, 4, 6, 8};
+  mesh::PtrMesh dummyMesh(new mesh::Mesh("DummyMesh", 3, false));
+  dummyMesh->setVertexOffsets(vertexOffsets);
+  Eigen::VectorXd values = Eigen::VectorXd::Zero(localN);
+  PtrCouplingData data(new CouplingData(&values, dummyMesh, false, 1));
+  DataMap dataMap;
+  dataMap.insert(std::make_pair(0, data));
+  pp.initialize(dataMap);
+
+  // Iterations per time step of the same problem on a single processor
+  std::vector<int> expectedIterations {16, 5, 2, 1, 1, 1};
+  Eigen::VectorXd x = Eigen::VectorXd::Zero(localN);
+  for (int timestep = 0; timestep < 6; timestep++) {
+    Eigen::VectorXd b = Eigen::VectorXd::LinSpaced(n, 1.0, 2.0) * (1.0 + 0.1 * timestep);
+    int iteration = 0;
+    for (; iteration < 30; iteration++) {
+      Eigen::VectorXd localX = Eigen::VectorXd::Zero(n);
+      localX.segment(offset, localN) = x;
+      Eigen::VectorXd globalX = utils::MasterSlave::allreduceSum(localX);
+      data->oldValues.col(0) = x;
+      values = A.middleRows(offset, localN) * globalX + b.segment(offset, localN);
+      double localResidual = (values - x).squaredNorm();
+      double residual = 0.0;
+      utils::MasterSlave::allreduceSum(localResidual, residual, 1);
+      if (std::sqrt(residual) < 1e-9) {
+        break;
+      }
+      pp.performPostProcessing(dataMap);
+      x = values;
+    }
+    pp.iterationsConverged(dataMap);
+    x = values;
+
+    Eigen::VectorXd solution = (Eigen::MatrixXd::Identity(n, n) - A).lu().solve(b);
+    BOOST_TEST(iteration == expectedIterations[timestep]);
+    BOOST_TEST(testing::equals(x, solution.segment(offset, localN), 1e-8));
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -26,4 +26,25 @@ BOOST_AUTO_TEST_CASE(RelativeConvergenceMeasureTest)
   BOOST_TEST(measure.isConvergence());
 }
 
+/// The sums of parts of the data, as reduced over several ranks, lead to the same measurement as the whole data.
+BOOST_AUTO_TEST_CASE(RelativeConvergenceMeasureFromSums)
+{
+  using Eigen::Vector2d;
+  using Eigen::Vector4d;
+  precice::cplscheme::impl::RelativeConvergenceMeasure whole(0.1);
+  precice::cplscheme::impl::RelativeConvergenceMeasure parts(0.1);
+
+  Vector4d oldValues(1.0, 2.0, 2.9, 3.0);
+  Vector4d newValues(1.0, 2.1, 3.0, 3.0);
+  Vector4d designSpec(0.0, 0.0, 0.0, 0.1);
+
+  whole.measure(oldValues, newValues, designSpec);
+  Eigen::VectorXd sums = parts.localSums(oldValues.head<2>(), newValues.head<2>(), designSpec.head<2>()) +
+                         parts.localSums(oldValues.tail<2>(), newValues.tail<2>(), designSpec.tail<2>());
+  parts.measureSums(sums);
+
+  BOOST_TEST(parts.isConvergence() == whole.isConvergence());
+  BOOST_TEST(parts.getNormResidual() == whole.getNormResidual(), boost::test_tools::tolerance(1e-12));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
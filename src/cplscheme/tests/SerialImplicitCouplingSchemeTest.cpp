@@ -4,7 +4,10 @@
 #include "cplscheme/impl/ConvergenceMeasure.hpp"
 #include "cplscheme/impl/AbsoluteConvergenceMeasure.hpp"
 #include "cplscheme/impl/MinIterationConvergenceMeasure.hpp"
+#include "cplscheme/impl/IQNILSPostProcessing.hpp"
+#include "cplscheme/impl/ConstantPreconditioner.hpp"
 #include "cplscheme/SharedPointer.hpp"
+#include "cplscheme/tests/LinearCoupling.hpp"
 #include "cplscheme/Constants.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/Vertex.hpp"
@@ -419,6 +422,27 @@ BOOST_AUTO_TEST_CASE(testParseConfigurationWithRelaxation)
   meshConfig->setMeshSubIDs();
 }
 
+BOOST_AUTO_TEST_CASE(testParseConfigurationWithPipelining)
+{
+  using namespace mesh;
+
+  std::string path(_pathToTests + "serial-implicit-cplscheme-pipelining-config.xml");
+
+  xml::XMLTag root = xml::getRootTag();
+  PtrDataConfiguration dataConfig(new DataConfiguration(root));
+  dataConfig->setDimensions(3);
+  PtrMeshConfiguration meshConfig(new MeshConfiguration(root, dataConfig));
+  meshConfig->setDimensions(3);
+  m2n::M2NConfiguration::SharedPointer m2nConfig(
+      new m2n::M2NConfiguration(root));
+  CouplingSchemeConfiguration cplSchemeConfig(root, meshConfig, m2nConfig);
+
+  xml::configure(root, path);
+  meshConfig->setMeshSubIDs();
+  auto scheme = std::dynamic_pointer_cast<BaseCouplingScheme>(cplSchemeConfig.getCouplingScheme("Participant1"));
+  BOOST_TEST(scheme->isPipelining());
+}
+
 BOOST_AUTO_TEST_CASE(testExtrapolateData)
 {
   using namespace mesh;
@@ -860,6 +884,32 @@ BOOST_FIXTURE_TEST_CASE(testInitializeData, testing::M2NFixture,
   cplScheme.finalize();
 }
 
+/// Test that runs on 2 processors.
+BOOST_FIXTURE_TEST_CASE(testPipeliningKeepsIterates, testing::M2NFixture,
+                   * testing::MinRanks(2)
+                   * boost::unit_test::fixture<testing::MPICommRestrictFixture>(std::vector<int>({0, 1})))
+{
+  if (utils::Parallel::getCommunicatorSize() != 2) // only run test on ranks {0,1}, for other ranks return
+    return;
+
+  cplscheme::tests::LinearRun plain     = cplscheme::tests::runLinearCoupling(m2n, false, false);
+  cplscheme::tests::LinearRun pipelined = cplscheme::tests::runLinearCoupling(m2n, false, true);
+
+  // Post-processing converges within a few iterations, not only by reaching the maximum
+  BOOST_TEST(plain.iterations.size() == 4);
+  for (int iterations : plain.iterations) {
+    BOOST_TEST(iterations > 1);
+    BOOST_TEST(iterations < 20);
+  }
+
+  // The deferred bookkeeping does not change anything the participants see
+  BOOST_TEST(pipelined.iterations == plain.iterations, boost::test_tools::per_element());
+  BOOST_TEST_REQUIRE(pipelined.iterates.size() == plain.iterates.size());
+  for (size_t i = 0; i < plain.iterates.size(); i++) {
+    BOOST_TEST(testing::equals(pipelined.iterates[i], plain.iterates[i]));
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -74,7 +74,7 @@ void TXTTableWriter:: writeData
   _outputStream << value << "  ";
   _writeIterator ++;
   if ( _writeIterator == _data.end() ) {
-    _outputStream.flush ();
+    completeLine ();
   }
 }
 
@@ -93,7 +93,7 @@ void TXTTableWriter:: writeData
   _outputStream << value << "  ";
   _writeIterator ++;
   if ( _writeIterator == _data.end() ) {
-    _outputStream.flush ();
+    completeLine ();
   }
 }
 
@@ -114,7 +114,7 @@ void TXTTableWriter:: writeData
   }
   _writeIterator ++;
   if ( _writeIterator == _data.end() ) {
-    _outputStream.flush ();
+    completeLine ();
   }
 }
 
@@ -135,7 +135,24 @@ void TXTTableWriter:: writeData
   }
   _writeIterator ++;
   if ( _writeIterator == _data.end() ) {
+    completeLine ();
+  }
+}
+
+void TXTTableWriter:: setFlushInterval
+(
+  int lines )
+{
+  assertion ( lines > 0, lines );
+  _flushInterval = lines;
+}
+
+void TXTTableWriter:: completeLine ()
+{
+  _linesSinceFlush ++;
+  if ( _linesSinceFlush >= _flushInterval ) {
     _outputStream.flush ();
+    _linesSinceFlush = 0;
   }
 }
 
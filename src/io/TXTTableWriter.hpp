@@ -76,6 +76,13 @@ public:
     const std::string&     name,
     const Eigen::Vector3d& value );
 
+  /**
+   * @brief Sets the number of written lines after which the file is flushed.
+   *
+   * The default of one flushes every complete line. Larger intervals avoid frequent small writes.
+   */
+  void setFlushInterval ( int lines );
+
   /// Closes the file, is automatically called on destruction.
   void close();
 
@@ -100,6 +107,13 @@ private:
   std::vector<Data>::const_iterator _writeIterator;
 
   std::ofstream _outputStream;
+
+  int _flushInterval = 1;
+
+  int _linesSinceFlush = 0;
+
+  /// Counts a completed line and flushes the file, if the flush interval is reached.
+  void completeLine();
 };
 
 }} // namespace precice, io
@@ -0,0 +1,89 @@
+#include "CompactVertexDistribution.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace precice
+{
+namespace m2n
+{
+
+CompactVertexDistribution::CompactVertexDistribution(const mesh::Mesh::VertexDistribution &distribution)
+{
+  std::vector<int> indices;
+  for (const auto &entry : distribution) {
+    indices = entry.second;
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+    if (indices.empty()) {
+      continue;
+    }
+
+    size_t ranges = 1;
+    for (size_t i = 1; i < indices.size(); i++) {
+      if (indices[i] != indices[i - 1] + 1) {
+        ranges++;
+      }
+    }
+
+    _data.push_back(entry.first);
+    if (2 * ranges < indices.size()) {
+      _data.push_back(RANGES);
+      _data.push_back(static_cast<int>(ranges));
+      _data.push_back(indices[0]);
+      for (size_t i = 1; i < indices.size(); i++) {
+        if (indices[i] != indices[i - 1] + 1) {
+          _data.push_back(indices[i - 1] + 1);
+          _data.push_back(indices[i]);
+        }
+      }
+      _data.push_back(indices.back() + 1);
+    } else {
+      _data.push_back(LIST);
+      _data.push_back(static_cast<int>(indices.size()));
+      _data.insert(_data.end(), indices.begin(), indices.end());
+    }
+  }
+}
+
+mesh::Mesh::VertexDistribution CompactVertexDistribution::expand() const
+{
+  mesh::Mesh::VertexDistribution distribution;
+  forEachRange([&distribution](int rank, int begin, int end) {
+    auto &indices = distribution[rank];
+    for (int index = begin; index < end; index++) {
+      indices.push_back(index);
+    }
+  });
+  return distribution;
+}
+
+std::map<int, std::vector<int>> CompactVertexDistribution::communicationMap(const std::vector<int> &localIndices) const
+{
+  std::vector<std::pair<int, int>> sorted; // (global index, position)
+  sorted.reserve(localIndices.size());
+  for (size_t position = 0; position < localIndices.size(); position++) {
+    sorted.emplace_back(localIndices[position], static_cast<int>(position));
+  }
+  std::sort(sorted.begin(), sorted.end());
+
+  std::map<int, std::vector<int>> communicationMap;
+  if (sorted.empty()) {
+    return communicationMap;
+  }
+
+  const int minimum = sorted.front().first;
+  const int maximum = sorted.back().first;
+  forEachRange([&](int rank, int begin, int end) {
+    if (end <= minimum || begin > maximum) {
+      return;
+    }
+    auto it = std::lower_bound(sorted.begin(), sorted.end(), std::make_pair(begin, -1));
+    for (; it != sorted.end() && it->first < end; ++it) {
+      communicationMap[rank].push_back(it->second);
+    }
+  });
+  return communicationMap;
+}
+
+} // namespace m2n
+} // namespace precice
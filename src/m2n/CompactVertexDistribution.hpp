@@ -0,0 +1,81 @@
+#pragma once
+
+#include <map>
+#include <vector>
+#include "mesh/Mesh.hpp"
+
+namespace precice
+{
+namespace m2n
+{
+/**
+ * @brief Vertex distribution of a participant, which stores the global vertex indices of every rank compactly.
+ *
+ * Partitions typically consist of few contiguous blocks of global vertex indices. Therefore, the
+ * indices of a rank are stored as sorted, half-open ranges [begin, end), unless an explicit sorted
+ * list of the indices is smaller. All ranks are encoded in a single array of integers, which is
+ * exchanged between the participants and broadcast to the slaves as it is.
+ */
+class CompactVertexDistribution
+{
+public:
+  CompactVertexDistribution() = default;
+
+  /// Encodes the global vertex indices of all ranks of the distribution.
+  explicit CompactVertexDistribution(const mesh::Mesh::VertexDistribution &distribution);
+
+  /// Calls f(rank, begin, end) for all ranges of global indices, sorted per rank.
+  template <typename Function>
+  void forEachRange(Function f) const
+  {
+    size_t position = 0;
+    while (position < _data.size()) {
+      const int rank  = _data[position];
+      const int type  = _data[position + 1];
+      const int count = _data[position + 2];
+      position += 3;
+      if (type == RANGES) {
+        for (int i = 0; i < count; i++, position += 2) {
+          f(rank, _data[position], _data[position + 1]);
+        }
+      } else {
+        for (int i = 0; i < count; i++, position++) {
+          f(rank, _data[position], _data[position] + 1);
+        }
+      }
+    }
+  }
+
+  /// Returns the distribution with one global index per vertex, sorted per rank.
+  mesh::Mesh::VertexDistribution expand() const;
+
+  /**
+   * @brief Returns the positions in localIndices of the global indices held by each rank.
+   *
+   * The positions of every rank are ordered by their global index, such that both participants
+   * traverse shared vertices in the same order.
+   */
+  std::map<int, std::vector<int>> communicationMap(const std::vector<int> &localIndices) const;
+
+  /// Encoded distribution: per rank the rank, type, count and count ranges or indices.
+  std::vector<int> &data()
+  {
+    return _data;
+  }
+
+  const std::vector<int> &data() const
+  {
+    return _data;
+  }
+
+private:
+  enum Type : int {
+    RANGES = 0,
+    LIST   = 1
+  };
+
+  std::vector<int> _data;
+};
+
+} // namespace m2n
+} // namespace precice
@@ -0,0 +1,365 @@
+#include "Compression.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include "com/Communication.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice
+{
+namespace m2n
+{
+
+logging::Logger Compression::_log("m2n::Compression");
+
+const size_t Compression::BLOCK_VERTICES = 8;
+
+namespace
+{
+/// Maximal length of a run of zero bytes or of literal bytes, fits into the 7 bits of a control byte.
+const size_t MAX_RUN = 128;
+
+/// Encodes runs of zero bytes by a control byte with the high bit set, other bytes are copied after a control byte.
+void appendZeroRuns(const std::vector<unsigned char> &in, std::vector<unsigned char> &out)
+{
+  size_t i = 0;
+  while (i < in.size()) {
+    size_t run = 0;
+    if (in[i] == 0) {
+      while (i + run < in.size() && in[i + run] == 0 && run < MAX_RUN) {
+        run++;
+      }
+      out.push_back(0x80 | static_cast<unsigned char>(run - 1));
+    } else {
+      // Single zero bytes are cheaper as literals than as runs
+      while (i + run < in.size() && run < MAX_RUN &&
+             not(in[i + run] == 0 && i + run + 1 < in.size() && in[i + run + 1] == 0)) {
+        run++;
+      }
+      out.push_back(static_cast<unsigned char>(run - 1));
+      out.insert(out.end(), in.begin() + i, in.begin() + i + run);
+    }
+    i += run;
+  }
+}
+
+void expandZeroRuns(const unsigned char *in, size_t inSize, std::vector<unsigned char> &out)
+{
+  size_t i = 0;
+  while (i < inSize) {
+    unsigned char control = in[i++];
+    size_t        run     = (control & 0x7f) + 1;
+    if (control & 0x80) {
+      out.insert(out.end(), run, 0);
+    } else {
+      assertion(i + run <= inSize, i, run, inSize);
+      out.insert(out.end(), in + i, in + i + run);
+      i += run;
+    }
+  }
+}
+
+std::uint64_t bitsOf(double value)
+{
+  std::uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+double doubleOf(std::uint64_t bits)
+{
+  double value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+void appendVarint(std::uint64_t value, std::vector<unsigned char> &out)
+{
+  while (value >= 0x80) {
+    out.push_back(static_cast<unsigned char>(value & 0x7f) | 0x80);
+    value >>= 7;
+  }
+  out.push_back(static_cast<unsigned char>(value));
+}
+
+std::uint64_t readVarint(const unsigned char *&in)
+{
+  std::uint64_t value = 0;
+  int           shift = 0;
+  while (*in & 0x80) {
+    value |= static_cast<std::uint64_t>(*in++ & 0x7f) << shift;
+    shift += 7;
+  }
+  value |= static_cast<std::uint64_t>(*in++) << shift;
+  return value;
+}
+} // namespace
+
+Compression::Compression(
+    Type   type,
+    double tolerance,
+    bool   delta,
+    double deltaTolerance)
+    : _type(type),
+      _tolerance(tolerance),
+      _delta(delta),
+      _deltaTolerance(deltaTolerance)
+{
+  assertion(type != Type::QUANTIZE || tolerance > 0.0, tolerance);
+  assertion(deltaTolerance >= 0.0, deltaTolerance);
+}
+
+Compression::Type Compression::parseType(const std::string &name)
+{
+  if (name == "lossless") {
+    return Type::LOSSLESS;
+  } else if (name == "float") {
+    return Type::FLOAT;
+  } else if (name == "quantize") {
+    return Type::QUANTIZE;
+  }
+  assertion(name == "none", name);
+  return Type::NONE;
+}
+
+void Compression::encode(
+    const double *       values,
+    size_t               size,
+    int                  valueDimension,
+    std::vector<double> &packed) const
+{
+  assertion(valueDimension > 0, valueDimension);
+  std::vector<unsigned char> bytes;
+
+  if (_type == Type::LOSSLESS) {
+    // Planes of bytes of equal significance, starting with the most significant byte
+    std::vector<unsigned char> planes(size * sizeof(double));
+    for (size_t i = 0; i < size; i++) {
+      std::uint64_t bits = bitsOf(values[i]);
+      if (i >= static_cast<size_t>(valueDimension)) {
+        bits ^= bitsOf(values[i - valueDimension]);
+      }
+      for (size_t byte = 0; byte < sizeof(double); byte++) {
+        planes[byte * size + i] = static_cast<unsigned char>(bits >> (8 * (sizeof(double) - 1 - byte)));
+      }
+    }
+    appendZeroRuns(planes, bytes);
+  } else if (_type == Type::FLOAT) {
+    bytes.resize(size * sizeof(float));
+    for (size_t i = 0; i < size; i++) {
+      float value = static_cast<float>(values[i]);
+      std::memcpy(&bytes[i * sizeof(float)], &value, sizeof(float));
+    }
+  } else if (_type == Type::QUANTIZE) {
+    const double              step     = 2.0 * _tolerance;
+    const double              maxScale = std::ldexp(1.0, 62);
+    std::vector<std::int64_t> levels(size);
+    bytes.reserve(size);
+    for (size_t i = 0; i < size; i++) {
+      double scaled = values[i] / step;
+      CHECK(std::abs(scaled) < maxScale,
+            "Value " << values[i] << " cannot be quantized with tolerance " << _tolerance
+                     << ". Please increase the compression tolerance or choose another compression.");
+      levels[i]          = std::llround(scaled);
+      std::int64_t delta = levels[i];
+      if (i >= static_cast<size_t>(valueDimension)) {
+        delta -= levels[i - valueDimension];
+      }
+      // Zigzag encoding maps small negative and positive deltas to small unsigned numbers
+      appendVarint((static_cast<std::uint64_t>(delta) << 1) ^ static_cast<std::uint64_t>(delta >> 63), bytes);
+    }
+  } else {
+    bytes.resize(size * sizeof(double));
+    std::memcpy(bytes.data(), values, bytes.size());
+  }
+
+  packed.resize(1 + (bytes.size() + sizeof(double) - 1) / sizeof(double));
+  packed[0] = static_cast<double>(bytes.size());
+  std::memcpy(packed.data() + 1, bytes.data(), bytes.size());
+  DEBUG("Encoded " << size * sizeof(double) << " bytes into " << bytes.size() << " bytes");
+}
+
+void Compression::decode(
+    const std::vector<double> &packed,
+    double *                   values,
+    size_t                     size,
+    int                        valueDimension) const
+{
+  assertion(valueDimension > 0, valueDimension);
+  assertion(not packed.empty());
+  const size_t         byteSize = static_cast<size_t>(packed[0]);
+  const unsigned char *bytes    = reinterpret_cast<const unsigned char *>(packed.data() + 1);
+  assertion(byteSize <= (packed.size() - 1) * sizeof(double), byteSize, packed.size());
+
+  if (_type == Type::LOSSLESS) {
+    std::vector<unsigned char> planes;
+    planes.reserve(size * sizeof(double));
+    expandZeroRuns(bytes, byteSize, planes);
+    assertion(planes.size() == size * sizeof(double), planes.size(), size);
+    for (size_t i = 0; i < size; i++) {
+      std::uint64_t bits = 0;
+      for (size_t byte = 0; byte < sizeof(double); byte++) {
+        bits = (bits << 8) | planes[byte * size + i];
+      }
+      if (i >= static_cast<size_t>(valueDimension)) {
+        bits ^= bitsOf(values[i - valueDimension]);
+      }
+      values[i] = doubleOf(bits);
+    }
+  } else if (_type == Type::FLOAT) {
+    assertion(byteSize == size * sizeof(float), byteSize, size);
+    for (size_t i = 0; i < size; i++) {
+      float value;
+      std::memcpy(&value, bytes + i * sizeof(float), sizeof(float));
+      values[i] = value;
+    }
+  } else if (_type == Type::QUANTIZE) {
+    const double              step = 2.0 * _tolerance;
+    const unsigned char *     in   = bytes;
+    std::vector<std::int64_t> levels(size);
+    for (size_t i = 0; i < size; i++) {
+      std::uint64_t zigzag = readVarint(in);
+      std::int64_t  delta  = static_cast<std::int64_t>(zigzag >> 1) ^ -static_cast<std::int64_t>(zigzag & 1);
+      levels[i]            = delta;
+      if (i >= static_cast<size_t>(valueDimension)) {
+        levels[i] += levels[i - valueDimension];
+      }
+      values[i] = levels[i] * step;
+    }
+    assertion(in == bytes + byteSize, in - bytes, byteSize);
+  } else {
+    assertion(byteSize == size * sizeof(double), byteSize, size);
+    std::memcpy(values, bytes, byteSize);
+  }
+}
+
+void Compression::pack(
+    const double *       values,
+    size_t               size,
+    int                  valueDimension,
+    int                  remoteRank,
+    std::vector<double> &message)
+{
+  if (not _delta) {
+    encode(values, size, valueDimension, message);
+    return;
+  }
+  const size_t               blockSize  = BLOCK_VERTICES * valueDimension;
+  const size_t               blocks     = (size + blockSize - 1) / blockSize;
+  std::vector<std::uint64_t> bitmap((blocks + 63) / 64, 0);
+  std::vector<double> &      last       = _lastValues[remoteRank];
+  const bool                 sendAll    = last.size() != size;
+  size_t                     sentBlocks = 0;
+  std::vector<double>        changed;
+  if (sendAll) {
+    last.assign(values, values + size);
+  }
+
+  for (size_t block = 0; block < blocks; block++) {
+    const size_t begin = block * blockSize;
+    const size_t end   = std::min(size, begin + blockSize);
+    bool         send  = sendAll;
+    for (size_t i = begin; i < end && not send; i++) {
+      send = not(std::abs(values[i] - last[i]) <= _deltaTolerance);
+    }
+    if (send) {
+      bitmap[block / 64] |= std::uint64_t(1) << (block % 64);
+      changed.insert(changed.end(), values + begin, values + end);
+      std::copy(values + begin, values + end, last.begin() + begin);
+      sentBlocks++;
+    }
+  }
+  DEBUG("Sending " << sentBlocks << " of " << blocks << " blocks to rank " << remoteRank);
+
+  std::vector<double> packed;
+  encode(changed.data(), changed.size(), valueDimension, packed);
+  message.resize(bitmap.size() + packed.size());
+  std::memcpy(message.data(), bitmap.data(), bitmap.size() * sizeof(std::uint64_t));
+  std::copy(packed.begin(), packed.end(), message.begin() + bitmap.size());
+}
+
+void Compression::unpack(
+    const std::vector<double> &message,
+    double *                   values,
+    size_t                     size,
+    int                        valueDimension,
+    int                        remoteRank)
+{
+  if (not _delta) {
+    decode(message, values, size, valueDimension);
+    return;
+  }
+  const size_t               blockSize = BLOCK_VERTICES * valueDimension;
+  const size_t               blocks    = (size + blockSize - 1) / blockSize;
+  std::vector<std::uint64_t> bitmap((blocks + 63) / 64);
+  assertion(message.size() > bitmap.size(), message.size(), bitmap.size());
+  std::memcpy(bitmap.data(), message.data(), bitmap.size() * sizeof(std::uint64_t));
+
+  auto isSent = [&bitmap](size_t block) {
+    return (bitmap[block / 64] >> (block % 64)) & 1;
+  };
+  size_t changedSize = 0;
+  for (size_t block = 0; block < blocks; block++) {
+    if (isSent(block)) {
+      changedSize += std::min(size, (block + 1) * blockSize) - block * blockSize;
+    }
+  }
+  std::vector<double> changed(changedSize);
+  decode(std::vector<double>(message.begin() + bitmap.size(), message.end()),
+         changed.data(), changedSize, valueDimension);
+
+  std::vector<double> &last = _lastValues[remoteRank];
+  if (last.size() != size) {
+    assertion(changedSize == size, changedSize, size);
+    last.resize(size);
+  }
+  auto next = changed.begin();
+  for (size_t block = 0; block < blocks; block++) {
+    if (isSent(block)) {
+      const size_t begin = block * blockSize;
+      const size_t end   = std::min(size, begin + blockSize);
+      std::copy(next, next + (end - begin), last.begin() + begin);
+      next += end - begin;
+    }
+  }
+  std::copy(last.begin(), last.end(), values);
+}
+
+void Compression::send(
+    com::Communication &communication,
+    const double *      values,
+    size_t              size,
+    int                 valueDimension,
+    int                 rankReceiver)
+{
+  if (not isEnabled()) {
+    communication.send(values, size, rankReceiver);
+    return;
+  }
+  std::vector<double> message;
+  pack(values, size, valueDimension, rankReceiver, message);
+  communication.send(static_cast<int>(message.size()), rankReceiver);
+  communication.send(message.data(), message.size(), rankReceiver);
+}
+
+void Compression::receive(
+    com::Communication &communication,
+    double *            values,
+    size_t              size,
+    int                 valueDimension,
+    int                 rankSender)
+{
+  if (not isEnabled()) {
+    communication.receive(values, size, rankSender);
+    return;
+  }
+  int messageSize = 0;
+  communication.receive(messageSize, rankSender);
+  std::vector<double> message(messageSize);
+  communication.receive(message.data(), messageSize, rankSender);
+  unpack(message, values, size, valueDimension, rankSender);
+}
+
+} // namespace m2n
+} // namespace precice
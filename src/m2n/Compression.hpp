@@ -0,0 +1,146 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+#include "logging/Logger.hpp"
+
+namespace precice
+{
+namespace com
+{
+class Communication;
+}
+
+namespace m2n
+{
+/**
+ * @brief Encodes arrays of coupling data values for the transfer between participants.
+ *
+ * Both participants have to use the same compression for the same data, i.e., it is configured
+ * per exchanged data. Values are encoded by the following types:
+ *
+ * - NONE: The values are sent unmodified.
+ * - LOSSLESS: Every value is XORed with the value of the same component of the previous vertex,
+ *   the bytes are shuffled into planes of equal significance and runs of zero bytes are encoded
+ *   by their length. This pays off for smooth fields, where sign, exponent and the leading bits
+ *   of the mantissa of neighbouring values coincide.
+ * - FLOAT: The values are downcast to single precision, halving the transferred bytes.
+ * - QUANTIZE: The values are rounded to multiples of twice the tolerance, such that the absolute
+ *   error is bounded by the tolerance. The differences of the multiples to the previous vertex
+ *   are encoded with a variable number of bytes.
+ *
+ * Encoded values are sent as array of doubles, whose first entry holds the number of encoded bytes.
+ *
+ * Optionally, only blocks of values are exchanged, which changed by more than the delta tolerance
+ * since the last exchange with the same remote rank. The message then starts with a bitmap of the
+ * sent blocks and the receiver fills in the other blocks from its last received values. Therefore,
+ * every object keeps the last exchanged values per remote rank and has to be used for one direction
+ * of one exchanged data only.
+ */
+class Compression
+{
+public:
+  enum class Type {
+    NONE,
+    LOSSLESS,
+    FLOAT,
+    QUANTIZE
+  };
+
+  /// Number of vertices whose values form a block of the delta exchange.
+  static const size_t BLOCK_VERTICES;
+
+  explicit Compression(
+      Type   type           = Type::NONE,
+      double tolerance      = 0.0,
+      bool   delta          = false,
+      double deltaTolerance = 0.0);
+
+  /// Returns the type parsed from its name in the configuration.
+  static Type parseType(const std::string &name);
+
+  Type getType() const
+  {
+    return _type;
+  }
+
+  double getTolerance() const
+  {
+    return _tolerance;
+  }
+
+  bool isDelta() const
+  {
+    return _delta;
+  }
+
+  /// Returns true, if the values are not sent as they are.
+  bool isEnabled() const
+  {
+    return _type != Type::NONE || _delta;
+  }
+
+  /// Encodes size values with valueDimension components each into packed.
+  void encode(
+      const double *       values,
+      size_t               size,
+      int                  valueDimension,
+      std::vector<double> &packed) const;
+
+  /// Decodes packed into size values with valueDimension components each.
+  void decode(
+      const std::vector<double> &packed,
+      double *                   values,
+      size_t                     size,
+      int                        valueDimension) const;
+
+  /// Encodes the values for the remote rank, possibly only the blocks changed since the last exchange.
+  void pack(
+      const double *       values,
+      size_t               size,
+      int                  valueDimension,
+      int                  remoteRank,
+      std::vector<double> &message);
+
+  /// Decodes a message created by pack() on the remote rank.
+  void unpack(
+      const std::vector<double> &message,
+      double *                   values,
+      size_t                     size,
+      int                        valueDimension,
+      int                        remoteRank);
+
+  /// Sends the packed values, or the plain values if compression is disabled.
+  void send(
+      com::Communication &communication,
+      const double *      values,
+      size_t              size,
+      int                 valueDimension,
+      int                 rankReceiver);
+
+  /// Receives values sent by send().
+  void receive(
+      com::Communication &communication,
+      double *            values,
+      size_t              size,
+      int                 valueDimension,
+      int                 rankSender);
+
+private:
+  static logging::Logger _log;
+
+  Type _type;
+
+  double _tolerance;
+
+  bool _delta;
+
+  double _deltaTolerance;
+
+  /// Remote rank -> values known by both sides after the last exchange, if only changed blocks are sent.
+  std::map<int, std::vector<double>> _lastValues;
+};
+
+} // namespace m2n
+} // namespace precice
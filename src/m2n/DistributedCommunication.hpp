@@ -1,6 +1,9 @@
 #pragma once
 
+#include <map>
+#include "Compression.hpp"
 #include "mesh/SharedPointer.hpp"
+#include "utils/EventUtils.hpp"
 
 namespace precice
 {
@@ -70,17 +73,47 @@ public:
    */
   virtual void closeConnection() = 0;
 
-  /// Sends an array of double values from all slaves (different for each slave).
+  /// Sends an array of double values from all slaves (different for each slave), encoded by compression.
   virtual void send(
-      double *itemsToSend,
-      size_t  size,
-      int     valueDimension) = 0;
+      double *     itemsToSend,
+      size_t       size,
+      int          valueDimension,
+      Compression &compression) = 0;
 
-  /// All slaves receive an array of doubles (different for each slave).
+  /// All slaves receive an array of doubles (different for each slave), decoded by compression.
   virtual void receive(
-      double *itemsToReceive,
-      size_t  size,
-      int     valueDimension) = 0;
+      double *     itemsToReceive,
+      size_t       size,
+      int          valueDimension,
+      Compression &compression) = 0;
+
+  /**
+   * @brief Posts the receive of an array of doubles, which is completed by finishReceive().
+   *
+   * By default, the values are received right away. The compression is used until
+   * finishReceive() returns and has to outlive the call.
+   */
+  virtual void startReceive(
+      double *     itemsToReceive,
+      size_t       size,
+      int          valueDimension,
+      Compression &compression)
+  {
+    receive(itemsToReceive, size, valueDimension, compression);
+  }
+
+  /// Waits until the receive posted by startReceive() has been completed.
+  virtual void finishReceive() {}
+
+  /**
+   * @brief Returns the volume and wait time of the communication with every remote rank.
+   *
+   * Empty by default, i.e., if all values are transferred over the master communication.
+   */
+  virtual std::map<int, utils::ChannelData> getStatistics() const
+  {
+    return {};
+  }
 
 protected:
   /**
@@ -54,9 +54,10 @@ void GatherScatterCommunication::closeConnection()
 }
 
 void GatherScatterCommunication::send(
-    double *itemsToSend,
-    size_t  size,
-    int     valueDimension)
+    double *     itemsToSend,
+    size_t       size,
+    int          valueDimension,
+    Compression &compression)
 {
   TRACE(size);
   assertion(utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode);
@@ -100,14 +101,15 @@ void GatherScatterCommunication::send(
     }
 
     // Send data to other master
-    _com->send(globalItemsToSend.data(), globalSize, 0);
+    compression.send(*_com, globalItemsToSend.data(), globalSize, valueDimension, 0);
   } // Master
 }
 
 void GatherScatterCommunication::receive(
-    double *itemsToReceive,
-    size_t  size,
-    int     valueDimension)
+    double *     itemsToReceive,
+    size_t       size,
+    int          valueDimension,
+    Compression &compression)
 {
   TRACE(size);
   assertion(utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode);
@@ -123,7 +125,7 @@ void GatherScatterCommunication::receive(
     int globalSize = _mesh->getGlobalNumberOfVertices() * valueDimension;
     DEBUG("Global Size = " << globalSize);
     globalItemsToReceive.resize(globalSize);
-    _com->receive(globalItemsToReceive.data(), globalSize, 0);
+    compression.receive(*_com, globalItemsToReceive.data(), globalSize, valueDimension, 0);
   }
 
   // Scatter data
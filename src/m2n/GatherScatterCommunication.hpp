@@ -64,15 +64,17 @@ public:
 
   /// Sends an array of double values from all slaves (different for each slave).
   virtual void send(
-      double *itemsToSend,
-      size_t  size,
-      int     valueDimension);
+      double *     itemsToSend,
+      size_t       size,
+      int          valueDimension,
+      Compression &compression);
 
   /// All slaves receive an array of doubles (different for each slave).
   virtual void receive(
-      double *itemsToReceive,
-      size_t  size,
-      int     valueDimension);
+      double *     itemsToReceive,
+      size_t       size,
+      int          valueDimension,
+      Compression &compression);
 
 private:
   logging::Logger _log{"m2n::GatherScatterCommunication"};
@@ -1,9 +1,12 @@
 #include "M2N.hpp"
+#include <algorithm>
 #include "DistributedComFactory.hpp"
 #include "DistributedCommunication.hpp"
 #include "com/Communication.hpp"
+#include "com/Request.hpp"
 #include "mesh/Mesh.hpp"
 #include "utils/Event.hpp"
+#include "utils/EventUtils.hpp"
 #include "utils/MasterSlave.hpp"
 #include "utils/Publisher.hpp"
 
@@ -42,6 +45,7 @@ void M2N::acceptMasterConnection(
   TRACE(acceptorName, requesterName);
 
   Event e("m2n.acceptMasterConnection", precice::syncMode);
+  _remoteName = requesterName;
 
   if (not utils::MasterSlave::_slaveMode) {
     assertion(_masterCom.use_count() > 0);
@@ -59,6 +63,7 @@ void M2N::requestMasterConnection(
   TRACE(acceptorName, requesterName);
 
   Event e("m2n.requestMasterConnection", precice::syncMode);
+  _remoteName = acceptorName;
 
   if (not utils::MasterSlave::_slaveMode) {
     assertion(_masterCom.use_count() > 0);
@@ -103,6 +108,8 @@ void M2N::requestSlavesConnection(
 void M2N::closeConnection()
 {
   TRACE();
+  finishSends();
+  reportStatistics();
   if (not utils::MasterSlave::_slaveMode && _masterCom->isConnected()) {
     _masterCom->closeConnection();
     _isMasterConnected = false;
@@ -130,6 +137,20 @@ void M2N::createDistributedCommunication(mesh::PtrMesh mesh)
 {
   DistributedCommunication::SharedPointer distCom = _distrFactory->newDistributedCommunication(mesh);
   _distComs[mesh->getID()]                        = distCom;
+  _meshNames[mesh->getID()]                       = mesh->getName();
+}
+
+void M2N::reportStatistics()
+{
+  auto &registry = utils::EventRegistry::instance();
+  if (not utils::MasterSlave::_slaveMode && _masterCom->isConnected()) {
+    registry.putChannel("m2n." + _remoteName + ".master", _masterCom->getStatistics());
+  }
+  for (const auto &pair : _distComs) {
+    if (pair.second->isConnected()) {
+      registry.putChannel("m2n." + _remoteName + "." + _meshNames[pair.first], pair.second->getStatistics());
+    }
+  }
 }
 
 void M2N::send(
@@ -137,6 +158,17 @@ void M2N::send(
     int     size,
     int     meshID,
     int     valueDimension)
+{
+  Compression none;
+  send(itemsToSend, size, meshID, valueDimension, none);
+}
+
+void M2N::send(
+    double *     itemsToSend,
+    int          size,
+    int          meshID,
+    int          valueDimension,
+    Compression &compression)
 {
   if (utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode) {
     assertion(_areSlavesConnected);
@@ -152,10 +184,10 @@ void M2N::send(
       }
     }
     Event e("m2n.sendData", precice::syncMode);
-    _distComs[meshID]->send(itemsToSend, size, valueDimension);
+    _distComs[meshID]->send(itemsToSend, size, valueDimension, compression);
   } else { //coupling mode
     assertion(_isMasterConnected);
-    _masterCom->send(itemsToSend, size, 0);
+    compression.send(*_masterCom, itemsToSend, size, valueDimension, 0);
   }
 }
 
@@ -179,6 +211,16 @@ void M2N::receive(double *itemsToReceive,
                   int     size,
                   int     meshID,
                   int     valueDimension)
+{
+  Compression none;
+  receive(itemsToReceive, size, meshID, valueDimension, none);
+}
+
+void M2N::receive(double *     itemsToReceive,
+                  int          size,
+                  int          meshID,
+                  int          valueDimension,
+                  Compression &compression)
 {
   if (utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode) {
     assertion(_areSlavesConnected);
@@ -195,10 +237,10 @@ void M2N::receive(double *itemsToReceive,
       }
     }
     Event e("m2n.receiveData", precice::syncMode);
-    _distComs[meshID]->receive(itemsToReceive, size, valueDimension);
+    _distComs[meshID]->receive(itemsToReceive, size, valueDimension, compression);
   } else { //coupling mode
     assertion(_isMasterConnected);
-    _masterCom->receive(itemsToReceive, size, 0);
+    compression.receive(*_masterCom, itemsToReceive, size, valueDimension, 0);
   }
 }
 
@@ -226,5 +268,108 @@ void M2N::receive(double &itemToReceive)
   DEBUG("receive(double): " << itemToReceive);
 }
 
+void M2N::startSend(
+    double *     itemsToSend,
+    int          size,
+    int          meshID,
+    int          valueDimension,
+    Compression &compression)
+{
+  if (utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode) {
+    // The distributed communications send asynchronously already
+    send(itemsToSend, size, meshID, valueDimension, compression);
+  } else { //coupling mode
+    assertion(_isMasterConnected);
+    Event e("m2n.sendData", precice::syncMode);
+    auto  buffer = std::make_shared<std::vector<double>>();
+    if (compression.isEnabled()) {
+      // The receiver does not know the encoded size in advance
+      compression.pack(itemsToSend, size, valueDimension, 0, *buffer);
+      auto messageSize = std::make_shared<const int>(buffer->size());
+      _pendingSends.emplace_back(_masterCom->aSend(*messageSize, 0), messageSize);
+    } else {
+      buffer->assign(itemsToSend, itemsToSend + size);
+    }
+    _pendingSends.emplace_back(_masterCom->aSend(*buffer, 0), buffer);
+  }
+}
+
+void M2N::finishSends()
+{
+  TRACE(_pendingSends.size());
+  for (auto &pending : _pendingSends) {
+    pending.first->wait();
+  }
+  _pendingSends.clear();
+}
+
+void M2N::startReceive(
+    double *     itemsToReceive,
+    int          size,
+    int          meshID,
+    int          valueDimension,
+    Compression &compression)
+{
+  if (utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode) {
+    assertion(_areSlavesConnected);
+    assertion(_distComs.find(meshID) != _distComs.end());
+    assertion(_distComs[meshID].get() != nullptr);
+
+    if (precice::syncMode) {
+      if (not utils::MasterSlave::_slaveMode) {
+        bool ack;
+
+        _masterCom->receive(ack, 0);
+        _masterCom->send(ack, 0);
+        _masterCom->receive(ack, 0);
+      }
+    }
+    // A distributed communication handles one posted receive at a time
+    if (std::find(_pendingReceiveMeshIDs.begin(), _pendingReceiveMeshIDs.end(), meshID) != _pendingReceiveMeshIDs.end()) {
+      _distComs[meshID]->finishReceive();
+    } else {
+      _pendingReceiveMeshIDs.push_back(meshID);
+    }
+    _distComs[meshID]->startReceive(itemsToReceive, size, valueDimension, compression);
+  } else { //coupling mode
+    assertion(_isMasterConnected);
+    // Reads on the same socket must not overlap, hence the previous receive has to complete first
+    completeMasterReceives();
+    _pendingReceives.push_back({nullptr, itemsToReceive, static_cast<size_t>(size), valueDimension, &compression, {}, 0});
+    PendingReceive &pending = _pendingReceives.back();
+    if (compression.isEnabled()) {
+      // The message is received in completeMasterReceives(), once its size is known
+      pending.request = _masterCom->aReceive(pending.messageSize, 0);
+    } else {
+      pending.request = _masterCom->aReceive(itemsToReceive, size, 0);
+    }
+  }
+}
+
+void M2N::finishReceives()
+{
+  TRACE(_pendingReceives.size(), _pendingReceiveMeshIDs.size());
+  Event e("m2n.receiveData", precice::syncMode);
+  for (int meshID : _pendingReceiveMeshIDs) {
+    _distComs[meshID]->finishReceive();
+  }
+  _pendingReceiveMeshIDs.clear();
+
+  completeMasterReceives();
+}
+
+void M2N::completeMasterReceives()
+{
+  for (auto &pending : _pendingReceives) {
+    pending.request->wait();
+    if (pending.compression->isEnabled()) {
+      pending.message.resize(pending.messageSize);
+      _masterCom->receive(pending.message.data(), pending.messageSize, 0);
+      pending.compression->unpack(pending.message, pending.values, pending.size, pending.valueDimension, 0);
+    }
+  }
+  _pendingReceives.clear();
+}
+
 } // namespace m2n
 } // namespace precice
@@ -1,10 +1,14 @@
 #pragma once
 
+#include "Compression.hpp"
 #include "DistributedComFactory.hpp"
 #include "com/SharedPointer.hpp"
 #include "logging/Logger.hpp"
 #include "mesh/SharedPointer.hpp"
 #include <map>
+#include <memory>
+#include <string>
+#include <vector>
 
 namespace precice
 {
@@ -83,6 +87,13 @@ public:
             int     meshID,
             int     valueDimension);
 
+  /// Sends an array of double values from all slaves, encoded by compression.
+  void send(double *     itemsToSend,
+            int          size,
+            int          meshID,
+            int          valueDimension,
+            Compression &compression);
+
   /**
    * @brief The master sends a bool to the other master, for performance reasons, we
    * neglect the gathering and checking step.
@@ -101,15 +112,69 @@ public:
                int     meshID,
                int     valueDimension);
 
+  /// All slaves receive an array of doubles, decoded by compression.
+  void receive(double *     itemsToReceive,
+               int          size,
+               int          meshID,
+               int          valueDimension,
+               Compression &compression);
+
   /// All slaves receive a bool (the same for each slave).
   void receive(bool &itemToReceive);
 
   /// All slaves receive a double (the same for each slave).
   void receive(double &itemToReceive);
 
+  /**
+   * @brief Starts sending an array of double values, which is completed by finishSends().
+   *
+   * The values are copied before the call returns. Sends of different M2N objects proceed concurrently.
+   */
+  void startSend(double *     itemsToSend,
+                 int          size,
+                 int          meshID,
+                 int          valueDimension,
+                 Compression &compression);
+
+  /// Waits until all sends started by startSend() have been completed.
+  void finishSends();
+
+  /**
+   * @brief Posts the receive of an array of double values, which is completed by finishReceives().
+   *
+   * The values must not be accessed before finishReceives() returns. Receives of different
+   * meshes and of different M2N objects proceed concurrently. In coupling mode, the receives
+   * of one M2N object share the master communication and complete one after the other.
+   * The compression is used until finishReceives() returns and has to outlive the call.
+   */
+  void startReceive(double *     itemsToReceive,
+                    int          size,
+                    int          meshID,
+                    int          valueDimension,
+                    Compression &compression);
+
+  /// Waits until all receives posted by startReceive() have been completed.
+  void finishReceives();
+
 private:
   logging::Logger _log{"m2n::M2N"};
 
+  /**
+   * @brief Records the volume and wait time of the master and the distributed communications in the EventRegistry.
+   *
+   * The channels are named m2n.<remote participant>.master and m2n.<remote participant>.<mesh>.
+   */
+  void reportStatistics();
+
+  /// Waits for the receives of the master communication posted by startReceive() in coupling mode.
+  void completeMasterReceives();
+
+  /// Name of the remote participant, used to name the channels
+  std::string _remoteName;
+
+  /// mesh::getID() -> Name of the mesh of the distributed communication
+  std::map<int, std::string> _meshNames;
+
   /// mesh::getID() -> Pointer to distributed communication
   std::map<int, DistributedCommunication::SharedPointer> _distComs;
 
@@ -120,6 +185,27 @@ private:
   bool _isMasterConnected = false;
 
   bool _areSlavesConnected = false;
+
+  /// Receive of the master communication posted by startReceive() in coupling mode.
+  struct PendingReceive {
+    com::PtrRequest     request;
+    double *            values;
+    size_t              size;
+    int                 valueDimension;
+    Compression *       compression;
+    /// Packed values, if the received data is compressed or sent as delta
+    std::vector<double> message;
+    /// Number of packed values, received ahead of them
+    int messageSize;
+  };
+
+  std::vector<PendingReceive> _pendingReceives;
+
+  /// Meshes with receives posted by startReceive() in master-slave mode.
+  std::vector<int> _pendingReceiveMeshIDs;
+
+  /// Sends started by startSend() in coupling mode together with the copies of the sent values.
+  std::vector<std::pair<com::PtrRequest, std::shared_ptr<const void>>> _pendingSends;
 };
 
 } // namespace m2n
@@ -1,5 +1,9 @@
 #include "PointToPointCommunication.hpp"
+#include "CompactVertexDistribution.hpp"
+#include <algorithm>
 #include <iomanip>
+#include <set>
+#include <sstream>
 #include <vector>
 #include <thread>
 #include "com/Communication.hpp"
@@ -18,72 +22,117 @@ bool extern syncMode;
 namespace m2n
 {
 
-void send(mesh::Mesh::VertexDistribution const &m,
-          int                                    rankReceiver,
-          com::PtrCommunication                  communication)
+/// Sends every slave the global indices of its vertices and returns the ones of the calling rank.
+std::vector<int> scatterLocalIndices(mesh::Mesh::VertexDistribution const &m)
 {
-  communication->send(static_cast<int>(m.size()), rankReceiver);
+  std::vector<int> localIndices;
 
-  for (auto const &i : m) {
-    auto const &rank    = i.first;
-    auto const &indices = i.second;
-    communication->send(rank, rankReceiver);
-    communication->send(indices, rankReceiver);
+  if (utils::MasterSlave::_masterMode) {
+    const std::vector<int> noIndices;
+    for (int rank = 1; rank < utils::MasterSlave::_size; ++rank) {
+      auto iterator = m.find(rank);
+      utils::MasterSlave::_communication->send(iterator != m.end() ? iterator->second : noIndices, rank);
+    }
+    auto iterator = m.find(0);
+    if (iterator != m.end()) {
+      localIndices = iterator->second;
+    }
+  } else {
+    assertion(utils::MasterSlave::_slaveMode);
+    utils::MasterSlave::_communication->receive(localIndices, 0);
   }
+  return localIndices;
 }
 
-void receive(mesh::Mesh::VertexDistribution &m,
-             int                              rankSender,
-             com::PtrCommunication            communication)
+void broadcast(CompactVertexDistribution &distribution)
 {
-  m.clear();
-  int size = 0;
-  communication->receive(size, rankSender);
-
-  while (size--) {
-    int rank = -1;
-    communication->receive(rank, rankSender);
-    communication->receive(m[rank], rankSender);
+  if (utils::MasterSlave::_masterMode) {
+    // Broadcast (send) vertex distribution.
+    utils::MasterSlave::_communication->broadcast(static_cast<const std::vector<int> &>(distribution.data()));
+  } else {
+    assertion(utils::MasterSlave::_slaveMode);
+    // Broadcast (receive) vertex distribution.
+    utils::MasterSlave::_communication->broadcast(distribution.data(), 0);
   }
 }
 
-void broadcastSend(mesh::Mesh::VertexDistribution const &m,
-                   com::PtrCommunication                  communication = utils::MasterSlave::_communication)
+/// Encodes the addresses of ranks as one line "rank address" per rank.
+std::string serializeAddresses(std::map<int, std::string> const &addresses)
 {
-  communication->broadcast(static_cast<int>(m.size()));
+  std::ostringstream oss;
+  for (auto const &address : addresses) {
+    oss << address.first << ' ' << address.second << '\n';
+  }
+  return oss.str();
+}
 
-  for (auto const &i : m) {
-    auto const &rank    = i.first;
-    auto const &indices = i.second;
-    communication->broadcast(rank);
-    communication->broadcast(indices);
+std::map<int, std::string> deserializeAddresses(std::string const &s)
+{
+  std::map<int, std::string> addresses;
+  std::istringstream         iss(s);
+  int                        rank;
+  while (iss >> rank) {
+    iss.ignore(1);
+    std::getline(iss, addresses[rank]);
   }
+  return addresses;
 }
 
-void broadcastReceive(mesh::Mesh::VertexDistribution &m,
-                      int                              rankBroadcaster,
-                      com::PtrCommunication            communication = utils::MasterSlave::_communication)
+/// Gathers the server addresses of all ranks at the master, ranks without a server pass an empty address.
+std::map<int, std::string> gatherAddresses(std::string const &address)
 {
-  m.clear();
-  int size = 0;
-  communication->broadcast(size, rankBroadcaster);
+  std::map<int, std::string> addresses;
 
-  while (size--) {
-    int rank = -1;
-    communication->broadcast(rank, rankBroadcaster);
-    communication->broadcast(m[rank], rankBroadcaster);
+  if (utils::MasterSlave::_masterMode) {
+    if (not address.empty()) {
+      addresses[0] = address;
+    }
+    std::string s;
+    for (int rank = 1; rank < utils::MasterSlave::_size; ++rank) {
+      utils::MasterSlave::_communication->receive(s, rank);
+      if (not s.empty()) {
+        addresses[rank] = s;
+      }
+    }
+  } else {
+    assertion(utils::MasterSlave::_slaveMode);
+    utils::MasterSlave::_communication->send(address, 0);
   }
+  return addresses;
 }
 
-void broadcast(mesh::Mesh::VertexDistribution &m)
+/**
+ * @brief Hands every rank the addresses of the remote ranks it connects to.
+ *
+ * Only the master knows the addresses of all remote ranks. Every slave sends the remote ranks
+ * it connects to and receives only their addresses.
+ */
+std::map<int, std::string> scatterAddresses(std::map<int, std::string> const &addresses, std::set<int> const &remoteRanks)
 {
+  auto select = [&addresses](std::vector<int> const &ranks) {
+    std::map<int, std::string> selected;
+    for (int rank : ranks) {
+      auto iterator = addresses.find(rank);
+      if (iterator != addresses.end()) {
+        selected.insert(*iterator);
+      }
+    }
+    return selected;
+  };
+
   if (utils::MasterSlave::_masterMode) {
-    // Broadcast (send) vertex distributions.
-    m2n::broadcastSend(m);
+    std::vector<int> ranks;
+    for (int rank = 1; rank < utils::MasterSlave::_size; ++rank) {
+      utils::MasterSlave::_communication->receive(ranks, rank);
+      utils::MasterSlave::_communication->send(serializeAddresses(select(ranks)), rank);
+    }
+    return select(std::vector<int>(remoteRanks.begin(), remoteRanks.end()));
   } else {
     assertion(utils::MasterSlave::_slaveMode);
-    // Broadcast (receive) vertex distributions.
-    m2n::broadcastReceive(m, 0);
+    std::string s;
+    utils::MasterSlave::_communication->send(std::vector<int>(remoteRanks.begin(), remoteRanks.end()), 0);
+    utils::MasterSlave::_communication->receive(s, 0);
+    return deserializeAddresses(s);
   }
 }
 
@@ -219,42 +268,6 @@ void printLocalIndexCountStats(std::map<int, std::vector<int>> const &m)
   }
 }
 
-// The approximate complexity of this function is O((number of local data
-// indices for the current rank in `thisVertexDistribution') * (total number of
-// data indices for all ranks in `otherVertexDistribution')).
-std::map<int, std::vector<int>> buildCommunicationMap(
-    // `thisVertexDistribution' is input vertex distribution from this participant.
-    mesh::Mesh::VertexDistribution const &thisVertexDistribution,
-    // `otherVertexDistribution' is input vertex distribution from other participant.
-    mesh::Mesh::VertexDistribution const &otherVertexDistribution,
-    int                                    thisRank = utils::MasterSlave::_rank)
-{
-  std::map<int, std::vector<int>> communicationMap;
-
-  auto iterator = thisVertexDistribution.find(thisRank);
-
-  if (iterator == thisVertexDistribution.end())
-    return communicationMap;
-
-  auto const &indices = iterator->second;
-
-  int index = 0;
-
-  for (int thisIndex : indices) {
-    for (const auto &other : otherVertexDistribution) {
-      for (const auto &otherIndex : other.second) {
-        if (thisIndex == otherIndex) {
-          communicationMap[other.first].push_back(index);
-          break;
-        }
-      }
-    }
-    ++index;
-  }
-
-  return communicationMap;
-}
-
 PointToPointCommunication::PointToPointCommunication(
     com::PtrCommunicationFactory communicationFactory,
     mesh::PtrMesh                mesh)
@@ -284,12 +297,14 @@ void PointToPointCommunication::acceptConnection(std::string const &acceptorName
             << "Please use distribution-type gather-scatter instead.");
 
   mesh::Mesh::VertexDistribution &vertexDistribution = _mesh->getVertexDistribution();
-  mesh::Mesh::VertexDistribution  requesterVertexDistribution;
+  CompactVertexDistribution       requesterVertexDistribution;
+  com::PtrCommunication           masterCommunication;
 
   if (utils::MasterSlave::_masterMode) {
     Event e0("m2n.exchangeVertexDistribution");
     // Establish connection between participants' master processes.
-    auto c = _communicationFactory->newCommunication();
+    masterCommunication = _communicationFactory->newCommunication();
+    auto &c             = masterCommunication;
 
     c->acceptConnection(acceptorName, requesterName, utils::MasterSlave::_rank);
 
@@ -300,14 +315,15 @@ void PointToPointCommunication::acceptConnection(std::string const &acceptorName
     c->receive(requesterMasterRank, 0);
 
     // Exchange vertex distributions.
-    m2n::send(vertexDistribution, 0, c);
-    m2n::receive(requesterVertexDistribution, 0, c);
+    c->send(CompactVertexDistribution(vertexDistribution).data(), 0);
+    c->receive(requesterVertexDistribution.data(), 0);
   } else {
     assertion(utils::MasterSlave::_slaveMode);
   }
 
   Event e1("m2n.broadcastVertexDistributions", precice::syncMode);
-  m2n::broadcast(vertexDistribution);
+  // Every rank only needs its own indices and the compact distribution of the remote participant
+  std::vector<int> localIndices = m2n::scatterLocalIndices(vertexDistribution);
   m2n::broadcast(requesterVertexDistribution);
   e1.stop();
 
@@ -329,8 +345,7 @@ void PointToPointCommunication::acceptConnection(std::string const &acceptorName
   // - has to communicate (send/receive) data with local indices 0 and 2 with
   //   the remote process with rank 4.
   Event e2("m2n.buildCommunicationMap", precice::syncMode);
-  std::map<int, std::vector<int>> communicationMap = m2n::buildCommunicationMap(
-    vertexDistribution, requesterVertexDistribution);
+  std::map<int, std::vector<int>> communicationMap = requesterVertexDistribution.communicationMap(localIndices);
   e2.stop();
 
 // Print `communicationMap'.
@@ -362,16 +377,28 @@ void PointToPointCommunication::acceptConnection(std::string const &acceptorName
 #endif
 
   Event e4("m2n.createCommunications");
-  if (communicationMap.empty()) {
-    _isConnected = true;
-    return;
-  }
-
   // Accept point-to-point connections (as server) between the current acceptor
   // process (in the current participant) with rank `utils::MasterSlave::_rank'
   // and (multiple) requester processes (in the requester participant).
+  com::PtrCommunication c;
+  std::string           address;
+  if (not communicationMap.empty()) {
+    c       = _communicationFactory->newCommunication();
+    address = c->prepareConnectionAsServer();
+  }
 
-  auto c = _communicationFactory->newCommunication();
+  // Only the masters have found each other via address file. The server addresses of all
+  // ranks are passed on over the master-slave and the master-master communication.
+  std::map<int, std::string> addresses = gatherAddresses(address);
+  if (utils::MasterSlave::_masterMode) {
+    masterCommunication->send(serializeAddresses(addresses), 0);
+    masterCommunication.reset();
+  }
+
+  if (communicationMap.empty()) {
+    _isConnected = true;
+    return;
+  }
 
 #ifdef SuperMUC_WORK
   Publisher::ScopedPushDirectory spd("." + acceptorName + "-" + _mesh->getName() + "-" +
@@ -400,7 +427,7 @@ void PointToPointCommunication::acceptConnection(std::string const &acceptorName
       therefore, for data structure consistency of `_mappings' with the requester participant side, 
       we simply duplicate references to the same communication object `c'.
     */
-    _mappings.push_back({globalRequesterRank, std::move(indices), c, com::PtrRequest(), {}});
+    _mappings.push_back({globalRequesterRank, std::move(indices), c, com::PtrRequest(), {}, {}});
   }
   e4.stop();
   _isConnected = true;
@@ -416,12 +443,14 @@ void PointToPointCommunication::requestConnection(std::string const &acceptorNam
         << "Please use distribution-type gather-scatter instead.");
 
   mesh::Mesh::VertexDistribution &vertexDistribution = _mesh->getVertexDistribution();
-  mesh::Mesh::VertexDistribution  acceptorVertexDistribution;
+  CompactVertexDistribution       acceptorVertexDistribution;
+  com::PtrCommunication           masterCommunication;
 
   if (utils::MasterSlave::_masterMode) {
     Event e0("m2n.exchangeVertexDistribution");
     // Establish connection between participants' master processes.
-    auto c = _communicationFactory->newCommunication();
+    masterCommunication = _communicationFactory->newCommunication();
+    auto &c             = masterCommunication;
     c->requestConnection(acceptorName, requesterName, 0, 1);
 
     int acceptorMasterRank;
@@ -431,14 +460,15 @@ void PointToPointCommunication::requestConnection(std::string const &acceptorNam
     c->send(utils::MasterSlave::_masterRank, 0);
 
     // Exchange vertex distributions.
-    m2n::receive(acceptorVertexDistribution, 0, c);
-    m2n::send(vertexDistribution, 0, c);
+    c->receive(acceptorVertexDistribution.data(), 0);
+    c->send(CompactVertexDistribution(vertexDistribution).data(), 0);
   } else {
     assertion(utils::MasterSlave::_slaveMode);
   }
 
   Event e1("m2n.broadcastVertexDistributions", precice::syncMode);
-  m2n::broadcast(vertexDistribution);
+  // Every rank only needs its own indices and the compact distribution of the remote participant
+  std::vector<int> localIndices = m2n::scatterLocalIndices(vertexDistribution);
   m2n::broadcast(acceptorVertexDistribution);
   e1.stop();
 
@@ -460,8 +490,7 @@ void PointToPointCommunication::requestConnection(std::string const &acceptorNam
   // - has to communicate (send/receive) data with local indices 0 and 2 with
   //   the remote process with rank 4.
   Event e2("m2n.buildCommunicationMap", precice::syncMode);
-  std::map<int, std::vector<int>> communicationMap = m2n::buildCommunicationMap(
-    vertexDistribution, acceptorVertexDistribution);
+  std::map<int, std::vector<int>> communicationMap = acceptorVertexDistribution.communicationMap(localIndices);
   e2.stop();
 
 // Print `communicationMap'.
@@ -485,6 +514,21 @@ void PointToPointCommunication::requestConnection(std::string const &acceptorNam
 #endif
 
   Event e4("m2n.createCommunications");
+  std::set<int> acceptingRanks;
+  for (auto &i : communicationMap)
+    acceptingRanks.emplace(i.first);
+
+  // Receive the server addresses of the acceptor ranks over the master-master and the
+  // master-slave communication instead of reading one address file per acceptor rank.
+  std::map<int, std::string> addresses;
+  if (utils::MasterSlave::_masterMode) {
+    std::string s;
+    masterCommunication->receive(s, 0);
+    masterCommunication.reset();
+    addresses = deserializeAddresses(s);
+  }
+  addresses = scatterAddresses(addresses, acceptingRanks);
+
   if (communicationMap.empty()) {
     _isConnected = true;
     return;
@@ -494,13 +538,14 @@ void PointToPointCommunication::requestConnection(std::string const &acceptorNam
   requests.reserve(communicationMap.size());
   _mappings.reserve(communicationMap.size());
 
-  std::set<int> acceptingRanks;
-  for (auto &i : communicationMap)
-    acceptingRanks.emplace(i.first);
-
   auto c = _communicationFactory->newCommunication();
-  c->requestConnectionAsClient(acceptorName, requesterName,
-                               acceptingRanks, utils::MasterSlave::_rank);
+  if (addresses.size() == acceptingRanks.size()) {
+    c->requestConnectionAtAddresses(addresses, utils::MasterSlave::_rank);
+  } else {
+    // The communication can only publish its addresses by file
+    c->requestConnectionAsClient(acceptorName, requesterName,
+                                 acceptingRanks, utils::MasterSlave::_rank);
+  }
 
   // Request point-to-point connections (as client) between the current
   // requester process (in the current participant) and (multiple) acceptor
@@ -520,7 +565,7 @@ void PointToPointCommunication::requestConnection(std::string const &acceptorNam
     // On the requester participant side, the communication objects behave
     // as clients, i.e. each of them requests only one connection to
     // acceptor process (in the acceptor participant).
-    _mappings.push_back({globalAcceptorRank, std::move(indices), c, com::PtrRequest(), {}});
+    _mappings.push_back({globalAcceptorRank, std::move(indices), c, com::PtrRequest(), {}, {}});
   }
   e4.stop();
   _isConnected = true;
@@ -543,9 +588,16 @@ void PointToPointCommunication::closeConnection()
   _isConnected     = false;
 }
 
-void PointToPointCommunication::send(double *itemsToSend,
-                                     size_t  size,
-                                     int     valueDimension)
+void PointToPointCommunication::send(double *itemsToSend, size_t size, int valueDimension)
+{
+  Compression none;
+  send(itemsToSend, size, valueDimension, none);
+}
+
+void PointToPointCommunication::send(double *     itemsToSend,
+                                     size_t       size,
+                                     int          valueDimension,
+                                     Compression &compression)
 {
 
   if (_mappings.empty()) {
@@ -560,29 +612,46 @@ void PointToPointCommunication::send(double *itemsToSend,
         buffer->push_back(itemsToSend[index * valueDimension + d]);
       }
     }
+    if (compression.isEnabled()) {
+      // The receiver does not know the encoded size in advance
+      auto packed = std::make_shared<std::vector<double>>();
+      compression.pack(buffer->data(), buffer->size(), valueDimension, mapping.remoteRank, *packed);
+      auto packedSize = std::make_shared<const int>(packed->size());
+      bufferedRequests.emplace_back(mapping.communication->aSend(*packedSize, mapping.remoteRank), packedSize);
+      buffer = packed;
+    }
     auto request = mapping.communication->aSend(*buffer, mapping.remoteRank);
     bufferedRequests.emplace_back(request, buffer);
   }
 
-  /* Disable asynchronous sending
-   * For SocketCommunuication, an async send request is given to asio::async_write and from that
-   * written to the operating system TCP queues using multiple function calls. 
-   * Problem 1) Simultaneous invocations of async_write on the same socket could be problematic.
-   * Problem 2) Writes from async_write to the OS queues could interfere with other writes
-   * (asio::write or asio::async_write) on the same sockets and thus changing order or requests.
-   * Since preCICE does not implement its own method to ensure correct ordering, this can lead to
-   * garbled data.
-   * See:
-   * https://lists.boost.org/Archives/boost/2018/10/243612.php
-   * https://www.boost.org/doc/libs/1_68_0/doc/html/boost_asio/reference/async_write/overload1.html
-   */
-  checkBufferedRequests(true);
+  // The sends complete in the background, only release the buffers of completed ones here.
+  // Remaining requests are waited for when the connection is closed.
+  checkBufferedRequests(false);
 }
 
 void PointToPointCommunication::receive(double *itemsToReceive,
                                         size_t  size,
                                         int     valueDimension)
 {
+  Compression none;
+  receive(itemsToReceive, size, valueDimension, none);
+}
+
+void PointToPointCommunication::receive(double *     itemsToReceive,
+                                        size_t       size,
+                                        int          valueDimension,
+                                        Compression &compression)
+{
+  startReceive(itemsToReceive, size, valueDimension, compression);
+  finishReceive();
+}
+
+void PointToPointCommunication::startReceive(double *     itemsToReceive,
+                                             size_t       size,
+                                             int          valueDimension,
+                                             Compression &compression)
+{
+  assertion(_pendingItems == nullptr);
   if (_mappings.empty()) {
     return;
   }
@@ -591,20 +660,67 @@ void PointToPointCommunication::receive(double *itemsToReceive,
 
   for (auto &mapping : _mappings) {
     mapping.recvBuffer.resize(mapping.indices.size() * valueDimension);
-    mapping.request = mapping.communication->aReceive(mapping.recvBuffer, mapping.remoteRank);
+    if (compression.isEnabled()) {
+      // The packed values are received in finishReceive(), once their number is known
+      mapping.request = mapping.communication->aReceive(mapping.packedSize, mapping.remoteRank);
+    } else {
+      mapping.request = mapping.communication->aReceive(mapping.recvBuffer, mapping.remoteRank);
+    }
+  }
+
+  _pendingItems          = itemsToReceive;
+  _pendingValueDimension = valueDimension;
+  _pendingCompression    = &compression;
+}
+
+void PointToPointCommunication::finishReceive()
+{
+  if (_pendingItems == nullptr) {
+    return;
+  }
+
+  if (_pendingCompression->isEnabled()) {
+    for (auto &mapping : _mappings) {
+      mapping.request->wait();
+      mapping.packedBuffer.resize(mapping.packedSize);
+      mapping.request = mapping.communication->aReceive(mapping.packedBuffer, mapping.remoteRank);
+    }
   }
 
+  const int valueDimension = _pendingValueDimension;
   for (auto &mapping : _mappings) {
     mapping.request->wait();
+    if (_pendingCompression->isEnabled()) {
+      _pendingCompression->unpack(mapping.packedBuffer, mapping.recvBuffer.data(), mapping.recvBuffer.size(),
+                                  valueDimension, mapping.remoteRank);
+    }
 
     int i = 0;
     for (auto index : mapping.indices) {
       for (int d = 0; d < valueDimension; ++d) {
-        itemsToReceive[index * valueDimension + d] += mapping.recvBuffer[i * valueDimension + d];
+        _pendingItems[index * valueDimension + d] += mapping.recvBuffer[i * valueDimension + d];
       }
       i++;
     }
   }
+  _pendingItems       = nullptr;
+  _pendingCompression = nullptr;
+}
+
+std::map<int, utils::ChannelData> PointToPointCommunication::getStatistics() const
+{
+  // The acceptor side uses one communication for all mappings
+  std::set<com::Communication *> communications;
+  for (auto const &mapping : _mappings) {
+    communications.insert(mapping.communication.get());
+  }
+  std::map<int, utils::ChannelData> statistics;
+  for (auto communication : communications) {
+    for (auto const &remote : communication->getStatistics()) {
+      statistics[remote.first] += remote.second;
+    }
+  }
+  return statistics;
 }
 
 void PointToPointCommunication::checkBufferedRequests(bool blocking)
@@ -62,15 +62,39 @@ public:
    * @brief Sends a subset of local double values corresponding to local indices
    *        deduced from the current and remote vertex distributions.
    */
-  virtual void send(double *itemsToSend, size_t size, int valueDimension = 1);
+  void send(double *itemsToSend, size_t size, int valueDimension = 1);
+
+  /// Sends the values as send() does, encoded by compression.
+  virtual void send(double *     itemsToSend,
+                    size_t       size,
+                    int          valueDimension,
+                    Compression &compression);
 
   /**
    * @brief Receives a subset of local double values corresponding to local
    *        indices deduced from the current and remote vertex distributions.
    */
-  virtual void receive(double *itemsToReceive,
-                       size_t  size,
-                       int     valueDimension = 1);
+  void receive(double *itemsToReceive,
+               size_t  size,
+               int     valueDimension = 1);
+
+  /// Receives the values as receive() does, decoded by compression.
+  virtual void receive(double *     itemsToReceive,
+                       size_t       size,
+                       int          valueDimension,
+                       Compression &compression);
+
+  /// Posts the receives from all remote ranks, which are completed by finishReceive().
+  virtual void startReceive(double *     itemsToReceive,
+                            size_t       size,
+                            int          valueDimension,
+                            Compression &compression);
+
+  /// Waits for the receives posted by startReceive() and scatters the values to the local indices.
+  virtual void finishReceive();
+
+  /// Returns the volume and wait time of the communication with every connected remote rank.
+  virtual std::map<int, utils::ChannelData> getStatistics() const;
 
 private:
   logging::Logger _log{"m2n::PointToPointCommunication"};
@@ -98,6 +122,10 @@ private:
     com::PtrCommunication communication;
     com::PtrRequest       request;
     std::vector<double>   recvBuffer;
+    /// Packed values, if the received data is compressed or sent as delta
+    std::vector<double> packedBuffer;
+    /// Number of packed values, received ahead of them
+    int packedSize;
   };
 
   /**
@@ -108,8 +136,16 @@ private:
 
   bool _isConnected = false;
 
+  /// Destination of the receive posted by startReceive(), nullptr if none is pending.
+  double *_pendingItems = nullptr;
+
+  int _pendingValueDimension = 1;
+
+  Compression *_pendingCompression = nullptr;
+
+  /// Sends in flight together with the sent buffers, which have to outlive them.
   std::list<std::pair<std::shared_ptr<com::Request>,
-                      std::shared_ptr<std::vector<double>>>> bufferedRequests;
+                      std::shared_ptr<const void>>> bufferedRequests;
 
 };
 } // namespace m2n
@@ -3,6 +3,7 @@
 #include "com/MPIDirectCommunication.hpp"
 #include "com/MPIPortsCommunicationFactory.hpp"
 #include "com/MPISinglePortsCommunicationFactory.hpp"
+#include "com/SharedMemoryCommunicationFactory.hpp"
 #include "com/SocketCommunicationFactory.hpp"
 #include "m2n/DistributedComFactory.hpp"
 #include "m2n/GatherScatterComFactory.hpp"
@@ -56,6 +57,27 @@ M2NConfiguration::M2NConfiguration(xml::XMLTag &parent)
     tag.addAttribute(attrExchangeDirectory);
     tags.push_back(tag);
   }
+  {
+    XMLTag tag(*this, "shared-memory", occ, TAG);
+    doc = "Communication via ring buffers in shared memory. Requires that all ranks of both ";
+    doc += "participants run on the same host.";
+    tag.setDocumentation(doc);
+
+    XMLAttribute<int> attrBufferSize("buffer-size");
+    doc = "Capacity in bytes of the ring buffer used for each direction of a connection. Default is 4 MiB.";
+    attrBufferSize.setDocumentation(doc);
+    attrBufferSize.setDefaultValue(1 << 22);
+    tag.addAttribute(attrBufferSize);
+
+    XMLAttribute<std::string> attrExchangeDirectory(ATTR_EXCHANGE_DIRECTORY);
+    doc = "Directory where connection information is exchanged. By default, the ";
+    doc += "directory of startup is chosen, and both solvers have to be started ";
+    doc += "in the same directory.";
+    attrExchangeDirectory.setDocumentation(doc);
+    attrExchangeDirectory.setDefaultValue("");
+    tag.addAttribute(attrExchangeDirectory);
+    tags.push_back(tag);
+  }
   {
     XMLTag tag(*this, "mpi", occ, TAG);
     doc = "Communication via MPI with startup in separated communication spaces, using multiple communicators.";
@@ -123,7 +145,7 @@ M2NConfiguration::M2NConfiguration(xml::XMLTag &parent)
   for (XMLTag &tag : tags) {
     tag.addAttribute(attrFrom);
     tag.addAttribute(attrTo);
-    if (tag.getName() == "mpi" || tag.getName() == "mpi-singleports" || tag.getName() == "sockets") {
+    if (tag.getName() == "mpi" || tag.getName() == "mpi-singleports" || tag.getName() == "sockets" || tag.getName() == "shared-memory") {
       tag.addAttribute(attrDistrTypeBoth);
     } else {
       tag.addAttribute(attrDistrTypeOnly);
@@ -167,6 +189,18 @@ void M2NConfiguration::xmlTagCallback(xml::XMLTag &tag)
       std::string dir = tag.getStringAttributeValue(ATTR_EXCHANGE_DIRECTORY);
       comFactory      = std::make_shared<com::SocketCommunicationFactory>(port, false, network, dir);
       com             = comFactory->newCommunication();
+    } else if (tag.getName() == "shared-memory") {
+      std::string dir = tag.getStringAttributeValue(ATTR_EXCHANGE_DIRECTORY);
+#ifdef PRECICE_NO_SHARED_MEMORY
+      std::ostringstream error;
+      error << "Communication type \"shared-memory\" is not available on this platform";
+      throw error.str();
+#else
+      int bufferSize = tag.getIntAttributeValue("buffer-size");
+      CHECK(bufferSize > 0, "The value given for the \"buffer-size\" attribute has to be positive: " << bufferSize);
+      comFactory = std::make_shared<com::SharedMemoryCommunicationFactory>(dir, bufferSize);
+      com        = comFactory->newCommunication();
+#endif
     } else if (tag.getName() == "mpi") {
       std::string dir = tag.getStringAttributeValue(ATTR_EXCHANGE_DIRECTORY);
 #ifdef PRECICE_NO_MPI
@@ -207,7 +241,7 @@ void M2NConfiguration::xmlTagCallback(xml::XMLTag &tag)
       assertion(distrType == VALUE_GATHER_SCATTER);
       distrFactory = std::make_shared<GatherScatterComFactory>(com);
     } else if (distrType == VALUE_POINT_TO_POINT) {
-      assertion(tag.getName() == "mpi" or tag.getName() == "mpi-singleports" or tag.getName() == "sockets");
+      assertion(tag.getName() == "mpi" or tag.getName() == "mpi-singleports" or tag.getName() == "sockets" or tag.getName() == "shared-memory");
       distrFactory = std::make_shared<PointToPointComFactory>(comFactory);
     }
     assertion(distrFactory.get() != nullptr);
@@ -0,0 +1,96 @@
+#include <algorithm>
+#include "m2n/CompactVertexDistribution.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::m2n;
+
+BOOST_AUTO_TEST_SUITE(M2NTests)
+BOOST_AUTO_TEST_SUITE(CompactVertexDistributionTests)
+
+namespace
+{
+/// Distribution of blocks of consecutive indices, where neighbouring ranks share the vertices at their common border.
+mesh::Mesh::VertexDistribution blockDistribution(int ranks, int verticesPerRank)
+{
+  mesh::Mesh::VertexDistribution distribution;
+  for (int rank = 0; rank < ranks; rank++) {
+    auto &indices = distribution[rank];
+    for (int index = rank * verticesPerRank; index <= (rank + 1) * verticesPerRank; index++) {
+      indices.push_back(index);
+    }
+    // Vertices are not stored in ascending order, e.g., when reordered along a space-filling curve
+    std::reverse(indices.begin(), indices.end());
+  }
+  return distribution;
+}
+
+/// Communication map computed by comparing all pairs of indices.
+std::map<int, std::vector<int>> bruteForceMap(const std::vector<int> &localIndices, const mesh::Mesh::VertexDistribution &other)
+{
+  std::vector<int> positions(localIndices.size());
+  for (size_t i = 0; i < positions.size(); i++) {
+    positions[i] = static_cast<int>(i);
+  }
+  std::sort(positions.begin(), positions.end(), [&localIndices](int lhs, int rhs) {
+    return localIndices[lhs] < localIndices[rhs];
+  });
+
+  std::map<int, std::vector<int>> communicationMap;
+  for (int position : positions) {
+    for (const auto &entry : other) {
+      if (std::find(entry.second.begin(), entry.second.end(), localIndices[position]) != entry.second.end()) {
+        communicationMap[entry.first].push_back(position);
+      }
+    }
+  }
+  return communicationMap;
+}
+
+mesh::Mesh::VertexDistribution sorted(mesh::Mesh::VertexDistribution distribution)
+{
+  for (auto &entry : distribution) {
+    std::sort(entry.second.begin(), entry.second.end());
+  }
+  return distribution;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(Ranges)
+{
+  mesh::Mesh::VertexDistribution distribution = blockDistribution(4, 100);
+  distribution[2].push_back(1000);
+  distribution[5]; // rank without vertices
+
+  CompactVertexDistribution compact(distribution);
+  distribution.erase(5);
+  BOOST_TEST(compact.expand() == sorted(distribution));
+  // (rank, type, count) and one range per rank, two for rank 2
+  BOOST_TEST(compact.data().size() == 4 * 5 + 2);
+}
+
+BOOST_AUTO_TEST_CASE(ListFallback)
+{
+  mesh::Mesh::VertexDistribution distribution;
+  distribution[0] = {9, 3, 7, 5, 1, 2};
+  distribution[1] = {4, 4};
+
+  CompactVertexDistribution compact(distribution);
+  BOOST_TEST(compact.data().size() == 3 + 6 + 3 + 1);
+  distribution[1] = {4};
+  BOOST_TEST(compact.expand() == sorted(distribution));
+}
+
+BOOST_AUTO_TEST_CASE(CommunicationMap)
+{
+  mesh::Mesh::VertexDistribution other = blockDistribution(5, 7);
+  other[3]                             = {40, 22, 30, 21};
+  std::vector<int> localIndices{30, 8, 7, 35, 0, 21, 14, 99, 22, 15, 6};
+
+  CompactVertexDistribution compact(other);
+  BOOST_TEST(compact.communicationMap(localIndices) == bruteForceMap(localIndices, other));
+  BOOST_TEST(compact.communicationMap({}).empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // CompactVertexDistributionTests
+BOOST_AUTO_TEST_SUITE_END() // M2NTests
@@ -0,0 +1,159 @@
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "m2n/Compression.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::m2n;
+
+BOOST_AUTO_TEST_SUITE(M2NTests)
+BOOST_AUTO_TEST_SUITE(CompressionTests)
+
+namespace
+{
+/// Smooth displacements of a 2D grid of vertices with valueDimension components.
+std::vector<double> smoothField(size_t vertices, int valueDimension)
+{
+  std::vector<double> values(vertices * valueDimension);
+  const size_t        rowLength = static_cast<size_t>(std::sqrt(vertices)) + 1;
+  for (size_t i = 0; i < vertices; i++) {
+    double x = static_cast<double>(i % rowLength) / rowLength;
+    double y = static_cast<double>(i / rowLength) / rowLength;
+    for (int d = 0; d < valueDimension; d++) {
+      values[i * valueDimension + d] = 1e-3 * (d + 1) * std::sin(3.0 * x + d) * std::cos(2.0 * y);
+    }
+  }
+  return values;
+}
+
+std::vector<double> roundTrip(const Compression &compression, const std::vector<double> &values, int valueDimension)
+{
+  std::vector<double> packed;
+  compression.encode(values.data(), values.size(), valueDimension, packed);
+  std::vector<double> decoded(values.size(), -1.0);
+  compression.decode(packed, decoded.data(), decoded.size(), valueDimension);
+  return decoded;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(Lossless)
+{
+  Compression         compression(Compression::Type::LOSSLESS);
+  std::vector<double> values = smoothField(1000, 3);
+  values.push_back(0.0);
+  values.push_back(-0.0);
+  values.push_back(std::numeric_limits<double>::infinity());
+  values.push_back(std::numeric_limits<double>::denorm_min());
+  values.insert(values.end(), 300, 0.0);
+
+  std::vector<double> decoded = roundTrip(compression, values, 3);
+  BOOST_TEST(decoded.size() == values.size());
+  for (size_t i = 0; i < values.size(); i++) {
+    BOOST_TEST(std::signbit(decoded[i]) == std::signbit(values[i]));
+    BOOST_TEST(decoded[i] == values[i]);
+  }
+
+  std::vector<double> packed;
+  compression.encode(values.data(), values.size(), 3, packed);
+  BOOST_TEST(packed.size() < values.size());
+}
+
+BOOST_AUTO_TEST_CASE(Float)
+{
+  Compression         compression(Compression::Type::FLOAT);
+  std::vector<double> values  = smoothField(1000, 2);
+  std::vector<double> decoded = roundTrip(compression, values, 2);
+  for (size_t i = 0; i < values.size(); i++) {
+    BOOST_TEST(std::abs(decoded[i] - values[i]) <= 1e-7 * std::abs(values[i]));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Quantize)
+{
+  const double        tolerance = 1e-8;
+  Compression         compression(Compression::Type::QUANTIZE, tolerance);
+  std::vector<double> values = smoothField(1000, 3);
+  values.push_back(-1e3);
+  values.push_back(1e3);
+  std::vector<double> decoded = roundTrip(compression, values, 3);
+  for (size_t i = 0; i < values.size(); i++) {
+    BOOST_TEST(std::abs(decoded[i] - values[i]) <= tolerance * (1.0 + 1e-6));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Empty)
+{
+  for (auto type : {Compression::Type::NONE, Compression::Type::LOSSLESS, Compression::Type::FLOAT}) {
+    Compression         compression(type);
+    std::vector<double> packed;
+    double              unused = 0.0;
+    compression.encode(&unused, 0, 1, packed);
+    BOOST_TEST(packed.size() == 1);
+    compression.decode(packed, &unused, 0, 1);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Delta)
+{
+  const double        tolerance = 1e-6;
+  const int           dim       = 2;
+  Compression         sender(Compression::Type::NONE, 0.0, true, tolerance);
+  Compression         receiver(Compression::Type::NONE, 0.0, true, tolerance);
+  std::vector<double> values = smoothField(100, dim);
+  std::vector<double> received(values.size());
+  std::vector<double> message;
+
+  // The first exchange contains all values
+  sender.pack(values.data(), values.size(), dim, 0, message);
+  receiver.unpack(message, received.data(), received.size(), dim, 0);
+  BOOST_TEST(received == values);
+  const size_t fullSize = message.size();
+
+  // Only the block of the changed vertex is sent
+  values[5 * dim + 1] += 1.0;
+  values[7 * dim] += 0.1 * tolerance;
+  sender.pack(values.data(), values.size(), dim, 0, message);
+  BOOST_TEST(message.size() < fullSize / 10);
+  std::fill(received.begin(), received.end(), -1.0);
+  receiver.unpack(message, received.data(), received.size(), dim, 0);
+  BOOST_TEST(received == values);
+
+  // Changes below the tolerance are not sent, also not when they accumulate
+  const double oldValue = values[50 * dim];
+  values[50 * dim] += 0.6 * tolerance;
+  sender.pack(values.data(), values.size(), dim, 0, message);
+  receiver.unpack(message, received.data(), received.size(), dim, 0);
+  BOOST_TEST(received[50 * dim] == oldValue);
+  values[50 * dim] += 0.6 * tolerance;
+  sender.pack(values.data(), values.size(), dim, 0, message);
+  receiver.unpack(message, received.data(), received.size(), dim, 0);
+  BOOST_TEST(received[50 * dim] == values[50 * dim]);
+
+  // Other remote ranks start with a full exchange
+  sender.pack(values.data(), values.size(), dim, 1, message);
+  BOOST_TEST(message.size() == fullSize);
+}
+
+BOOST_AUTO_TEST_CASE(DeltaWithQuantization)
+{
+  const double        tolerance = 1e-8;
+  Compression         sender(Compression::Type::QUANTIZE, tolerance, true, tolerance);
+  Compression         receiver(Compression::Type::QUANTIZE, tolerance, true, tolerance);
+  std::vector<double> values = smoothField(1000, 3);
+  std::vector<double> received(values.size());
+  std::vector<double> message;
+  for (int iteration = 0; iteration < 5; iteration++) {
+    for (size_t i = 0; i < values.size(); i += 1 + 100 * iteration) {
+      values[i] *= 1.0 + 1e-3;
+    }
+    sender.pack(values.data(), values.size(), 3, 0, message);
+    receiver.unpack(message, received.data(), received.size(), 3, 0);
+    for (size_t i = 0; i < values.size(); i++) {
+      BOOST_TEST(std::abs(received[i] - values[i]) <= 2.0 * tolerance * (1.0 + 1e-6));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // CompressionTests
+BOOST_AUTO_TEST_SUITE_END() // M2NTests
@@ -1,8 +1,10 @@
 #ifndef PRECICE_NO_MPI
 
+#include <boost/filesystem.hpp>
 #include <vector>
 #include "com/MPIDirectCommunication.hpp"
 #include "com/MPIPortsCommunicationFactory.hpp"
+#include "com/SocketCommunication.hpp"
 #include "com/SocketCommunicationFactory.hpp"
 #include "m2n/PointToPointCommunication.hpp"
 #include "mesh/Mesh.hpp"
@@ -294,6 +296,89 @@ BOOST_AUTO_TEST_CASE(SocketCommunication,
   }
 }
 
+namespace
+{
+/// Socket communication, which counts the connections established via address files.
+class CountingSocketCommunication : public com::SocketCommunication
+{
+public:
+  using com::SocketCommunication::SocketCommunication;
+
+  static int fileRendezvous;
+
+  std::string prepareConnectionAsServer() override
+  {
+    _isPrepared = true;
+    return com::SocketCommunication::prepareConnectionAsServer();
+  }
+
+  void acceptConnectionAsServer(std::string const &acceptorName,
+                                std::string const &requesterName,
+                                int                acceptorRank,
+                                int                requesterCommunicatorSize) override
+  {
+    if (not _isPrepared) {
+      fileRendezvous++;
+    }
+    com::SocketCommunication::acceptConnectionAsServer(acceptorName, requesterName, acceptorRank, requesterCommunicatorSize);
+  }
+
+  void requestConnectionAsClient(std::string const &  acceptorName,
+                                 std::string const &  requesterName,
+                                 std::set<int> const &acceptorRanks,
+                                 int                  requesterRank) override
+  {
+    fileRendezvous++;
+    com::SocketCommunication::requestConnectionAsClient(acceptorName, requesterName, acceptorRanks, requesterRank);
+  }
+
+private:
+  bool _isPrepared = false;
+};
+
+int CountingSocketCommunication::fileRendezvous = 0;
+
+class CountingSocketCommunicationFactory : public com::SocketCommunicationFactory
+{
+public:
+  using com::SocketCommunicationFactory::SocketCommunicationFactory;
+
+  com::PtrCommunication newCommunication() override
+  {
+    return std::make_shared<CountingSocketCommunication>(addressDirectory());
+  }
+};
+} // namespace
+
+/// Only the masters exchange their address via file in a local directory, all other ranks receive it over the masters.
+BOOST_AUTO_TEST_CASE(SocketRendezvousOverMasters,
+                     * testing::OnSize(4))
+{
+  namespace fs = boost::filesystem;
+  // A directory of its own, such that concurrent runs of the test do not interfere
+  std::string addressDirectory;
+  if (Parallel::getProcessRank() == 0) {
+    addressDirectory = (fs::temp_directory_path() / fs::unique_path("precice-m2n-rendezvous-%%%%-%%%%")).string();
+    fs::create_directories(addressDirectory);
+  }
+  int length = addressDirectory.size();
+  MPI_Bcast(&length, 1, MPI_INT, 0, Parallel::getGlobalCommunicator());
+  addressDirectory.resize(length);
+  MPI_Bcast(&addressDirectory[0], length, MPI_CHAR, 0, Parallel::getGlobalCommunicator());
+
+  com::PtrCommunicationFactory cf(new CountingSocketCommunicationFactory(addressDirectory));
+  CountingSocketCommunication::fileRendezvous = 0;
+  P2PComTest1(cf);
+  BOOST_TEST(CountingSocketCommunication::fileRendezvous == 0);
+
+  // All address files have been removed after the connections were set up
+  Parallel::synchronizeProcesses();
+  if (Parallel::getProcessRank() == 0) {
+    BOOST_TEST(fs::is_empty(addressDirectory));
+    fs::remove_all(addressDirectory);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(MPIPortsCommunication,
                      * testing::OnSize(4)
                      * boost::unit_test::label("MPI_Ports"))
@@ -214,7 +214,11 @@ MappingConfiguration:: MappingConfiguration
   ValidString validInitial(VALUE_TIMING_INITIAL);
   ValidString validOnAdvance(VALUE_TIMING_ON_ADVANCE);
   ValidString validOnDemand(VALUE_TIMING_ON_DEMAND);
-  attrTiming.setValidator(validInitial || validOnAdvance || validOnDemand);
+  ValidString validOnRead(VALUE_TIMING_ON_READ);
+  attrTiming.setValidator(validInitial || validOnAdvance || validOnDemand || validOnRead);
+  attrTiming.setDocumentation("When the mapping is executed. \"onread\" maps read data lazily, "
+                              "i.e., at the first read of the data after it has been exchanged. "
+                              "It is not available for write mappings and global RBF mappings (petrbf-*).");
 
   // Add tags that all mappings use and add to parent tag
   for (XMLTag & tag : tags) {
@@ -363,6 +367,14 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping
   else {
     ERROR("Unknown direction type \"" << direction << "\"!");
   }
+  CHECK(not (timing == ON_READ && configuredMapping.direction == WRITE),
+        "Mapping from mesh \"" << fromMeshName << "\" to mesh \"" << toMeshName
+        << "\" has timing \"" << VALUE_TIMING_ON_READ << "\", which is only available for read mappings!");
+  // Global RBF mappings are computed and evaluated collectively, but reads happen on single ranks
+  CHECK(not (timing == ON_READ && type.find("petrbf-") == 0),
+        "Mapping from mesh \"" << fromMeshName << "\" to mesh \"" << toMeshName
+        << "\" has timing \"" << VALUE_TIMING_ON_READ << "\", which is not available for global RBF mappings, "
+        << "as they need to be executed collectively by all ranks!");
 
   Mapping::Constraint constraintValue;
   if (constraint == VALUE_CONSERVATIVE){
@@ -527,6 +539,9 @@ MappingConfiguration::Timing MappingConfiguration:: getTiming(const std::string&
   else if (timing == VALUE_TIMING_ON_DEMAND){
     return ON_DEMAND;
   }
+  else if (timing == VALUE_TIMING_ON_READ){
+    return ON_READ;
+  }
   ERROR("Unknown timing value \"" << timing << "\"!");
 }
 
@@ -47,7 +47,9 @@ public:
   {
     INITIAL,
     ON_ADVANCE,
-    ON_DEMAND
+    ON_DEMAND,
+    /// Read mapping, which is executed at the first read of the data after it has been exchanged.
+    ON_READ
   };
 
   /// Configuration data for one mapping.
@@ -144,6 +146,7 @@ private:
   const std::string VALUE_TIMING_INITIAL = "initial";
   const std::string VALUE_TIMING_ON_ADVANCE = "onadvance";
   const std::string VALUE_TIMING_ON_DEMAND = "ondemand";
+  const std::string VALUE_TIMING_ON_READ = "onread";
 
   mesh::PtrMeshConfiguration _meshConfig;
 
@@ -25,8 +25,8 @@ BOOST_AUTO_TEST_CASE(Configuration)
   mapping::MappingConfiguration mappingConfig(tag, meshConfig);
   xml::configure(tag, file);
     
-  BOOST_TEST(meshConfig->meshes().size() == 3);
-  BOOST_TEST(mappingConfig.mappings().size() == 3);
+  BOOST_TEST(meshConfig->meshes().size() == 5);
+  BOOST_TEST(mappingConfig.mappings().size() == 4);
   BOOST_TEST(mappingConfig.mappings()[0].timing == MappingConfiguration::ON_DEMAND);
   BOOST_TEST(mappingConfig.mappings()[0].fromMesh == meshConfig->meshes()[0]);
   BOOST_TEST(mappingConfig.mappings()[0].toMesh == meshConfig->meshes()[2]);
@@ -41,6 +41,11 @@ BOOST_AUTO_TEST_CASE(Configuration)
   BOOST_TEST(mappingConfig.mappings()[2].fromMesh == meshConfig->meshes()[1]);
   BOOST_TEST(mappingConfig.mappings()[2].toMesh == meshConfig->meshes()[0]);
   BOOST_TEST(mappingConfig.mappings()[2].direction == MappingConfiguration::WRITE);
+
+  BOOST_TEST(mappingConfig.mappings()[3].timing == MappingConfiguration::ON_READ);
+  BOOST_TEST(mappingConfig.mappings()[3].fromMesh == meshConfig->meshes()[3]);
+  BOOST_TEST(mappingConfig.mappings()[3].toMesh == meshConfig->meshes()[4]);
+  BOOST_TEST(mappingConfig.mappings()[3].direction == MappingConfiguration::READ);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
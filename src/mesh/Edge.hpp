@@ -3,7 +3,6 @@
 #include <Eigen/Core>
 #include <iostream>
 
-#include "mesh/PropertyContainer.hpp"
 #include "mesh/Vertex.hpp"
 #include "boost/noncopyable.hpp"
 #include "math/differences.hpp"
@@ -16,7 +15,7 @@ struct EdgeIteratorTypes;
 template<typename Types> class EdgeIterator;
 
 /// Linear edge of a mesh, defined by two Vertex objects.
-class Edge : public PropertyContainer, private boost::noncopyable
+class Edge : private boost::noncopyable
 {
 public:
 
@@ -32,9 +31,6 @@ public:
     Vertex& vertexTwo,
     int     id );
 
-  /// Destructor, empty.
-  virtual ~Edge () {}
-
   /// Returns number of spatial dimensions (2 or 3) the edge is embedded to.
   int getDimensions() const;
 
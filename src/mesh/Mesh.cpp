@@ -114,13 +114,30 @@ int Mesh:: getDimensions() const
   return _dimensions;
 }
 
+int Mesh:: createVertices
+(
+  int           count,
+  const double* coords )
+{
+  TRACE(count);
+  assertion(count >= 0, count);
+  VertexContainer& vertices = _content.vertices();
+  vertices.reserve(vertices.size() + count);
+  const int firstID = _manageVertexIDs.getFreeIDs(count);
+  for (int i = 0; i < count; i++) {
+    Eigen::Map<const Eigen::VectorXd> position(coords + i * _dimensions, _dimensions);
+    Vertex* newVertex = new Vertex(position, firstID + i);
+    _content.add(newVertex);
+  }
+  return firstID;
+}
+
 Edge& Mesh:: createEdge
 (
   Vertex& vertexOne,
   Vertex& vertexTwo )
 {
   Edge* newEdge = new Edge(vertexOne, vertexTwo, _manageEdgeIDs.getFreeID());
-  newEdge->addParent(*this);
   _content.add(newEdge);
   return *newEdge;
 }
@@ -133,7 +150,6 @@ Triangle& Mesh:: createTriangle
 {
   Triangle* newTriangle = new Triangle (
       edgeOne, edgeTwo, edgeThree, _manageTriangleIDs.getFreeID());
-  newTriangle->addParent(*this);
   _content.add(newTriangle);
   return *newTriangle;
 }
@@ -147,7 +163,6 @@ Quad& Mesh:: createQuad
 {
   Quad* newQuad = new Quad (
       edgeOne, edgeTwo, edgeThree, edgeFour, _manageQuadIDs.getFreeID());
-  newQuad->addParent(*this);
   _content.add(newQuad);
   return *newQuad;
 }
@@ -434,6 +449,10 @@ void Mesh:: clear()
 
   _content.clear();
   _propertyContainers.clear();
+  _vertexProperties.clear();
+  _edgeProperties.clear();
+  _triangleProperties.clear();
+  _quadProperties.clear();
 
   _manageTriangleIDs.resetIDs();
   _manageEdgeIDs.resetIDs();
@@ -3,6 +3,7 @@
 #include "mesh/Group.hpp"
 #include "mesh/SharedPointer.hpp"
 #include "mesh/Data.hpp"
+#include "mesh/PropertyContainer.hpp"
 #include "mesh/Vertex.hpp"
 #include "utils/PointerVector.hpp"
 #include "utils/ManageUniqueIDs.hpp"
@@ -12,12 +13,6 @@
 #include <vector>
 #include <boost/signals2.hpp>
 
-namespace precice {
-  namespace mesh {
-    class PropertyContainer;
-  }
-}
-
 // ----------------------------------------------------------- CLASS DEFINITION
 
 namespace precice {
@@ -31,6 +26,9 @@ namespace mesh {
  * PropertyContainers. It provides functionality to conveniently create those
  * objects.
  *
+ * Mesh elements do not carry properties themselves. Properties of single elements
+ * are stored in sparse tables of the mesh, see elementProperties().
+ *
  * In addition to creating the topological information of a mesh, the Mesh class
  * can also be used to add data to the vertices of a mesh.
  *
@@ -119,11 +117,24 @@ public:
   {
     assertion(coords.size() == _dimensions, coords.size(), _dimensions);
     Vertex* newVertex = new Vertex(coords, _manageVertexIDs.getFreeID());
-    newVertex->addParent(*this);
     _content.add(newVertex);
     return *newVertex;
   }
 
+  /**
+   * @brief Creates count vertices at once.
+   *
+   * The vertices obtain a contiguous range of IDs and the storage is reserved in one go.
+   *
+   * @param[in] count Number of vertices to create.
+   * @param[in] coords Coordinates of the vertices, count * getDimensions() values, vertex after vertex.
+   *
+   * @return ID of the first created vertex, the IDs of the following vertices are consecutive.
+   */
+  int createVertices (
+    int           count,
+    const double* coords );
+
   /**
    * @brief Creates and initializes an Edge object.
    *
@@ -180,6 +191,27 @@ public:
 
   PropertyContainer& getPropertyContainer (const std::string & subIDName);
 
+  /**
+   * @brief Returns the properties of a mesh element.
+   *
+   * The properties are created on first access, with the mesh as first parent.
+   * Further parents, e.g. the containers returned by setSubID(), can be added to
+   * assign multiple geometry IDs to an element.
+   */
+  template<typename ELEMENT_T>
+  PropertyContainer& elementProperties ( const ELEMENT_T& element );
+
+  /**
+   * @brief Appends the geometry IDs of a mesh element to geometryIDs.
+   *
+   * These are the IDs of the element's parents, if set by elementProperties(),
+   * otherwise the ID of the mesh.
+   */
+  template<typename ELEMENT_T>
+  void getGeometryIDs (
+    const ELEMENT_T&  element,
+    std::vector<int>& geometryIDs );
+
   /// Returns the name of the mesh, as set in the config file.
   const std::string& getName() const;
 
@@ -282,6 +314,14 @@ public:
 
 private:
 
+  /// Sparse table of element properties, indexed by element ID.
+  using PropertyTable = std::map<int, PropertyContainer>;
+
+  PropertyTable& propertyTable ( const Vertex& ) { return _vertexProperties; }
+  PropertyTable& propertyTable ( const Edge& ) { return _edgeProperties; }
+  PropertyTable& propertyTable ( const Triangle& ) { return _triangleProperties; }
+  PropertyTable& propertyTable ( const Quad& ) { return _quadProperties; }
+
   mutable logging::Logger _log{"mesh::Mesh"};
 
   /// Provides unique IDs for all geometry objects
@@ -308,6 +348,18 @@ private:
   /// Data hold by the vertices of the mesh.
   DataContainer _data;
 
+  /// Properties of single vertices, only present if requested.
+  PropertyTable _vertexProperties;
+
+  /// Properties of single edges, only present if requested.
+  PropertyTable _edgeProperties;
+
+  /// Properties of single triangles, only present if requested.
+  PropertyTable _triangleProperties;
+
+  /// Properties of single quads, only present if requested.
+  PropertyTable _quadProperties;
+
   utils::ManageUniqueIDs _manageVertexIDs;
 
   utils::ManageUniqueIDs _manageEdgeIDs;
@@ -342,6 +394,40 @@ private:
 
 };
 
+// ------------------------------------------------------ HEADER IMPLEMENTATION
+
+template<typename ELEMENT_T>
+PropertyContainer& Mesh:: elementProperties
+(
+  const ELEMENT_T& element )
+{
+  PropertyTable& table = propertyTable(element);
+  auto iter = table.find(element.getID());
+  if (iter == table.end()) {
+    iter = table.emplace(std::piecewise_construct,
+                         std::forward_as_tuple(element.getID()),
+                         std::forward_as_tuple()).first;
+    iter->second.addParent(*this);
+  }
+  return iter->second;
+}
+
+template<typename ELEMENT_T>
+void Mesh:: getGeometryIDs
+(
+  const ELEMENT_T&  element,
+  std::vector<int>& geometryIDs )
+{
+  PropertyTable& table = propertyTable(element);
+  auto iter = table.find(element.getID());
+  if (iter == table.end()) {
+    getProperties(INDEX_GEOMETRY_ID, geometryIDs);
+  }
+  else {
+    iter->second.getProperties(INDEX_GEOMETRY_ID, geometryIDs);
+  }
+}
+
 std::ostream& operator<<(std::ostream& os, const Mesh& q);
 
 }} // namespace precice, mesh
@@ -4,7 +4,6 @@
 #include <algorithm>
 #include "boost/noncopyable.hpp"
 #include "mesh/Edge.hpp"
-#include "mesh/PropertyContainer.hpp"
 #include "mesh/RangeAccessor.hpp"
 
 namespace precice
@@ -13,7 +12,7 @@ namespace mesh
 {
 
 /// Quadrilateral (or Quadrangle) geometric primitive.
-class Quad : public PropertyContainer, private boost::noncopyable
+class Quad : private boost::noncopyable
 {
 public:
   /// Type of the read-only const random-access iterator over Vertex coords
@@ -38,9 +37,6 @@ public:
       Edge &edgeFour,
       int   id);
 
-  /// Destructor, empty.
-  virtual ~Quad() {}
-
   /// Returns dimensionalty of space the quad is embedded in.
   int getDimensions() const;
 
@@ -1,6 +1,7 @@
 #include "impl/RTree.hpp"
 
 #include "RTree.hpp"
+#include <boost/range/irange.hpp>
 
 namespace precice {
 namespace mesh {
@@ -8,24 +9,41 @@ namespace mesh {
 // Initialize static member
 std::map<int, rtree::PtrVertexRTree> precice::mesh::rtree::_vertex_trees;
 // Initialize static member
+std::map<int, unsigned long> precice::mesh::rtree::_vertex_tree_revisions;
+// Initialize static member
 std::map<int, PtrPrimitiveRTree> precice::mesh::rtree::_primitive_trees;
 
 rtree::PtrVertexRTree rtree::getVertexRTree(const PtrMesh& mesh)
 {
+  assertion(mesh, "Empty meshes are not allowed.");
+  auto iter = _vertex_trees.find(mesh->getID());
+  if (iter != _vertex_trees.end()) {
+    // The tree indexes a copy of the coordinates, which is outdated if vertices have been moved or added
+    if (_vertex_tree_revisions[mesh->getID()] == Vertex::getCoordsRevision() &&
+        iter->second->size() == mesh->vertices().size()) {
+      return iter->second;
+    }
+    _vertex_trees.erase(iter);
+  }
+
+  namespace bg = boost::geometry;
+  const auto& vertices = mesh->vertices();
+  auto points = std::make_shared<std::vector<Point3d>>();
+  points->reserve(vertices.size());
+  for (const auto& vertex : vertices) {
+    points->emplace_back(bg::get<0>(vertex), bg::get<1>(vertex), bg::get<2>(vertex));
+  }
+
+  // The range constructor packs the tree, which is much faster than inserting one index at a time
   RTreeParameters params;
-  VertexIndexGetter ind(mesh->vertices());
-    
-  auto result = _vertex_trees.emplace(std::piecewise_construct,
-                              std::forward_as_tuple(mesh->getID()),
-                              std::forward_as_tuple(std::make_shared<VertexRTree>(params, ind)));
-    
-  PtrVertexRTree tree = std::get<0>(result)->second;
-    
-  if (std::get<1>(result)) // insertion took place, fill tree
-    for (size_t i = 0; i < mesh->vertices().size(); ++i)
-      tree->insert(i);
-    
-  return tree;
+  VertexIndexGetter ind(points);
+  auto indices = boost::irange<size_t>(0, vertices.size());
+  auto treeptr = std::make_shared<VertexRTree>(indices.begin(), indices.end(), params, ind);
+  _vertex_trees.emplace(std::piecewise_construct,
+          std::forward_as_tuple(mesh->getID()),
+          std::forward_as_tuple(treeptr));
+  _vertex_tree_revisions[mesh->getID()] = Vertex::getCoordsRevision();
+  return treeptr;
 }
 
 PtrPrimitiveRTree rtree::getPrimitiveRTree(const PtrMesh& mesh)
@@ -45,6 +63,7 @@ PtrPrimitiveRTree rtree::getPrimitiveRTree(const PtrMesh& mesh)
 void rtree::clear(Mesh &mesh)
 {
   _vertex_trees.erase(mesh.getID());
+  _vertex_tree_revisions.erase(mesh.getID());
   _primitive_trees.erase(mesh.getID());
 }
 
@@ -70,13 +89,15 @@ PrimitiveRTree indexMesh(const Mesh &mesh)
 {
   using namespace impl;
 
-  AABBGenerator  gen{mesh};
-  PrimitiveRTree tree;
-  indexPrimitive(tree, gen, mesh.vertices());
-  indexPrimitive(tree, gen, mesh.edges());
-  indexPrimitive(tree, gen, mesh.triangles());
-  indexPrimitive(tree, gen, mesh.quads());
-  return tree;
+  AABBGenerator gen{mesh};
+  std::vector<PrimitiveRTree::value_type> values;
+  values.reserve(mesh.vertices().size() + mesh.edges().size() + mesh.triangles().size() + mesh.quads().size());
+  generatePrimitives(values, gen, mesh.vertices());
+  generatePrimitives(values, gen, mesh.edges());
+  generatePrimitives(values, gen, mesh.triangles());
+  generatePrimitives(values, gen, mesh.quads());
+  // The range constructor packs the tree, which is much faster than inserting one primitive at a time
+  return PrimitiveRTree(values.begin(), values.end());
 }
 
 std::ostream &operator<<(std::ostream &out, Primitive val)
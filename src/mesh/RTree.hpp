@@ -70,8 +70,11 @@ bool operator!=(const PrimitiveIndex& lhs, const PrimitiveIndex& rhs);
 /// A standard print operator for PrimitiveIndex
 std::ostream& operator<<(std::ostream& out, PrimitiveIndex val);
 
-/// The axis aligned bounding box based on the Vertex Type
-using AABB = boost::geometry::model::box<Eigen::VectorXd>;
+/// The fixed-size point type used to index all primitives. Points of 2D meshes have a zero third component.
+using Point3d = boost::geometry::model::point<double, 3, boost::geometry::cs::cartesian>;
+
+/// The axis aligned bounding box based on the fixed-size point type
+using AABB = boost::geometry::model::box<Point3d>;
 
 /// The rtree capable of indexing primitives of an entire Mesh
 using PrimitiveRTree = boost::geometry::index::rtree<std::pair<AABB, PrimitiveIndex>, boost::geometry::index::rstar<16>>;
@@ -81,7 +84,8 @@ using PtrPrimitiveRTree = std::shared_ptr<PrimitiveRTree>;
 
 /** Indexes a given mesh and returns a PrimitiveRTree holding the index
  *
- * This indexes the vertices, edges, triangles, and quads of a given Mesh and retrurns the index tree
+ * This indexes the vertices, edges, triangles, and quads of a given Mesh and retrurns the index tree.
+ * The tree is built at once using the packing algorithm of boost::geometry.
  *
  * \param mesh the mesh to index
  *
@@ -91,7 +95,7 @@ PrimitiveRTree indexMesh(const Mesh &mesh);
 
 class rtree {
 public:
-  using VertexIndexGetter = impl::PtrVectorIndexable<Mesh::VertexContainer>;
+  using VertexIndexGetter = impl::SharedPointsIndexable<Point3d>;
   using RTreeParameters   = boost::geometry::index::rstar<16>;
   using VertexRTree       = boost::geometry::index::rtree<Mesh::VertexContainer::container::size_type,
                                                           RTreeParameters,
@@ -101,6 +105,8 @@ public:
   /// Returns the pointer to boost::geometry::rtree for the given mesh vertices
   /*
    * Creates and fills the tree, if it wasn't requested before, otherwise it returns the cached tree.
+   * The tree indexes a copy of the vertex coordinates and is built using the packing algorithm.
+   * A cached tree is rebuilt if vertices have been moved or added since.
    */
   static PtrVertexRTree getVertexRTree(const PtrMesh& mesh);
   
@@ -118,10 +124,11 @@ public:
 private:
   static std::map<int, PtrPrimitiveRTree> _primitive_trees; ///< Cache for the primitive trees
   static std::map<int, PtrVertexRTree>    _vertex_trees; ///< Cache for the vertex trees
+  static std::map<int, unsigned long>     _vertex_tree_revisions; ///< Vertex::getCoordsRevision() when the cached vertex trees were built
 };
 
 
-using Box3d = boost::geometry::model::box<boost::geometry::model::point<double, 3, boost::geometry::cs::cartesian>>;
+using Box3d = boost::geometry::model::box<Point3d>;
 
 /// Returns a boost::geometry box that encloses a sphere of given radius around a middle point
 Box3d getEnclosingBox(Vertex const & middlePoint, double sphereRadius);
@@ -0,0 +1,63 @@
+#include "mesh/SpaceFillingCurve.hpp"
+#include "utils/assertion.hpp"
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace precice {
+namespace mesh {
+
+std::uint64_t mortonKey(const Eigen::VectorXd &coords, const Mesh::BoundingBox &boundingBox)
+{
+  const int dimensions = coords.size();
+  assertion(dimensions == 2 || dimensions == 3, dimensions);
+  assertion(static_cast<int>(boundingBox.size()) == dimensions, boundingBox.size(), dimensions);
+
+  const int           bits     = 64 / dimensions;
+  const std::uint64_t maxCoord = (std::uint64_t(1) << bits) - 1;
+  std::uint64_t       key      = 0;
+  for (int d = 0; d < dimensions; d++) {
+    const double extent = boundingBox[d].second - boundingBox[d].first;
+    std::uint64_t quantized = 0;
+    if (extent > 0.0) {
+      const double relative = std::min(std::max((coords[d] - boundingBox[d].first) / extent, 0.0), 1.0);
+      quantized = static_cast<std::uint64_t>(relative * maxCoord);
+    }
+    for (int bit = 0; bit < bits; bit++) {
+      key |= ((quantized >> bit) & std::uint64_t(1)) << (bit * dimensions + d);
+    }
+  }
+  return key;
+}
+
+std::vector<size_t> computeMortonOrdering(const Mesh &mesh)
+{
+  const int dimensions = mesh.getDimensions();
+  const auto &vertices = mesh.vertices();
+
+  Mesh::BoundingBox boundingBox(dimensions, std::make_pair(std::numeric_limits<double>::max(),
+                                                           std::numeric_limits<double>::lowest()));
+  for (const Vertex &vertex : vertices) {
+    for (int d = 0; d < dimensions; d++) {
+      boundingBox[d].first  = std::min(vertex.getCoords()[d], boundingBox[d].first);
+      boundingBox[d].second = std::max(vertex.getCoords()[d], boundingBox[d].second);
+    }
+  }
+
+  std::vector<std::pair<std::uint64_t, size_t>> keys;
+  keys.reserve(vertices.size());
+  for (size_t i = 0; i < vertices.size(); i++) {
+    keys.emplace_back(mortonKey(vertices[i].getCoords(), boundingBox), i);
+  }
+  std::sort(keys.begin(), keys.end());
+
+  std::vector<size_t> ordering;
+  ordering.reserve(keys.size());
+  for (const auto &key : keys) {
+    ordering.push_back(key.second);
+  }
+  return ordering;
+}
+
+} // namespace mesh
+} // namespace precice
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "mesh/Mesh.hpp"
+
+namespace precice {
+namespace mesh {
+
+/**
+ * @brief Computes the Morton (Z-order) key of a point in the given bounding box.
+ *
+ * Every coordinate is quantized to 64 / dimensions bits and the bits of all
+ * coordinates are interleaved. Vertices with close keys are close in space.
+ *
+ * @param[in] coords Coordinates of the point
+ * @param[in] boundingBox Bounding box containing the point, one (min, max) pair per dimension
+ */
+std::uint64_t mortonKey(const Eigen::VectorXd &coords, const Mesh::BoundingBox &boundingBox);
+
+/**
+ * @brief Returns the vertex indices of a mesh sorted along the Morton curve.
+ *
+ * The returned permutation maps a new position to the index in mesh.vertices().
+ * Traversing the vertices in this order touches neighbouring vertices one after another,
+ * which improves the memory locality of spatial queries and data accesses.
+ * The bounding box is computed from the vertices, computeState() is not required.
+ */
+std::vector<size_t> computeMortonOrdering(const Mesh &mesh);
+
+} // namespace mesh
+} // namespace precice
@@ -6,7 +6,6 @@
 #include <algorithm>
 
 #include "mesh/Edge.hpp"
-#include "mesh/PropertyContainer.hpp"
 #include "mesh/RangeAccessor.hpp"
 #include "utils/assertion.hpp"
 #include "math/differences.hpp"
@@ -27,7 +26,7 @@ namespace mesh
 {
 
 /// Triangle of a mesh, defined by three edges (and vertices).
-class Triangle : public PropertyContainer, private boost::noncopyable
+class Triangle : private boost::noncopyable
 {
 public:
   /// Type of the read-only const random-access iterator over Vertex coords
@@ -51,9 +50,6 @@ public:
       Edge &edgeThree,
       int   id);
 
-  /// Destructor, empty.
-  virtual ~Triangle() {}
-
   /// Returns dimensionalty of space the triangle is embedded in.
   int getDimensions() const;
 
@@ -5,6 +5,13 @@ namespace precice
 namespace mesh
 {
 
+unsigned long Vertex::_coordsRevision = 0;
+
+unsigned long Vertex::getCoordsRevision()
+{
+  return _coordsRevision;
+}
+
 int Vertex::getDimensions() const
 {
   return _coords.size();
@@ -5,7 +5,7 @@
 #include <iostream>
 
 #include "math/differences.hpp"
-#include "mesh/PropertyContainer.hpp"
+#include "utils/assertion.hpp"
 
 namespace precice
 {
@@ -13,7 +13,7 @@ namespace mesh
 {
 
 /// Vertex of a mesh.
-class Vertex : public PropertyContainer, private boost::noncopyable
+class Vertex : private boost::noncopyable
 {
 public:
   /// Constructor for vertex
@@ -22,9 +22,6 @@ public:
       const VECTOR_T &coordinates,
       int             id);
 
-  /// Destructor, empty.
-  virtual ~Vertex() {}
-
   /// Returns spatial dimensionality of vertex.
   int getDimensions() const;
 
@@ -66,6 +63,9 @@ public:
 
   void tag();
 
+  /// Returns a counter, which is increased whenever the coordinates of any vertex are set.
+  static unsigned long getCoordsRevision();
+
   inline bool operator==(const Vertex &rhs) const;
 
   inline bool operator!=(const Vertex &rhs) const;
@@ -88,6 +88,9 @@ private:
 
   /// true if this vertex is tagged for partition
   bool _tagged = false;
+
+  /// Number of calls of setCoords() on all vertices, used to detect moved vertices
+  static unsigned long _coordsRevision;
 };
 
 // ------------------------------------------------------ HEADER IMPLEMENTATION
@@ -96,8 +99,7 @@ template <typename VECTOR_T>
 Vertex::Vertex(
     const VECTOR_T &coordinates,
     int             id)
-    : PropertyContainer(),
-      _id(id),
+    : _id(id),
       _coords(coordinates),
       _normal(Eigen::VectorXd::Constant(_coords.size(), 0.0))
 {
@@ -109,6 +111,7 @@ void Vertex::setCoords(
 {
   assertion(coordinates.size() == _coords.size(), coordinates.size(), _coords.size());
   _coords = coordinates;
+  _coordsRevision++;
 }
 
 template <typename VECTOR_T>
@@ -117,6 +120,7 @@ void Vertex::setCoords(
 {
   assertion(coordinates.size() == _coords.size(), coordinates.size(), _coords.size());
   _coords = std::forward<VECTOR_T>(coordinates);
+  _coordsRevision++;
 }
 
 template <typename VECTOR_T>
@@ -65,4 +65,23 @@ void indexPrimitive(PrimitiveRTree &rtree, const Generator& gen, const Container
   }
 }
 
+/** generates the indexing values for a container of primitives.
+ *
+ * The algorithm generates a value for every primitive of the given container using the passed generator.
+ * It appends its result and the PrimitiveIndex to values as a std::pair, ready to be packed into an rtree.
+ *
+ * @param[IN, OUT] values the values to append to
+ * @param gen the Generator generating something to index rtree::value_type.
+ * @param conti the Container to index
+ */
+template <typename Container, typename Generator = AABBGenerator>
+void generatePrimitives(std::vector<PrimitiveRTree::value_type> &values, const Generator& gen, const Container &conti)
+{
+  using ValueType = typename std::remove_reference<typename std::remove_cv<typename Container::value_type>::type>::type;
+  for (size_t i = 0; i < conti.size(); ++i) {
+    PrimitiveIndex index{as_primitive_enum<ValueType>::value, i};
+    values.emplace_back(gen(index), index);
+  }
+}
+
 }}}
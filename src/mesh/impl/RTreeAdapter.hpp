@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+#include <vector>
 #include <boost/geometry.hpp>
 #include <Eigen/Core>
 #include "mesh/Vertex.hpp"
@@ -144,25 +146,28 @@ namespace precice {
 namespace mesh {
 namespace impl {
 
-/// Makes a utils::PtrVector indexable and thus be usable in boost::geometry::rtree
-template <typename Container>
-class PtrVectorIndexable
+/// Makes a shared, contiguous array of points indexable and thus be usable in boost::geometry::rtree
+/*
+ * The rtree stores only the indices, the indexable is looked up in the array of fixed-size points.
+ * The array is shared such that copies of the indexable, which are stored in the tree, stay cheap.
+ */
+template <typename Point>
+class SharedPointsIndexable
 {
-  using size_type = typename Container::container::size_type;
-  using cref = const typename Container::value_type&;
-  Container const& container;
+  using Points = std::vector<Point>;
+  using size_type = typename Points::size_type;
+  std::shared_ptr<const Points> points;
 
 public:
-  using result_type = cref;
+  using result_type = const Point&;
 
-  explicit PtrVectorIndexable(Container const& c) : container(c)
+  explicit SharedPointsIndexable(std::shared_ptr<const Points> p) : points(std::move(p))
   {}
 
   result_type operator()(size_type i) const
   {
-    return container[i];
+    return (*points)[i];
   }
 };
 
-
 }}}
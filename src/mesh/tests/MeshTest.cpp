@@ -28,11 +28,11 @@ BOOST_AUTO_TEST_CASE(SubIDs)
     Vertex& v1 = mesh.createVertex(Eigen::VectorXd::Constant(dim, 1.0));
     PropertyContainer& cont0 = mesh.setSubID("subID0");
     PropertyContainer& cont1 = mesh.setSubID("subID1");
-    v0.addParent(cont0);
-    v1.addParent(cont0);
-    v1.addParent(cont1);
+    mesh.elementProperties(v0).addParent(cont0);
+    mesh.elementProperties(v1).addParent(cont0);
+    mesh.elementProperties(v1).addParent(cont1);
     std::vector<int> properties;
-    v0.getProperties(PropertyContainer::INDEX_GEOMETRY_ID, properties);
+    mesh.getGeometryIDs(v0, properties);
     BOOST_TEST(properties.size() == 2);
     BOOST_TEST(properties[0] == mesh.getID("MyMesh"));
     BOOST_TEST(properties[1] == mesh.getID("MyMesh-subID0"));
@@ -378,41 +378,41 @@ BOOST_AUTO_TEST_CASE(Demonstration)
     cont.setProperty ( cont.INDEX_GEOMETRY_ID, subID );
 
     // Add sub-id to selected mesh elements
-    v0.addParent ( cont );
-    v1.addParent ( cont );
-    e0.addParent ( cont );
+    mesh.elementProperties(v0).addParent(cont);
+    mesh.elementProperties(v1).addParent(cont);
+    mesh.elementProperties(e0).addParent(cont);
 
     // Validate geometry IDs
     std::vector<int> geometryIDs;
-    v0.getProperties ( v0.INDEX_GEOMETRY_ID, geometryIDs );
+    mesh.getGeometryIDs(v0, geometryIDs);
     BOOST_TEST ( geometryIDs.size() == 2 );
     BOOST_TEST ( utils::contained(geometryID, geometryIDs) );
     BOOST_TEST ( utils::contained(subID, geometryIDs) );
     geometryIDs.clear();
-    v1.getProperties ( v1.INDEX_GEOMETRY_ID, geometryIDs );
+    mesh.getGeometryIDs(v1, geometryIDs);
     BOOST_TEST ( geometryIDs.size() == 2 );
     BOOST_TEST ( utils::contained(geometryID, geometryIDs) );
     BOOST_TEST ( utils::contained(subID, geometryIDs) );
     geometryIDs.clear();
-    v2.getProperties ( v1.INDEX_GEOMETRY_ID, geometryIDs );
+    mesh.getGeometryIDs(v2, geometryIDs);
     BOOST_TEST ( geometryIDs.size() == 1 );
     BOOST_TEST ( utils::contained(geometryID, geometryIDs) );
     geometryIDs.clear();
-    e0.getProperties ( e0.INDEX_GEOMETRY_ID, geometryIDs );
+    mesh.getGeometryIDs(e0, geometryIDs);
     BOOST_TEST ( geometryIDs.size() == 2 );
     BOOST_TEST ( utils::contained(geometryID, geometryIDs) );
     BOOST_TEST ( utils::contained(subID, geometryIDs) );
     geometryIDs.clear();
-    e1.getProperties ( e1.INDEX_GEOMETRY_ID, geometryIDs );
+    mesh.getGeometryIDs(e1, geometryIDs);
     BOOST_TEST ( geometryIDs.size() == 1 );
     BOOST_TEST ( utils::contained(geometryID, geometryIDs) );
     geometryIDs.clear();
-    e2.getProperties ( e2.INDEX_GEOMETRY_ID, geometryIDs );
+    mesh.getGeometryIDs(e2, geometryIDs);
     BOOST_TEST ( geometryIDs.size() == 1 );
     BOOST_TEST ( utils::contained(geometryID, geometryIDs) );
     if ( dim == 3 ){
       geometryIDs.clear();
-      t->getProperties ( t->INDEX_GEOMETRY_ID, geometryIDs );
+      mesh.getGeometryIDs(*t, geometryIDs);
       BOOST_TEST ( geometryIDs.size() == 1 );
       BOOST_TEST ( utils::contained(geometryID, geometryIDs) );
     }
@@ -438,6 +438,27 @@ BOOST_AUTO_TEST_CASE(Demonstration)
   }
 }
 
+BOOST_AUTO_TEST_CASE(CreateVertices)
+{
+  Mesh mesh("MyMesh", 2, false);
+  Vertex& v0 = mesh.createVertex(Vector2d(-1.0, -1.0));
+  std::vector<double> coords{0.0, 0.0, 1.0, 0.0, 1.0, 1.0};
+  int firstID = mesh.createVertices(3, coords.data());
+  BOOST_TEST(firstID == 1);
+  BOOST_TEST(mesh.vertices().size() == 4);
+  for (int i = 0; i < 3; i++) {
+    Vertex& v = mesh.vertices()[firstID + i];
+    BOOST_TEST(v.getID() == firstID + i);
+    BOOST_TEST(equals(v.getCoords(), Vector2d(coords[2*i], coords[2*i+1])));
+    std::vector<int> properties;
+    mesh.getGeometryIDs(v, properties);
+    BOOST_TEST(properties.size() == 1);
+  }
+  Vertex& v4 = mesh.createVertex(Vector2d(2.0, 2.0));
+  BOOST_TEST(v0.getID() == 0);
+  BOOST_TEST(v4.getID() == 4);
+}
+
 BOOST_AUTO_TEST_CASE(MeshEquality)
 {
     int dim = 3;
@@ -0,0 +1,62 @@
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include "mesh/Mesh.hpp"
+#include "mesh/SpaceFillingCurve.hpp"
+#include "mesh/Vertex.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::mesh;
+
+BOOST_AUTO_TEST_SUITE(MeshTests)
+BOOST_AUTO_TEST_SUITE(SpaceFillingCurve)
+
+BOOST_AUTO_TEST_CASE(MortonKey2D)
+{
+  Mesh::BoundingBox bb{{0.0, 1.0}, {0.0, 1.0}};
+  BOOST_TEST(mortonKey(Eigen::Vector2d(0.0, 0.0), bb) == 0u);
+  // The first dimension occupies the lowest bit of each bit group
+  BOOST_TEST(mortonKey(Eigen::Vector2d(1.0, 0.0), bb) < mortonKey(Eigen::Vector2d(0.0, 1.0), bb));
+  BOOST_TEST(mortonKey(Eigen::Vector2d(0.0, 1.0), bb) < mortonKey(Eigen::Vector2d(1.0, 1.0), bb));
+  // The lower left quadrant comes before all others
+  BOOST_TEST(mortonKey(Eigen::Vector2d(0.49, 0.49), bb) < mortonKey(Eigen::Vector2d(0.51, 0.0), bb));
+}
+
+BOOST_AUTO_TEST_CASE(MortonKeyDegenerated)
+{
+  // All vertices on a plane, the extent of the third dimension is zero
+  Mesh::BoundingBox bb{{0.0, 1.0}, {0.0, 1.0}, {2.0, 2.0}};
+  BOOST_TEST(mortonKey(Eigen::Vector3d(0.0, 0.0, 2.0), bb) == 0u);
+  BOOST_TEST(mortonKey(Eigen::Vector3d(1.0, 0.0, 2.0), bb) < mortonKey(Eigen::Vector3d(0.0, 1.0, 2.0), bb));
+}
+
+BOOST_AUTO_TEST_CASE(Ordering)
+{
+  Mesh mesh("MyMesh", 2, false);
+  mesh.createVertex(Eigen::Vector2d(1.0, 1.0));
+  mesh.createVertex(Eigen::Vector2d(0.0, 0.0));
+  mesh.createVertex(Eigen::Vector2d(0.0, 1.0));
+  mesh.createVertex(Eigen::Vector2d(1.0, 0.0));
+
+  std::vector<size_t> ordering = computeMortonOrdering(mesh);
+  std::vector<size_t> expected{1, 3, 2, 0};
+  BOOST_TEST(ordering == expected, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(OrderingIsPermutation)
+{
+  Mesh                                   mesh("MyMesh", 3, false);
+  std::mt19937                           gen(42);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  for (int i = 0; i < 1000; i++) {
+    mesh.createVertex(Eigen::Vector3d(dist(gen), dist(gen), dist(gen)));
+  }
+  std::vector<size_t> ordering = computeMortonOrdering(mesh);
+  std::vector<size_t> identity(mesh.vertices().size());
+  std::iota(identity.begin(), identity.end(), 0);
+  BOOST_TEST(std::is_permutation(ordering.begin(), ordering.end(), identity.begin()));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // SpaceFillingCurve
+BOOST_AUTO_TEST_SUITE_END() // Mesh
@@ -1,10 +1,12 @@
 #include "partition/ReceivedPartition.hpp"
+#include <numeric>
 #include "com/CommunicateMesh.hpp"
 #include "com/Communication.hpp"
 #include "m2n/M2N.hpp"
 #include "mapping/Mapping.hpp"
 #include "mesh/Edge.hpp"
 #include "mesh/Mesh.hpp"
+#include "mesh/SpaceFillingCurve.hpp"
 #include "mesh/Triangle.hpp"
 #include "mesh/Vertex.hpp"
 #include "utils/Event.hpp"
@@ -19,13 +21,14 @@ extern bool syncMode;
 namespace partition {
 
 ReceivedPartition::ReceivedPartition(
-    mesh::PtrMesh mesh, GeometricFilter geometricFilter, double safetyFactor)
+    mesh::PtrMesh mesh, GeometricFilter geometricFilter, double safetyFactor, bool reorderVertices)
     : Partition(mesh),
       _geometricFilter(geometricFilter),
       _bb(mesh->getDimensions(), std::make_pair(std::numeric_limits<double>::max(),
                                                 std::numeric_limits<double>::lowest())),
       _dimensions(mesh->getDimensions()),
-      _safetyFactor(safetyFactor)
+      _safetyFactor(safetyFactor),
+      _reorderVertices(reorderVertices)
 {
 }
 
@@ -199,7 +202,7 @@ void ReceivedPartition::compute()
   INFO("Filter mesh " << _mesh->getName() << " by mappings");
   Event e5("partition.filterMeshMappings" + _mesh->getName(), precice::syncMode);
   mesh::Mesh filteredMesh("FilteredMesh", _dimensions, _mesh->isFlipNormals());
-  filterMesh(filteredMesh, false);
+  filterMesh(filteredMesh, false, _reorderVertices);
   DEBUG("Mapping filter, filtered from " << _mesh->vertices().size() << " vertices to " << filteredMesh.vertices().size() << " vertices.");
   _mesh->clear();
   _mesh->addMesh(filteredMesh);
@@ -247,9 +250,9 @@ void ReceivedPartition::compute()
   computeVertexOffsets();
 }
 
-void ReceivedPartition::filterMesh(mesh::Mesh &filteredMesh, const bool filterByBB)
+void ReceivedPartition::filterMesh(mesh::Mesh &filteredMesh, const bool filterByBB, const bool reorder)
 {
-  TRACE(filterByBB);
+  TRACE(filterByBB, reorder);
 
   DEBUG("Bounding mesh. #vertices: " << _mesh->vertices().size()
         << ", #edges: " << _mesh->edges().size()
@@ -260,7 +263,16 @@ void ReceivedPartition::filterMesh(mesh::Mesh &filteredMesh, const bool filterBy
   std::map<int, mesh::Edge *>   edgeMap;
   int                           vertexCounter = 0;
 
-  for (const mesh::Vertex &vertex : _mesh->vertices()) {
+  std::vector<size_t> ordering;
+  if (reorder) {
+    ordering = mesh::computeMortonOrdering(*_mesh);
+  } else {
+    ordering.resize(_mesh->vertices().size());
+    std::iota(ordering.begin(), ordering.end(), 0);
+  }
+
+  for (size_t index : ordering) {
+    const mesh::Vertex &vertex = _mesh->vertices()[index];
 
     if ((filterByBB && isVertexInBB(vertex)) || (not filterByBB && vertex.isTagged())) {
       mesh::Vertex &v = filteredMesh.createVertex(vertex.getCoords());
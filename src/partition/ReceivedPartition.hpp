@@ -33,7 +33,14 @@ public:
   };
 
   /// Constructor
-  ReceivedPartition(mesh::PtrMesh mesh, GeometricFilter geometricFilter, double safetyFactor);
+  /*
+   * If reorderVertices is set, the vertices of the partitioned mesh are stored along a space-filling
+   * curve to improve memory locality of mapping and communication. This is only done for parallel
+   * participants, as only there the order of the received mesh is decoupled from the remote mesh by the
+   * vertex distribution.
+   */
+  ReceivedPartition(mesh::PtrMesh mesh, GeometricFilter geometricFilter, double safetyFactor,
+                    bool reorderVertices = false);
 
   virtual ~ReceivedPartition() {}
 
@@ -47,8 +54,9 @@ private:
    * Copies all vertices/edges/triangles that are either contained in the bounding box
    * or tagged to the filteredMesh. Edges and triangles are copied, when ALL vertices
    * are part of the filteredMesh i.e. their IDs are contained in vertexMap.
+   * If reorder is set, the vertices are copied in Morton order.
    */
-  void filterMesh(mesh::Mesh &filteredMesh, const bool filterByBB);
+  void filterMesh(mesh::Mesh &filteredMesh, const bool filterByBB, const bool reorder = false);
   
   /// Sets _bb to the union with the mesh from fromMapping resp. toMapping, also enlage by _safetyFactor
   void prepareBoundingBox();
@@ -69,6 +77,9 @@ private:
 
   double _safetyFactor;
 
+  /// Store the vertices of the partitioned mesh along a space-filling curve
+  bool _reorderVertices;
+
   logging::Logger _log{"partition::ReceivedPartition"};
 };
 
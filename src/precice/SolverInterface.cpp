@@ -323,6 +323,23 @@ void SolverInterface:: readScalarData
   return _impl->readScalarData ( dataID, valueIndex, value );
 }
 
+double* SolverInterface:: accessBlockData
+(
+  int dataID,
+  int firstValueIndex,
+  int size )
+{
+  return _impl->accessBlockData ( dataID, firstValueIndex, size );
+}
+
+void SolverInterface:: setDataBuffer
+(
+  int     dataID,
+  double* values )
+{
+  _impl->setDataBuffer ( dataID, values );
+}
+
 MeshHandle SolverInterface:: getMeshHandle
 (
   const std::string & meshName )
@@ -34,6 +34,9 @@ namespace PreciceTests {
     struct testExplicitWithDataExchange;
     struct testExplicitWithDataInitialization;
     struct testExplicitWithBlockDataExchange;
+    struct testExplicitWithDataBuffers;
+    struct testExplicitWithLazyReadMapping;
+    struct testExplicitWithLazyReadMappingAndWatchPoint;
     struct testExplicitWithSolverGeometry;
     struct testExplicitWithDisplacingGeometry;
     struct testExplicitWithDataScaling;
@@ -47,6 +50,9 @@ namespace PreciceTests {
   namespace Server {
     struct testCouplingModeWithOneServer;
     struct testCouplingModeParallelWithOneServer;
+    namespace Benchmark {
+      struct ClientCallOverhead;
+    }
   }
 }
 
@@ -578,6 +584,39 @@ public:
     int     valueIndex,
     double& value );
 
+  /**
+   * @brief Returns direct access to the values of data at vertices with contiguous indices.
+   *
+   * Instead of copying values with the block write and read methods, the solver can read and
+   * write the values of the vertices firstValueIndex, ..., firstValueIndex+size-1 in place, e.g.
+   * of vertices set with setMeshVertices(). The values are ordered as for writeBlockVectorData().
+   * The pointer is invalidated, when the vertices of the mesh change. Not available in client mode.
+   *
+   * @param[in] dataID ID of the data to be accessed.
+   * @param[in] firstValueIndex Index of the first vertex.
+   * @param[in] size Number of vertices, not size of the array.
+   */
+  double* accessBlockData (
+    int dataID,
+    int firstValueIndex,
+    int size );
+
+  /**
+   * @brief Registers a buffer of the solver, which holds the values of data at all vertices of the mesh.
+   *
+   * The buffer holds the values of all vertices ordered by vertex index, as for writeBlockVectorData()
+   * with valueIndices 0, ..., n-1. preCICE takes write data from the buffer when it maps written data,
+   * i.e. in advance() and initializeData(), and stores read data into it after mapping read data.
+   * This replaces one write or read call per data and iteration. The buffer has to stay valid until
+   * finalize() or until it is deregistered by passing nullptr. Not available in client mode.
+   *
+   * @param[in] dataID ID of the data.
+   * @param[in] values Buffer of the solver, or nullptr.
+   */
+  void setDataBuffer (
+    int     dataID,
+    double* values );
+
   ///@}
 
 private:
@@ -605,6 +644,9 @@ private:
   friend struct PreciceTests::Serial::testExplicitWithDataExchange;
   friend struct PreciceTests::Serial::testExplicitWithDataInitialization;
   friend struct PreciceTests::Serial::testExplicitWithBlockDataExchange;
+  friend struct PreciceTests::Serial::testExplicitWithDataBuffers;
+  friend struct PreciceTests::Serial::testExplicitWithLazyReadMapping;
+  friend struct PreciceTests::Serial::testExplicitWithLazyReadMappingAndWatchPoint;
   friend struct PreciceTests::Serial::testExplicitWithSolverGeometry;
   friend struct PreciceTests::Serial::testExplicitWithDisplacingGeometry;
   friend struct PreciceTests::Serial::testExplicitWithDataScaling;
@@ -616,6 +658,7 @@ private:
   friend struct PreciceTests::Serial::testMappingNearestProjection;
   friend struct PreciceTests::Server::testCouplingModeWithOneServer;
   friend struct PreciceTests::Server::testCouplingModeParallelWithOneServer;
+  friend struct PreciceTests::Server::Benchmark::ClientCallOverhead;
 
 };
 
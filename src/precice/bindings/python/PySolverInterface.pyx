@@ -1,13 +1,13 @@
 from cpython       cimport array
 from libcpp        cimport bool
-from libc.stdlib   cimport free
-from libc.stdlib   cimport malloc
 from libcpp.set    cimport set
 from libcpp.memory cimport shared_ptr
 from libcpp.string cimport string
 from libcpp.memory cimport unique_ptr
 from libcpp.vector cimport vector
 
+import numpy
+
 from cpython.version cimport PY_MAJOR_VERSION  # important for determining python version in order to properly normalize string input. See http://docs.cython.org/en/latest/src/tutorial/strings.html#general-notes-about-c-strings and https://github.com/precice/precice/issues/68 . 
 
 cdef bytes convert(s):
@@ -21,9 +21,54 @@ cdef bytes convert(s):
     else:
         raise TypeError("Could not convert.")
 
+cdef object doubles(values):
+   """
+   Returns the values as contiguous array of doubles, which is the given object, if it is one already.
+   """
+   return numpy.ascontiguousarray(values, dtype=numpy.double)
+
+cdef object ints(values):
+   """
+   Returns the values as contiguous array of ints, which is the given object, if it is one already.
+   """
+   return numpy.ascontiguousarray(values, dtype=numpy.intc)
+
+cdef double* doublePointer(double[::1] values):
+   if values.shape[0] == 0:
+      return NULL
+   return &values[0]
+
+cdef int* intPointer(int[::1] values):
+   if values.shape[0] == 0:
+      return NULL
+   return &values[0]
+
+cdef double* inputDoublePointer(const double[::1] values):
+   """
+   Returns a pointer to values, which are only read by preCICE. Accepts read-only arrays.
+   """
+   if values.shape[0] == 0:
+      return NULL
+   return <double*> &values[0]
+
+cdef int* inputIntPointer(const int[::1] values):
+   """
+   Returns a pointer to values, which are only read by preCICE. Accepts read-only arrays.
+   """
+   if values.shape[0] == 0:
+      return NULL
+   return <int*> &values[0]
+
+cdef copyBack(target, array):
+   """
+   Copies the values of an output argument back, if the array has been converted from it.
+   """
+   if array is not target:
+      target[:] = array
+
 include "PyConstants.pyx"
 
-cdef extern from "./src/precice/SolverInterface.hpp"  namespace "precice":
+cdef extern from "./src/precice/SolverInterface.hpp"  namespace "precice" nogil:
    cdef cppclass SolverInterface:
       SolverInterface (const string&, int, int) except +
 
@@ -180,57 +225,30 @@ cdef class PySolverInterface:
    def getDataID (self, dataName, meshID):
       return self.thisptr.getDataID (convert(dataName), meshID)
 
-   def setMeshVertices (self, meshID, size, positions, ids):
-      cdef int* ids_
-      cdef double* positions_
-      ids_ = <int*> malloc(len(ids) * sizeof(int))
-      positions_ = <double*> malloc(len(positions) * sizeof(double))
-
-      if ids_ is NULL or positions_ is NULL:
-         raise MemoryError()
-      
-      for i in xrange(len(ids)):
-         ids_[i] = ids[i]
-      for i in xrange(len(positions)):
-         positions_[i] = positions[i]
-
-      self.thisptr.setMeshVertices (meshID, size, positions_, ids_)
-
-      for i in xrange(len(ids)):
-         ids[i] = ids_[i]
-      for i in xrange(len(positions)):
-         positions[i] = positions_[i]
+   # The array arguments can be any sequences. Contiguous NumPy arrays of type numpy.double and
+   # numpy.intc, respectively, are passed to preCICE without copy. Other sequences, e.g. lists,
+   # are converted and, for output arguments, the results are copied back.
 
-      free(ids_)
-      free(positions_)
+   def setMeshVertices (self, int meshID, int size, positions, ids):
+      positions_ = doubles(positions)
+      ids_ = ints(ids)
+      cdef double* positionsPtr = inputDoublePointer(positions_)
+      cdef int* idsPtr = intPointer(ids_)
+      with nogil:
+         self.thisptr.setMeshVertices (meshID, size, positionsPtr, idsPtr)
+      copyBack(ids, ids_)
 
    def getMeshVertexSize (self, meshID):
       return self.thisptr.getMeshVertexSize(meshID)
 
-   def getMeshVertexIDsFromPositions (self, meshID, size, positions, ids):
-      cdef int* ids_
-      cdef double* positions_
-
-      ids_ = <int*> malloc(len(ids) * sizeof(int))
-      positions_ = <double*> malloc(len(positions) * sizeof(double))
-
-      if ids_ is NULL or positions_ is NULL:
-         raise MemoryError()
-      
-      for i in xrange(len(ids)):
-         ids_[i] = ids[i]
-      for i in xrange(len(positions)):
-         positions_[i] = positions[i]
-
-      self.thisptr.getMeshVertexIDsFromPositions (meshID, size, positions_, ids_)
-
-      for i in xrange(len(ids)):
-         ids[i] = ids_[i]
-      for i in xrange(len(positions)):
-         positions[i] = positions_[i]
-
-      free(ids_)
-      free(positions_)
+   def getMeshVertexIDsFromPositions (self, int meshID, int size, positions, ids):
+      positions_ = doubles(positions)
+      ids_ = ints(ids)
+      cdef double* positionsPtr = inputDoublePointer(positions_)
+      cdef int* idsPtr = intPointer(ids_)
+      with nogil:
+         self.thisptr.getMeshVertexIDsFromPositions (meshID, size, positionsPtr, idsPtr)
+      copyBack(ids, ids_)
 
    def setMeshEdge (self, meshID, firstVertexID, secondVertexID):
       return self.thisptr.setMeshEdge (meshID, firstVertexID, secondVertexID)
@@ -253,138 +271,55 @@ cdef class PySolverInterface:
    def mapWriteDataFrom (self, fromMeshID):
       self.thisptr.mapWriteDataFrom (fromMeshID)
 
-   def writeBlockVectorData (self, dataID, size, valueIndices, values):
-      cdef int* valueIndices_
-      cdef double* values_
-      valueIndices_ = <int*> malloc(len(valueIndices) * sizeof(int))
-      values_ = <double*> malloc(len(values) * sizeof(double))
-
-      if valueIndices_ is NULL or values_ is NULL:
-         raise MemoryError()
-      
-      for i in xrange(len(valueIndices)):
-         valueIndices_[i] = valueIndices[i]
-      for i in xrange(len(values)):
-         values_[i] = values[i]
-
-      self.thisptr.writeBlockVectorData (dataID, size, valueIndices_, values_)
-
-      for i in xrange(len(valueIndices)):
-         valueIndices[i] = valueIndices_[i]
-      for i in xrange(len(values)):
-         values[i] = values_[i]
-
-      free(valueIndices_)
-      free(values_)
-
-   def writeVectorData (self, dataID, valueIndex, value):
-      cdef double* value_
-      value_ = <double*> malloc(len(value) * sizeof(double))
-
-      if value_ is NULL:
-         raise MemoryError()
-
-      for i in xrange(len(value)):
-         value_[i] = value[i]
-
-      self.thisptr.writeVectorData (dataID, valueIndex, value_)
-
-      for i in xrange(len(value)):
-         value[i] = value_[i]
-
-      free(value_)
-
-   def writeBlockScalarData (self, dataID, size, valueIndices, values):
-      cdef int* valueIndices_
-      cdef double* values_
-      valueIndices_ = <int*> malloc(len(valueIndices) * sizeof(int))
-      values_ = <double*> malloc(len(values) * sizeof(double))
-
-      if valueIndices_ is NULL or values_ is NULL:
-         raise MemoryError()
-      
-      for i in xrange(len(valueIndices)):
-         valueIndices_[i] = valueIndices[i]
-      for i in xrange(len(values)):
-         values_[i] = values[i]
-
-      self.thisptr.writeBlockScalarData (dataID, size, valueIndices_, values_)
-
-      for i in xrange(len(valueIndices)):
-         valueIndices[i] = valueIndices_[i]
-      for i in xrange(len(values)):
-         values[i] = values_[i]
-
-      free(valueIndices_)
-      free(values_)
+   def writeBlockVectorData (self, int dataID, int size, valueIndices, values):
+      valueIndices_ = ints(valueIndices)
+      values_ = doubles(values)
+      cdef int* valueIndicesPtr = inputIntPointer(valueIndices_)
+      cdef double* valuesPtr = inputDoublePointer(values_)
+      with nogil:
+         self.thisptr.writeBlockVectorData (dataID, size, valueIndicesPtr, valuesPtr)
+
+   def writeVectorData (self, int dataID, int valueIndex, value):
+      value_ = doubles(value)
+      cdef double* valuePtr = inputDoublePointer(value_)
+      with nogil:
+         self.thisptr.writeVectorData (dataID, valueIndex, valuePtr)
+
+   def writeBlockScalarData (self, int dataID, int size, valueIndices, values):
+      valueIndices_ = ints(valueIndices)
+      values_ = doubles(values)
+      cdef int* valueIndicesPtr = inputIntPointer(valueIndices_)
+      cdef double* valuesPtr = inputDoublePointer(values_)
+      with nogil:
+         self.thisptr.writeBlockScalarData (dataID, size, valueIndicesPtr, valuesPtr)
 
    def writeScalarData (self, dataID, valueIndex, value):
       self.thisptr.writeScalarData (dataID, valueIndex, value)
 
-   def readBlockVectorData (self, dataID, size, valueIndices, values):
-      cdef int* valueIndices_
-      cdef double* values_
-      valueIndices_ = <int*> malloc(len(valueIndices) * sizeof(int))
-      values_ = <double*> malloc(len(values) * sizeof(double))
-
-      if valueIndices_ is NULL or values_ is NULL:
-         raise MemoryError()
-      
-      for i in xrange(len(valueIndices)):
-         valueIndices_[i] = valueIndices[i]
-      for i in xrange(len(values)):
-         values_[i] = values[i]
-
-      self.thisptr.readBlockVectorData (dataID, size, valueIndices_, values_)
-
-      for i in xrange(len(valueIndices)):
-         valueIndices[i] = valueIndices_[i]
-      for i in xrange(len(values)):
-         values[i] = values_[i]
-
-      free(valueIndices_)
-      free(values_)
-
-   def readVectorData (self, dataID, valueIndex, value):
-      cdef double* value_
-      value_ = <double*> malloc(len(value) * sizeof(double))
-
-      if value_ is NULL:
-         raise MemoryError()
-
-      for i in xrange(len(value)):
-         value_[i] = value[i]
-
-      self.thisptr.readVectorData (dataID, valueIndex, value_)
-
-      for i in xrange(len(value)):
-         value[i] = value_[i]
-
-      free(value_)
-
-   def readBlockScalarData (self, dataID, size, valueIndices, values):
-      cdef int* valueIndices_
-      cdef double* values_
-      valueIndices_ = <int*> malloc(len(valueIndices) * sizeof(int))
-      values_ = <double*> malloc(len(values) * sizeof(double))
-
-      if valueIndices_ is NULL or values_ is NULL:
-         raise MemoryError()
-      
-      for i in xrange(len(valueIndices)):
-         valueIndices_[i] = valueIndices[i]
-      for i in xrange(len(values)):
-         values_[i] = values[i]
-
-      self.thisptr.readBlockScalarData (dataID, size, valueIndices_, values_)
-
-      for i in xrange(len(valueIndices)):
-         valueIndices[i] = valueIndices_[i]
-      for i in xrange(len(values)):
-         values[i] = values_[i]
-
-      free(valueIndices_)
-      free(values_)
+   def readBlockVectorData (self, int dataID, int size, valueIndices, values):
+      valueIndices_ = ints(valueIndices)
+      values_ = doubles(values)
+      cdef int* valueIndicesPtr = inputIntPointer(valueIndices_)
+      cdef double* valuesPtr = doublePointer(values_)
+      with nogil:
+         self.thisptr.readBlockVectorData (dataID, size, valueIndicesPtr, valuesPtr)
+      copyBack(values, values_)
+
+   def readVectorData (self, int dataID, int valueIndex, value):
+      value_ = doubles(value)
+      cdef double* valuePtr = doublePointer(value_)
+      with nogil:
+         self.thisptr.readVectorData (dataID, valueIndex, valuePtr)
+      copyBack(value, value_)
+
+   def readBlockScalarData (self, int dataID, int size, valueIndices, values):
+      valueIndices_ = ints(valueIndices)
+      values_ = doubles(values)
+      cdef int* valueIndicesPtr = inputIntPointer(valueIndices_)
+      cdef double* valuesPtr = doublePointer(values_)
+      with nogil:
+         self.thisptr.readBlockScalarData (dataID, size, valueIndicesPtr, valuesPtr)
+      copyBack(values, values_)
 
    def readScalarData (self, int dataID, int valueIndex, double& value):
       self.thisptr.readScalarData (dataID, valueIndex, value)
@@ -92,6 +92,13 @@ ParticipantConfiguration:: ParticipantConfiguration
   doc += "linearly to that point.";
   attrCoordinate.setDocumentation(doc);
   tagWatchPoint.addAttribute(attrCoordinate);
+  XMLAttribute<int> attrFlushInterval(ATTR_FLUSH_INTERVAL);
+  doc = "Number of lines written to the output file of the watch point, one per export of the watch point, ";
+  doc += "after which the file is flushed. ";
+  doc += "Larger intervals reduce the number of small writes to the file system.";
+  attrFlushInterval.setDocumentation(doc);
+  attrFlushInterval.setDefaultValue(1);
+  tagWatchPoint.addAttribute(attrFlushInterval);
   tag.addSubtag(tagWatchPoint);
 
   XMLTag tagUseMesh(*this, TAG_USE_MESH, XMLTag::OCCUR_ARBITRARY);
@@ -141,6 +148,15 @@ ParticipantConfiguration:: ParticipantConfiguration
   attrGeoFilter.setDefaultValue(VALUE_BROADCAST_FILTER);
   tagUseMesh.addAttribute(attrGeoFilter);
 
+  XMLAttribute<bool> attrReorderVertices(ATTR_REORDER_VERTICES);
+  doc = "If a mesh is received from another partipant (see tag <from>) by a parallel participant, ";
+  doc += "the vertices of the local partition can be stored along a space-filling (Morton) curve. ";
+  doc += "This improves the memory locality of mappings and data exchange for unstructured meshes. ";
+  doc += "Vertex IDs of provided meshes are not affected.";
+  attrReorderVertices.setDocumentation(doc);
+  attrReorderVertices.setDefaultValue(false);
+  tagUseMesh.addAttribute(attrReorderVertices);
+
   XMLAttribute<bool> attrProvide(ATTR_PROVIDE);
   doc += "If this attribute is set to \"on\", the ";
   doc += "participant has to create the mesh geometry before initializing preCICE.";
@@ -327,6 +343,7 @@ void ParticipantConfiguration:: xmlTagCallback
       throw stream.str();
     }
     bool provide = tag.getBooleanAttributeValue(ATTR_PROVIDE);
+    bool reorderVertices = tag.getBooleanAttributeValue(ATTR_REORDER_VERTICES);
     mesh::PtrMesh mesh = _meshConfig->getMesh(name);
     if (mesh.get() == nullptr){
       std::ostringstream stream;
@@ -341,7 +358,14 @@ void ParticipantConfiguration:: xmlTagCallback
              << " a safety factor defined. This is not valid.";
       throw stream.str();
     }
-    _participants.back()->useMesh ( mesh, offset, false, from, safetyFactor, provide, geoFilter );
+    if (reorderVertices && from==""){
+      std::ostringstream stream;
+      stream << "Participant \"" << _participants.back()->getName()
+             << "\" uses mesh \"" << name << "\" which is not received (no \"from\"), but wants to reorder its vertices."
+             << " Only received meshes can be reordered.";
+      throw stream.str();
+    }
+    _participants.back()->useMesh ( mesh, offset, false, from, safetyFactor, provide, geoFilter, reorderVertices );
   }
   else if ( tag.getName() == TAG_WRITE ) {
     std::string dataName = tag.getStringAttributeValue(ATTR_NAME);
@@ -369,6 +393,8 @@ void ParticipantConfiguration:: xmlTagCallback
     config.name = tag.getStringAttributeValue(ATTR_NAME);
     config.nameMesh = tag.getStringAttributeValue(ATTR_MESH);
     config.coordinates = tag.getEigenVectorXdAttributeValue(ATTR_COORDINATE, _dimensions);
+    config.flushInterval = tag.getIntAttributeValue(ATTR_FLUSH_INTERVAL);
+    CHECK(config.flushInterval > 0, "Flush interval of watch point \"" << config.name << "\" has to be positive!");
     _watchPointConfigs.push_back(config);
   }
   else if (tag.getNamespace() == TAG_SERVER){
@@ -614,7 +640,7 @@ void ParticipantConfiguration:: finishParticipantConfiguration
           << "\" for mesh \"" << config.nameMesh
           << "\" which is not used by him!" );
     std::string filename = "precice-" + participant->getName() + "-watchpoint-" + config.name + ".log";
-    impl::PtrWatchPoint watchPoint( new impl::WatchPoint(config.coordinates, mesh, filename) );
+    impl::PtrWatchPoint watchPoint( new impl::WatchPoint(config.coordinates, mesh, filename, config.flushInterval) );
     participant->addWatchPoint ( watchPoint );
   }
   _watchPointConfigs.clear ();
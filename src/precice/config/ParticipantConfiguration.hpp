@@ -55,6 +55,7 @@ private:
     std::string name;
     std::string nameMesh;
     Eigen::VectorXd coordinates;
+    int flushInterval;
   };
 
   mutable logging::Logger _log{"config::ParticipantConfiguration"};
@@ -77,9 +78,11 @@ private:
   const std::string ATTR_FROM = "from";
   const std::string ATTR_SAFETY_FACTOR = "safety-factor";
   const std::string ATTR_GEOMETRIC_FILTER = "geometric-filter";
+  const std::string ATTR_REORDER_VERTICES = "reorder-vertices";
   const std::string ATTR_PROVIDE = "provide";
   const std::string ATTR_MESH = "mesh";
   const std::string ATTR_COORDINATE = "coordinate";
+  const std::string ATTR_FLUSH_INTERVAL = "flush-interval";
   const std::string ATTR_COMMUNICATION = "communication";
   const std::string ATTR_CONTEXT = "context";
   const std::string ATTR_NETWORK = "network";
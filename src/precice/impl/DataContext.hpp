@@ -21,6 +21,12 @@ struct DataContext
   mesh::PtrMesh mesh;
 
   MappingContext mappingContext;
+
+  /// True, if the read data has been exchanged, but not yet been mapped by a mapping with timing "onread".
+  bool hasPendingMapping = false;
+
+  /// Buffer of the solver for the values of the data, registered by SolverInterface::setDataBuffer().
+  double* solverBuffer = nullptr;
 };
 
 }} // namespace precice, impl
@@ -46,6 +46,9 @@ struct MeshContext
    /// type of geometric filter
    partition::ReceivedPartition::GeometricFilter geoFilter = partition::ReceivedPartition::GeometricFilter::UNDEFINED;
 
+   /// True, if the vertices of a received mesh are stored along a space-filling curve.
+   bool reorderVertices = false;
+
    /// Offset only applied to meshes local to the accessor.
    Eigen::VectorXd localOffset;
 
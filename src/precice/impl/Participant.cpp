@@ -74,7 +74,8 @@ void Participant:: useMesh
   const std::string&                            fromParticipant,
   double                                        safetyFactor,
   bool                                          provideMesh,
-  partition::ReceivedPartition::GeometricFilter geoFilter)
+  partition::ReceivedPartition::GeometricFilter geoFilter,
+  bool                                          reorderVertices)
 {
   TRACE(_name,  mesh->getName(), mesh->getID() );
   checkDuplicatedUse(mesh);
@@ -88,6 +89,7 @@ void Participant:: useMesh
   context->safetyFactor = safetyFactor;
   context->provideMesh = provideMesh;
   context->geoFilter = geoFilter;
+  context->reorderVertices = reorderVertices;
 
   _meshContexts[mesh->getID()] = context;
 
@@ -114,7 +114,8 @@ public:
     const std::string&                            fromParticipant,
     double                                        safetyFactor,
     bool                                          provideMesh,
-    partition::ReceivedPartition::GeometricFilter geoFilter);
+    partition::ReceivedPartition::GeometricFilter geoFilter,
+    bool                                          reorderVertices);
 
   void addAction ( const action::PtrAction& action );
 
@@ -35,22 +35,16 @@ void RequestManager:: handleRequests()
      requests[clientRank] = _com->aReceive(requestIDs[clientRank], clientRank);
   }
 
-  int rankSender = 0;
   int requestID = -1;
   bool collectiveRequest = false;
   bool singleRequest = false;
   while(true){
-    if((std::find(clientRanks.begin(), clientRanks.end(), rankSender) == clientRanks.end()) &&
-       requests[rankSender]->test()){
-      requestID = requestIDs[rankSender];
-      CHECK(requestID != -1, "Receiving of request ID failed");
-      DEBUG("Received request ID " << requestID << " from rank " << rankSender);
-    }
-    else{
-      rankSender++;
-      if(rankSender==clientCommSize) rankSender = 0;
-      continue;
-    }
+    // Sleep until any client rank, which does not wait for a collective request, sends a request
+    int rankSender = static_cast<int>(com::Request::waitAny(requests));
+    requests[rankSender].reset();
+    requestID = requestIDs[rankSender];
+    CHECK(requestID != -1, "Receiving of request ID failed");
+    DEBUG("Received request ID " << requestID << " from rank " << rankSender);
 
     switch (requestID){
     case REQUEST_INITIALIZE:
@@ -107,9 +101,6 @@ void RequestManager:: handleRequests()
       handleRequestGetMeshVertexSize(rankSender);
       singleRequest = true;
       break;
-    case REQUEST_RESET_MESH:
-      handleRequestResetMesh(rankSender);
-      break;
     case REQUEST_SET_MESH_VERTICES:
       handleRequestSetMeshVertices(rankSender);
       singleRequest = true;
@@ -126,36 +117,8 @@ void RequestManager:: handleRequests()
       handleRequestSetMeshEdge(rankSender);
       singleRequest = true;
       break;
-    case REQUEST_SET_MESH_TRIANGLE:
-      handleRequestSetMeshTriangle(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_SET_MESH_TRIANGLE_WITH_EDGES:
-      handleRequestSetMeshTriangleWithEdges(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_SET_MESH_QUAD:
-      handleRequestSetMeshQuad(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_SET_MESH_QUAD_WITH_EDGES:
-      handleRequestSetMeshQuadWithEdges(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_WRITE_BLOCK_SCALAR_DATA:
-      handleRequestWriteBlockScalarData(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_WRITE_SCALAR_DATA:
-      handleRequestWriteScalarData(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_WRITE_BLOCK_VECTOR_DATA:
-      handleRequestWriteBlockVectorData(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_WRITE_VECTOR_DATA:
-      handleRequestWriteVectorData(rankSender);
+    case REQUEST_BATCH:
+      handleRequestBatch(rankSender);
       singleRequest = true;
       break;
     case REQUEST_READ_BLOCK_SCALAR_DATA:
@@ -221,14 +184,32 @@ void RequestManager:: handleRequests()
     }
 
     requestID = -1;
+  }
+}
+void RequestManager:: flushBatch()
+{
+  if (_batchedInts.empty()) {
+    return;
+  }
+  TRACE(_batchedInts.size(), _batchedDoubles.size());
+  _com->send(REQUEST_BATCH, 0);
+  _com->send(_batchedInts, 0);
+  _com->send(_batchedDoubles, 0);
+  _batchedInts.clear();
+  _batchedDoubles.clear();
+}
 
-    rankSender++;
-    if(rankSender==clientCommSize) rankSender = 0;
+void RequestManager:: limitBatch()
+{
+  if (_batchedInts.size() + _batchedDoubles.size() > MAX_BATCH_SIZE) {
+    flushBatch();
   }
 }
+
 void RequestManager:: requestPing()
 {
   TRACE();
+  flushBatch();
   _com->send(REQUEST_PING, 0);
   int dummy = 0;
   _com->receive(dummy, 0);
@@ -237,6 +218,7 @@ void RequestManager:: requestPing()
 void RequestManager:: requestInitialize()
 {
   TRACE();
+  flushBatch();
   _com->send(REQUEST_INITIALIZE, 0);
   _couplingScheme->receiveState(_com, 0);
 }
@@ -244,6 +226,7 @@ void RequestManager:: requestInitialize()
 void RequestManager:: requestInitialzeData()
 {
   TRACE();
+  flushBatch();
   _com->send(REQUEST_INITIALIZE_DATA, 0);
   _couplingScheme->receiveState(_com, 0);
 }
@@ -253,6 +236,7 @@ void RequestManager:: requestAdvance
   double dt )
 {
   TRACE();
+  flushBatch();
   _com->send(REQUEST_ADVANCE, 0);
   _com->send(dt, 0);
   _couplingScheme->receiveState(_com, 0);
@@ -261,6 +245,7 @@ void RequestManager:: requestAdvance
 void RequestManager:: requestFinalize()
 {
   TRACE();
+  flushBatch();
   _com->send(REQUEST_FINALIZE, 0);
 }
 
@@ -270,6 +255,7 @@ void RequestManager:: requestFulfilledAction
   const std::string& action )
 {
   TRACE();
+  flushBatch();
   _com->send(REQUEST_FULFILLED_ACTION, 0);
   _com->send(action, 0);
 }
@@ -280,6 +266,7 @@ int RequestManager:: requestSetMeshVertex
   Eigen::VectorXd& position )
 {
   TRACE();
+  flushBatch();
   _com->send(REQUEST_SET_MESH_VERTEX, 0);
   _com->send(meshID, 0);
   _com->send(position.data(), position.size(), 0);
@@ -293,6 +280,7 @@ int RequestManager:: requestGetMeshVertexSize
   int meshID )
 {
   TRACE(meshID);
+  flushBatch();
   _com->send(REQUEST_GET_MESH_VERTEX_SIZE, 0);
   _com->send(meshID, 0);
   int size = -1;
@@ -305,8 +293,8 @@ void RequestManager:: requestResetMesh
   int meshID )
 {
   TRACE(meshID);
-  _com->send(REQUEST_RESET_MESH, 0);
-  _com->send(meshID, 0);
+  _batchedInts.insert(_batchedInts.end(), {REQUEST_RESET_MESH, meshID});
+  limitBatch();
 }
 
 void RequestManager:: requestSetMeshVertices
@@ -317,6 +305,7 @@ void RequestManager:: requestSetMeshVertices
   int*    ids )
 {
   TRACE();
+  flushBatch();
   _com->send(REQUEST_SET_MESH_VERTICES, 0);
   _com->send(meshID, 0);
   _com->send(size, 0);
@@ -332,6 +321,7 @@ void RequestManager:: requestGetMeshVertices
   double* positions )
 {
   TRACE();
+  flushBatch();
   _com->send(REQUEST_GET_MESH_VERTICES, 0);
   _com->send(meshID, 0);
   _com->send(size, 0);
@@ -347,6 +337,7 @@ void RequestManager:: requestGetMeshVertexIDsFromPositions
   int*    ids )
 {
   TRACE(size);
+  flushBatch();
   _com->send(REQUEST_GET_MESH_VERTEX_IDS_FROM_POSITIONS, 0);
   _com->send(meshID, 0);
   _com->send(size, 0);
@@ -362,6 +353,7 @@ int RequestManager:: requestSetMeshEdge
   int secondVertexID )
 {
   TRACE(meshID, firstVertexID, secondVertexID);
+  flushBatch();
   _com->send(REQUEST_SET_MESH_EDGE, 0);
   int data[3] = { meshID, firstVertexID, secondVertexID };
   _com->send(data, 3, 0);
@@ -378,9 +370,8 @@ void RequestManager:: requestSetMeshTriangle
   int thirdEdgeID )
 {
   TRACE(meshID, firstEdgeID, secondEdgeID, thirdEdgeID);
-  _com->send(REQUEST_SET_MESH_TRIANGLE, 0);
-  int data[4] = {meshID, firstEdgeID, secondEdgeID, thirdEdgeID};
-  _com->send(data, 4, 0);
+  _batchedInts.insert(_batchedInts.end(), {REQUEST_SET_MESH_TRIANGLE, meshID, firstEdgeID, secondEdgeID, thirdEdgeID});
+  limitBatch();
 }
 
 void RequestManager:: requestSetMeshTriangleWithEdges
@@ -392,9 +383,8 @@ void RequestManager:: requestSetMeshTriangleWithEdges
 {
   TRACE(meshID, firstVertexID,
                 secondVertexID, thirdVertexID);
-  _com->send(REQUEST_SET_MESH_TRIANGLE_WITH_EDGES, 0);
-  int data[4] = {meshID, firstVertexID, secondVertexID, thirdVertexID};
-  _com->send(data, 4, 0);
+  _batchedInts.insert(_batchedInts.end(), {REQUEST_SET_MESH_TRIANGLE_WITH_EDGES, meshID, firstVertexID, secondVertexID, thirdVertexID});
+  limitBatch();
 }
 
 void RequestManager:: requestSetMeshQuad
@@ -406,9 +396,8 @@ void RequestManager:: requestSetMeshQuad
   int fourthEdgeID )
 {
   TRACE(meshID, firstEdgeID, secondEdgeID, thirdEdgeID, fourthEdgeID);
-  _com->send(REQUEST_SET_MESH_QUAD, 0);
-  int data[5] = {meshID, firstEdgeID, secondEdgeID, thirdEdgeID, fourthEdgeID};
-  _com->send(data, 5, 0);
+  _batchedInts.insert(_batchedInts.end(), {REQUEST_SET_MESH_QUAD, meshID, firstEdgeID, secondEdgeID, thirdEdgeID, fourthEdgeID});
+  limitBatch();
 }
 
 void RequestManager:: requestSetMeshQuadWithEdges
@@ -420,9 +409,8 @@ void RequestManager:: requestSetMeshQuadWithEdges
   int fourthVertexID )
 {
   TRACE(meshID, firstVertexID, secondVertexID, thirdVertexID, fourthVertexID);
-  _com->send(REQUEST_SET_MESH_QUAD_WITH_EDGES, 0);
-  int data[5] = {meshID, firstVertexID, secondVertexID, thirdVertexID, fourthVertexID};
-  _com->send(data, 5, 0);
+  _batchedInts.insert(_batchedInts.end(), {REQUEST_SET_MESH_QUAD_WITH_EDGES, meshID, firstVertexID, secondVertexID, thirdVertexID, fourthVertexID});
+  limitBatch();
 }
 
 void RequestManager:: requestWriteBlockScalarData (
@@ -432,11 +420,10 @@ void RequestManager:: requestWriteBlockScalarData (
   double* values )
 {
   TRACE(dataID, size);
-  _com->send(REQUEST_WRITE_BLOCK_SCALAR_DATA, 0);
-  _com->send(dataID, 0);
-  _com->send(size, 0);
-  _com->send(valueIndices, size, 0);
-  _com->send(values, size, 0);
+  _batchedInts.insert(_batchedInts.end(), {REQUEST_WRITE_BLOCK_SCALAR_DATA, dataID, size});
+  _batchedInts.insert(_batchedInts.end(), valueIndices, valueIndices + size);
+  _batchedDoubles.insert(_batchedDoubles.end(), values, values + size);
+  limitBatch();
 }
 
 void RequestManager:: requestWriteScalarData
@@ -446,10 +433,9 @@ void RequestManager:: requestWriteScalarData
   double value )
 {
   TRACE();
-  _com->send(REQUEST_WRITE_SCALAR_DATA, 0);
-  _com->send(dataID, 0);
-  _com->send(valueIndex, 0);
-  _com->send(value, 0);
+  _batchedInts.insert(_batchedInts.end(), {REQUEST_WRITE_SCALAR_DATA, dataID, valueIndex});
+  _batchedDoubles.push_back(value);
+  limitBatch();
 }
 
 void RequestManager:: requestWriteBlockVectorData (
@@ -459,11 +445,10 @@ void RequestManager:: requestWriteBlockVectorData (
   double* values )
 {
   TRACE(dataID);
-  _com->send(REQUEST_WRITE_BLOCK_VECTOR_DATA, 0);
-  _com->send(dataID, 0);
-  _com->send(size, 0);
-  _com->send(valueIndices, size, 0);
-  _com->send(values, size*_interface.getDimensions(), 0);
+  _batchedInts.insert(_batchedInts.end(), {REQUEST_WRITE_BLOCK_VECTOR_DATA, dataID, size});
+  _batchedInts.insert(_batchedInts.end(), valueIndices, valueIndices + size);
+  _batchedDoubles.insert(_batchedDoubles.end(), values, values + size*_interface.getDimensions());
+  limitBatch();
 }
 
 void RequestManager:: requestWriteVectorData
@@ -473,10 +458,9 @@ void RequestManager:: requestWriteVectorData
   double* value )
 {
   TRACE();
-  _com->send(REQUEST_WRITE_VECTOR_DATA, 0);
-  _com->send(dataID, 0);
-  _com->send(valueIndex, 0);
-  _com->send(value, _interface.getDimensions(), 0);
+  _batchedInts.insert(_batchedInts.end(), {REQUEST_WRITE_VECTOR_DATA, dataID, valueIndex});
+  _batchedDoubles.insert(_batchedDoubles.end(), value, value + _interface.getDimensions());
+  limitBatch();
 }
 
 void RequestManager:: requestReadBlockScalarData (
@@ -486,6 +470,7 @@ void RequestManager:: requestReadBlockScalarData (
   double* values )
 {
   TRACE(dataID, size);
+  flushBatch();
   _com->send(REQUEST_READ_BLOCK_SCALAR_DATA, 0);
   _com->send(dataID, 0);
   _com->send(size, 0);
@@ -500,6 +485,7 @@ void RequestManager:: requestReadScalarData
   double& value )
 {
   TRACE();
+  flushBatch();
   _com->send(REQUEST_READ_SCALAR_DATA, 0);
   _com->send(dataID, 0);
   _com->send(valueIndex, 0);
@@ -514,6 +500,7 @@ void RequestManager:: requestReadBlockVectorData
   double* values )
 {
   TRACE(dataID, size);
+  flushBatch();
   _com->send(REQUEST_READ_BLOCK_VECTOR_DATA, 0);
   _com->send(dataID, 0);
   _com->send(size, 0);
@@ -528,6 +515,7 @@ void RequestManager:: requestReadVectorData
   double* value )
 {
   TRACE();
+  flushBatch();
   _com->send(REQUEST_READ_VETOR_DATA, 0);
   _com->send(dataID, 0);
   _com->send(valueIndex, 0);
@@ -539,6 +527,7 @@ void RequestManager:: requestMapWriteDataFrom
   int fromMeshID )
 {
   TRACE(fromMeshID);
+  flushBatch();
   _com->send(REQUEST_MAP_WRITE_DATA_FROM, 0);
   int ping;
   _com->receive(ping, 0);
@@ -550,6 +539,7 @@ void RequestManager:: requestMapReadDataTo
   int toMeshID )
 {
   TRACE(toMeshID);
+  flushBatch();
   _com->send(REQUEST_MAP_READ_DATA_TO, 0);
   int ping;
   _com->receive(ping, 0);
@@ -640,17 +630,6 @@ void RequestManager:: handleRequestGetMeshVertexSize
   _com->send(size, rankSender);
 }
 
-void RequestManager:: handleRequestResetMesh
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int meshID = -1;
-  _com->receive(meshID, rankSender);
-  _interface.resetMesh(meshID);
-}
-
-
 void RequestManager:: handleRequestSetMeshVertices
 (
   int rankSender )
@@ -713,104 +692,73 @@ void RequestManager:: handleRequestSetMeshEdge
   _com->send(createEdgeID, rankSender);
 }
 
-void RequestManager:: handleRequestSetMeshTriangle
+void RequestManager:: handleRequestBatch
 (
   int rankSender )
 {
   TRACE(rankSender);
-  int data[4]; // 0: meshID, 1,2,3: edge IDs
-  _com->receive(data, 4, rankSender);
-  _interface.setMeshTriangle(data[0], data[1], data[2], data[3]);
-}
-
-void RequestManager:: handleRequestSetMeshTriangleWithEdges
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int data[4]; // 0: meshID, 1,2,3: vertex IDs
-  _com->receive(data, 4, rankSender);
-  _interface.setMeshTriangleWithEdges(data[0], data[1], data[2], data[3]);
-}
-
-void RequestManager:: handleRequestSetMeshQuad
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int data[5]; // 0: meshID, 1,2,3,4: edge IDs
-  _com->receive(data, 5, rankSender);
-  _interface.setMeshQuad(data[0], data[1], data[2], data[3], data[4]);
-}
-
-void RequestManager:: handleRequestSetMeshQuadWithEdges
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int data[5]; // 0: meshID, 1,2,3,4: vertex IDs
-  _com->receive(data, 5, rankSender);
-  _interface.setMeshQuadWithEdges(data[0], data[1], data[2], data[3], data[4]);
-}
-
-void RequestManager:: handleRequestWriteScalarData
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int dataID = -1;
-  _com->receive(dataID, rankSender);
-  int index = -1;
-  _com->receive(index, rankSender);
-  double data;
-  _com->receive(data, rankSender);
-  _interface.writeScalarData(dataID, index, data);
-}
-
-void RequestManager:: handleRequestWriteBlockScalarData
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int dataID = -1;
-  _com->receive(dataID, rankSender);
-  int size = -1;
-  _com->receive(size, rankSender);
-  std::vector<int> indices(size);
-  _com->receive(indices, rankSender);
-  std::vector<double> data(size);
-  _com->receive(data, rankSender);
-  _interface.writeBlockScalarData(dataID, size, indices.data(), data.data());
-}
-
-void RequestManager:: handleRequestWriteBlockVectorData
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int dataID = -1;
-  _com->receive(dataID, rankSender);
-  int size = -1;
-  _com->receive(size, rankSender);
-  std::vector<int> indices(size);
-  _com->receive(indices, rankSender);
-  std::vector<double> data(size*_interface.getDimensions());
-  _com->receive(data, rankSender);
-  _interface.writeBlockVectorData(dataID, size, indices.data(), data.data());
-}
-
-void RequestManager:: handleRequestWriteVectorData
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int dataID = -1;
-  _com->receive(dataID, rankSender);
-  int index = -1;
-  _com->receive( index, rankSender);
-  double data[_interface.getDimensions()];
-  _com->receive(data, _interface.getDimensions(), rankSender);
-  _interface.writeVectorData(dataID, index, data);
+  std::vector<int> ints;
+  std::vector<double> doubles;
+  _com->receive(ints, rankSender);
+  _com->receive(doubles, rankSender);
+  DEBUG("Replay batch of " << ints.size() << " integers and " << doubles.size() << " doubles");
+
+  const int dim = _interface.getDimensions();
+  size_t i = 0; // position in ints
+  size_t d = 0; // position in doubles
+  while (i < ints.size()){
+    const int requestID = ints[i++];
+    switch (requestID){
+    case REQUEST_RESET_MESH:
+      _interface.resetMesh(ints[i]);
+      i += 1;
+      break;
+    case REQUEST_SET_MESH_TRIANGLE:
+      _interface.setMeshTriangle(ints[i], ints[i+1], ints[i+2], ints[i+3]);
+      i += 4;
+      break;
+    case REQUEST_SET_MESH_TRIANGLE_WITH_EDGES:
+      _interface.setMeshTriangleWithEdges(ints[i], ints[i+1], ints[i+2], ints[i+3]);
+      i += 4;
+      break;
+    case REQUEST_SET_MESH_QUAD:
+      _interface.setMeshQuad(ints[i], ints[i+1], ints[i+2], ints[i+3], ints[i+4]);
+      i += 5;
+      break;
+    case REQUEST_SET_MESH_QUAD_WITH_EDGES:
+      _interface.setMeshQuadWithEdges(ints[i], ints[i+1], ints[i+2], ints[i+3], ints[i+4]);
+      i += 5;
+      break;
+    case REQUEST_WRITE_SCALAR_DATA:
+      _interface.writeScalarData(ints[i], ints[i+1], doubles[d]);
+      i += 2;
+      d += 1;
+      break;
+    case REQUEST_WRITE_BLOCK_SCALAR_DATA: {
+      const int size = ints[i+1];
+      _interface.writeBlockScalarData(ints[i], size, ints.data() + i + 2, doubles.data() + d);
+      i += 2 + size;
+      d += size;
+      break;
+    }
+    case REQUEST_WRITE_VECTOR_DATA:
+      _interface.writeVectorData(ints[i], ints[i+1], doubles.data() + d);
+      i += 2;
+      d += dim;
+      break;
+    case REQUEST_WRITE_BLOCK_VECTOR_DATA: {
+      const int size = ints[i+1];
+      _interface.writeBlockVectorData(ints[i], size, ints.data() + i + 2, doubles.data() + d);
+      i += 2 + size;
+      d += size * dim;
+      break;
+    }
+    default:
+      ERROR("Request ID \"" << requestID << "\" cannot be batched");
+      break;
+    }
+  }
+  assertion(i == ints.size() && d == doubles.size(), i, ints.size(), d, doubles.size());
 }
 
 void RequestManager:: handleRequestReadScalarData
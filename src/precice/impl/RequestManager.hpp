@@ -5,6 +5,7 @@
 #include "logging/Logger.hpp"
 #include <set>
 #include <list>
+#include <vector>
 #include <Eigen/Core>
 
 namespace precice {
@@ -16,7 +17,13 @@ namespace precice {
 namespace precice {
 namespace impl {
 
-/// Takes requests from clients and handles requests on server side.
+/**
+ * @brief Takes requests from clients and handles requests on server side.
+ *
+ * Requests without reply, i.e. resetting meshes, setting mesh elements from vertex or edge IDs and
+ * writing data, are not sent right away. The client appends them to a batch, which is sent in one
+ * message before the next request with reply and replayed by the server in the same order.
+ */
 class RequestManager
 {
 public:
@@ -203,9 +210,13 @@ private:
     REQUEST_READ_BLOCK_VECTOR_DATA,
     REQUEST_MAP_WRITE_DATA_FROM,
     REQUEST_MAP_READ_DATA_TO,
+    REQUEST_BATCH,
     REQUEST_PING // Used in tests only
   };
 
+  /// Number of batched integers and doubles, above which the batch is sent without waiting for a request with reply.
+  static constexpr size_t MAX_BATCH_SIZE = 1 << 20;
+
   logging::Logger _log{"impl::RequestManager"};
 
   SolverInterfaceImpl& _interface;
@@ -214,6 +225,18 @@ private:
 
   cplscheme::PtrCouplingScheme _couplingScheme;
 
+  /// Request IDs and integer arguments of the batched requests.
+  std::vector<int> _batchedInts;
+
+  /// Double arguments of the batched requests.
+  std::vector<double> _batchedDoubles;
+
+  /// Sends the batched requests to the server, if there are any.
+  void flushBatch();
+
+  /// Sends the batch once it exceeds MAX_BATCH_SIZE.
+  void limitBatch();
+
   /// Handles request initialize from client.
   void handleRequestInitialze ( const std::list<int>& clientRanks );
 
@@ -235,9 +258,6 @@ private:
   /// Handles request get mesh vertex size from client.
   void handleRequestGetMeshVertexSize(int rankSender);
 
-  /// Handles request reset mesh from client.
-  void handleRequestResetMesh(int rankSender);
-
   /// Handles request set vertex positions from client.
   void handleRequestSetMeshVertices ( int rankSender );
 
@@ -250,29 +270,8 @@ private:
   /// Handles request set mesh edge from client.
   void handleRequestSetMeshEdge ( int rankSender );
 
-  /// Handles request set mesh triangle from client.
-  void handleRequestSetMeshTriangle ( int rankSender );
-
-  /// Handles request set mesh triangle with edges from client.
-  void handleRequestSetMeshTriangleWithEdges ( int rankSender );
-
-  /// Handles request set mesh quad from client.
-  void handleRequestSetMeshQuad ( int rankSender );
-
-  /// Handles request set mesh quad with edges from client.
-  void handleRequestSetMeshQuadWithEdges ( int rankSender );
-
-  /// Handles request write block scalar data from client.
-  void handleRequestWriteBlockScalarData ( int rankSender );
-
-  /// Handles request write scalar data from client.
-  void handleRequestWriteScalarData ( int rankSender );
-
-  /// Handles request write block vector data from client.
-  void handleRequestWriteBlockVectorData ( int rankSender );
-
-  /// Handles request write vector data from client.
-  void handleRequestWriteVectorData ( int rankSender );
+  /// Handles a batch of requests without reply from client.
+  void handleRequestBatch ( int rankSender );
 
   /// Handles request read block scalar data from client.
   void handleRequestReadBlockScalarData ( int rankSender );
@@ -50,6 +50,22 @@ bool syncMode = false;
 
 namespace impl {
 
+namespace {
+/// Returns true, if there are indices and they are consecutive, i.e. the values form one block.
+bool areContiguous(const int* indices, int size)
+{
+  if (size <= 0){
+    return false;
+  }
+  for (int i=1; i < size; i++){
+    if (indices[i] != indices[0] + i){
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
 SolverInterfaceImpl:: SolverInterfaceImpl
 (
   std::string participantName,
@@ -237,9 +253,7 @@ double SolverInterfaceImpl:: initialize()
     std::set<action::Action::Timing> timings;
     double dt = 0.0;
 
-    for (PtrWatchPoint& watchPoint : _accessor->watchPoints()){
-      watchPoint->initialize();
-    }
+    WatchPoint::initialize(_accessor->watchPoints());
 
     // Initialize coupling state, overwrite these values for restart
     double time = 0.0;
@@ -257,6 +271,7 @@ double SolverInterfaceImpl:: initialize()
     }
 
     performDataActions(timings, 0.0, 0.0, 0.0, dt);
+    copyToDataBuffers();
 
     INFO(_couplingScheme->printCouplingState());
   }
@@ -291,6 +306,7 @@ void SolverInterfaceImpl:: initializeData ()
       mapReadData();
     }
     performDataActions(timings, 0.0, 0.0, 0.0, dt);
+    copyToDataBuffers();
     resetWrittenData();
     DEBUG("Plot output...");
     for (const io::ExportContext& context : _accessor->exportContexts()){
@@ -378,6 +394,7 @@ double SolverInterfaceImpl:: advance
 
     if (_couplingScheme->hasDataBeenExchanged()){
       mapReadData();
+      copyToDataBuffers();
     }
 
     INFO(_couplingScheme->printCouplingState());
@@ -446,6 +463,7 @@ void SolverInterfaceImpl:: finalize()
     }
   }
   if(utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode){
+    utils::EventRegistry::instance().putChannel("masterslave", utils::MasterSlave::_communication->getStatistics());
     utils::MasterSlave::_communication->closeConnection();
     utils::MasterSlave::_communication = nullptr;
   }
@@ -668,13 +686,10 @@ void SolverInterfaceImpl:: setMeshVertices
           precice::testMode, "Vertices can only be defined before initialize() is called");
     MeshContext& context = _accessor->meshContext(meshID);
     mesh::PtrMesh mesh(context.mesh);
-    Eigen::VectorXd internalPosition(_dimensions);
     DEBUG("Set positions");
+    int firstID = mesh->createVertices(size, positions);
     for (int i=0; i < size; i++){
-      for (int dim=0; dim < _dimensions; dim++){
-        internalPosition[dim] = positions[i*_dimensions + dim];
-      }
-      ids[i] = mesh->createVertex(internalPosition).getID();
+      ids[i] = firstID + i;
     }
     mesh->allocateDataValues();
   }
@@ -1061,6 +1076,7 @@ void SolverInterfaceImpl:: mapWriteDataFrom
     _requestManager->requestMapWriteDataFrom(fromMeshID);
     return;
   }
+  copyFromDataBuffers();
   impl::MeshContext& context = _accessor->meshContext(fromMeshID);
   impl::MappingContext& mappingContext = context.fromMappingContext;
   if (mappingContext.mapping.use_count() == 0){
@@ -1118,6 +1134,7 @@ void SolverInterfaceImpl:: mapReadDataTo
                    << "\" to mesh \"" << context.mesh->getName() << "\"");
       assertion(mappingContext.mapping==context.mappingContext.mapping);
       mappingContext.mapping->map(inDataID, outDataID);
+      context.hasPendingMapping = false;
 #     ifndef NDEBUG
       int max = context.toData->values().size();
       std::ostringstream stream;
@@ -1129,6 +1146,7 @@ void SolverInterfaceImpl:: mapReadDataTo
     }
   }
   mappingContext.hasMappedData = true;
+  copyToDataBuffers();
 }
 
 void SolverInterfaceImpl:: writeBlockVectorData
@@ -1154,6 +1172,13 @@ void SolverInterfaceImpl:: writeBlockVectorData
         "You cannot call writeBlockVectorData on the scalar data type " << context.fromData->getName());
     assertion(context.toData.get() != nullptr);
     auto& valuesInternal = context.fromData->values();
+    if (areContiguous(valueIndices, size)){
+      assertion((valueIndices[0]+size)*_dimensions <= valuesInternal.size(),
+                valueIndices[0], size, valuesInternal.size());
+      valuesInternal.segment(valueIndices[0]*_dimensions, size*_dimensions) =
+          Eigen::Map<const Eigen::VectorXd>(values, size*_dimensions);
+      return;
+    }
     for (int i=0; i < size; i++){
       int offsetInternal = valueIndices[i]*_dimensions;
       int offset = i*_dimensions;
@@ -1225,6 +1250,11 @@ void SolverInterfaceImpl:: writeBlockScalarData
         "You cannot call writeBlockScalarData on the vector data type " << context.fromData->getName());
     assertion(context.toData.get() != nullptr);
     auto& valuesInternal = context.fromData->values();
+    if (areContiguous(valueIndices, size)){
+      assertion(valueIndices[0]+size <= valuesInternal.size(), valueIndices[0], size, valuesInternal.size());
+      valuesInternal.segment(valueIndices[0], size) = Eigen::Map<const Eigen::VectorXd>(values, size);
+      return;
+    }
     for (int i=0; i < size; i++){
       assertion(i < valuesInternal.size(), i, valuesInternal.size());
       valuesInternal[valueIndices[i]] = values[i];
@@ -1276,10 +1306,18 @@ void SolverInterfaceImpl:: readBlockVectorData
     CHECK(_accessor->isDataUsed(toDataID),
           "You try to read from data that is not defined for " << _accessor->getName());
     DataContext& context = _accessor->dataContext(toDataID);
+    mapPendingReadData(context);
     CHECK(context.toData->getDimensions()==_dimensions,
         "You cannot call readBlockVectorData on the scalar data type " << context.toData->getName());
     assertion(context.fromData.get() != nullptr);
     auto& valuesInternal = context.toData->values();
+    if (areContiguous(valueIndices, size)){
+      assertion((valueIndices[0]+size)*_dimensions <= valuesInternal.size(),
+                valueIndices[0], size, valuesInternal.size());
+      Eigen::Map<Eigen::VectorXd>(values, size*_dimensions) =
+          valuesInternal.segment(valueIndices[0]*_dimensions, size*_dimensions);
+      return;
+    }
     for (int i=0; i < size; i++){
       int offsetInternal = valueIndices[i] * _dimensions;
       int offset = i * _dimensions;
@@ -1307,6 +1345,7 @@ void SolverInterfaceImpl:: readVectorData
     CHECK(_accessor->isDataUsed(toDataID),
           "You try to read from data that is not defined for " << _accessor->getName());
     DataContext& context = _accessor->dataContext(toDataID);
+    mapPendingReadData(context);
     CHECK(context.toData->getDimensions()==_dimensions,
         "You cannot call readVectorData on the scalar data type " << context.toData->getName());
     assertion(context.fromData.use_count() > 0);
@@ -1344,10 +1383,16 @@ void SolverInterfaceImpl:: readBlockScalarData
     CHECK(_accessor->isDataUsed(toDataID),
           "You try to read from data that is not defined for " << _accessor->getName());
     DataContext& context = _accessor->dataContext(toDataID);
+    mapPendingReadData(context);
     CHECK(context.toData->getDimensions()==1,
         "You cannot call readBlockScalarData on the vector data type " << context.toData->getName());
     assertion(context.fromData.get() != nullptr);
     auto& valuesInternal = context.toData->values();
+    if (areContiguous(valueIndices, size)){
+      assertion(valueIndices[0]+size <= valuesInternal.size(), valueIndices[0], size, valuesInternal.size());
+      Eigen::Map<Eigen::VectorXd>(values, size) = valuesInternal.segment(valueIndices[0], size);
+      return;
+    }
     for (int i=0; i < size; i++){
       assertion(valueIndices[i] < valuesInternal.size(),
                valueIndices[i], valuesInternal.size());
@@ -1371,6 +1416,7 @@ void SolverInterfaceImpl:: readScalarData
     CHECK(_accessor->isDataUsed(toDataID),
           "You try to read from data that is not defined for " << _accessor->getName());
     DataContext& context = _accessor->dataContext(toDataID);
+    mapPendingReadData(context);
     CHECK(context.toData->getDimensions()==1,
         "You cannot call readScalarData on the vector data type " << context.toData->getName());
     assertion(context.fromData.use_count() > 0);
@@ -1381,12 +1427,51 @@ void SolverInterfaceImpl:: readScalarData
   DEBUG("Read value = " << value);
 }
 
+double* SolverInterfaceImpl:: accessBlockData
+(
+  int dataID,
+  int firstValueIndex,
+  int size )
+{
+  TRACE(dataID, firstValueIndex, size);
+  CHECK(not _clientMode, "Direct access to data values is not available in client mode!");
+  CHECK(_accessor->isDataUsed(dataID),
+        "You try to access data that is not defined for " << _accessor->getName());
+  DataContext& context = _accessor->dataContext(dataID);
+  const mesh::PtrData& data = context.fromData->getID() == dataID ? context.fromData : context.toData;
+  if (data == context.toData){
+    mapPendingReadData(context);
+  }
+  const int dimensions = data->getDimensions();
+  CHECK(firstValueIndex >= 0 && size >= 0 && (firstValueIndex+size)*dimensions <= data->values().size(),
+        "Values " << firstValueIndex << " to " << firstValueIndex+size-1 << " of data \""
+        << data->getName() << "\" do not exist!");
+  return data->values().data() + firstValueIndex*dimensions;
+}
+
+void SolverInterfaceImpl:: setDataBuffer
+(
+  int     dataID,
+  double* values )
+{
+  TRACE(dataID);
+  CHECK(not _clientMode, "Data buffers of the solver are not available in client mode!");
+  CHECK(_accessor->isDataUsed(dataID),
+        "You try to register a buffer for data that is not defined for " << _accessor->getName());
+  DataContext& context = _accessor->dataContext(dataID);
+  context.solverBuffer = values;
+}
+
 void SolverInterfaceImpl:: exportMesh
 (
   const std::string& filenameSuffix,
   int                exportType )
 {
   TRACE(filenameSuffix, exportType );
+  // Exported meshes contain the read data
+  if (not _accessor->exportContexts().empty()){
+    mapAllPendingReadData();
+  }
   // Export meshes
   //const ExportContext& context = _accessor->exportContext();
   for (const io::ExportContext& context : _accessor->exportContexts()) {
@@ -1506,7 +1591,8 @@ void SolverInterfaceImpl:: configurePartitions
       std::string provider ( context->receiveMeshFrom );
       DEBUG ( "Receiving mesh from " << provider );
       
-      context->partition = partition::PtrPartition(new partition::ReceivedPartition(context->mesh, context->geoFilter, context->safetyFactor));
+      context->partition = partition::PtrPartition(new partition::ReceivedPartition(context->mesh, context->geoFilter, context->safetyFactor,
+                                                                                    context->reorderVertices));
 
       m2n::PtrM2N m2n = m2nConfig->getM2N ( receiver, provider );
       m2n->createDistributedCommunication(context->mesh);
@@ -1558,6 +1644,7 @@ void SolverInterfaceImpl:: computePartitions()
 void SolverInterfaceImpl:: mapWrittenData()
 {
   TRACE();
+  copyFromDataBuffers();
   using namespace mapping;
   MappingConfiguration::Timing timing;
   // Compute mappings
@@ -1643,6 +1730,11 @@ void SolverInterfaceImpl:: mapReadData()
     mapNow |= timing == mapping::MappingConfiguration::INITIAL;
     bool hasMapping = context.mappingContext.mapping.get() != nullptr;
     bool hasMapped = context.mappingContext.hasMappedData;
+    if (timing == mapping::MappingConfiguration::ON_READ && hasMapping){
+      DEBUG("Defer mapping of read data \"" << context.fromData->getName()
+                   << "\" to mesh \"" << context.mesh->getName() << "\" until it is read");
+      context.hasPendingMapping = true;
+    }
     if (mapNow && hasMapping && (not hasMapped)){
       int inDataID = context.fromData->getID();
       int outDataID = context.toData->getID();
@@ -1673,6 +1765,68 @@ void SolverInterfaceImpl:: mapReadData()
   }
 }
 
+void SolverInterfaceImpl:: mapPendingReadData
+(
+  DataContext& context )
+{
+  if (not context.hasPendingMapping){
+    return;
+  }
+  TRACE(context.toData->getName());
+  context.hasPendingMapping = false;
+  const mapping::PtrMapping& mapping = context.mappingContext.mapping;
+  if (not mapping->hasComputedMapping()){
+    DEBUG("Compute read mapping from mesh \""
+          << _accessor->meshContext(context.mappingContext.fromMeshID).mesh->getName()
+          << "\" to mesh \""
+          << _accessor->meshContext(context.mappingContext.toMeshID).mesh->getName() << "\"");
+    mapping->computeMapping();
+  }
+  context.toData->values() = Eigen::VectorXd::Zero(context.toData->values().size());
+  DEBUG("Map read data \"" << context.fromData->getName()
+        << "\" to mesh \"" << context.mesh->getName() << "\"");
+  mapping->map(context.fromData->getID(), context.toData->getID());
+
+  // Clear the mapping as soon as no other pending data uses it, as for mappings on advance
+  for (const impl::DataContext& other : _accessor->readDataContexts()){
+    if (other.hasPendingMapping && other.mappingContext.mapping == mapping){
+      return;
+    }
+  }
+  mapping->clear();
+}
+
+void SolverInterfaceImpl:: mapAllPendingReadData()
+{
+  TRACE();
+  for (impl::DataContext& context : _accessor->readDataContexts()){
+    mapPendingReadData(context);
+  }
+}
+
+void SolverInterfaceImpl:: copyFromDataBuffers()
+{
+  TRACE();
+  for (impl::DataContext& context : _accessor->writeDataContexts()){
+    if (context.solverBuffer != nullptr){
+      auto& values = context.fromData->values();
+      values = Eigen::Map<const Eigen::VectorXd>(context.solverBuffer, values.size());
+    }
+  }
+}
+
+void SolverInterfaceImpl:: copyToDataBuffers()
+{
+  TRACE();
+  for (impl::DataContext& context : _accessor->readDataContexts()){
+    if (context.solverBuffer != nullptr){
+      mapPendingReadData(context);
+      const auto& values = context.toData->values();
+      Eigen::Map<Eigen::VectorXd>(context.solverBuffer, values.size()) = values;
+    }
+  }
+}
+
 void SolverInterfaceImpl:: performDataActions
 (
   const std::set<action::Action::Timing>& timings,
@@ -1685,6 +1839,8 @@ void SolverInterfaceImpl:: performDataActions
   assertion(not _clientMode);
   for (action::PtrAction& action : _accessor->actions()) {
     if (timings.find(action->getTiming()) != timings.end()){
+      // Actions may operate on read data
+      mapAllPendingReadData();
       action->performAction(time, dt, partFullDt, fullDt);
     }
   }
@@ -1719,6 +1875,9 @@ void SolverInterfaceImpl:: handleExports()
 
   if (_couplingScheme->isCouplingTimestepComplete()){
     // Export watch point data
+    if (not _accessor->watchPoints().empty()){
+      mapAllPendingReadData();
+    }
     for (const PtrWatchPoint& watchPoint : _accessor->watchPoints()) {
       watchPoint->exportPointData(_couplingScheme->getTime());
     }
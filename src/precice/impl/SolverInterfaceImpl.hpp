@@ -28,6 +28,8 @@ namespace precice {
 namespace PreciceTests {
   namespace Serial {
     struct TestConfiguration;
+    struct testExplicitWithLazyReadMapping;
+    struct testExplicitWithLazyReadMappingAndWatchPoint;
   }
 }
 
@@ -423,6 +425,17 @@ public:
     int     valueIndex,
     double& value );
 
+  /// Returns a pointer to the values of the data at the vertices firstValueIndex, ..., firstValueIndex+size-1.
+  double* accessBlockData (
+    int dataID,
+    int firstValueIndex,
+    int size );
+
+  /// Registers a buffer of the solver for the values of the data at all vertices, nullptr deregisters it.
+  void setDataBuffer (
+    int     dataID,
+    double* values );
+
   /**
    * @brief Sets the location for all output of preCICE.
    *
@@ -566,6 +579,18 @@ private:
   /// Computes, performs, and resets all suitable read mappings.
   void mapReadData();
 
+  /// Performs the read mapping of the data, if it has been deferred until the data is read.
+  void mapPendingReadData(DataContext& context);
+
+  /// Performs all deferred read mappings, before read data is exported or used by actions.
+  void mapAllPendingReadData();
+
+  /// Copies the values of all registered buffers of write data into the write data.
+  void copyFromDataBuffers();
+
+  /// Copies the read data into all registered buffers of read data.
+  void copyToDataBuffers();
+
   /**
    * @brief Performs all data actions with given timing.
    *
@@ -601,6 +626,8 @@ private:
 
   /// To allow white box tests.
   friend struct PreciceTests::Serial::TestConfiguration;
+  friend struct PreciceTests::Serial::testExplicitWithLazyReadMapping;
+  friend struct PreciceTests::Serial::testExplicitWithLazyReadMappingAndWatchPoint;
 };
 
 }} // namespace precice, impl
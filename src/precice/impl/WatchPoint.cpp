@@ -1,14 +1,15 @@
 #include "WatchPoint.hpp"
-#include "query/FindClosestVertex.hpp"
-#include "query/FindClosestEdge.hpp"
-#include "query/FindClosestTriangle.hpp"
+#include "query/FindClosest.hpp"
+#include "math/differences.hpp"
 #include "mesh/Mesh.hpp"
+#include "mesh/RTree.hpp"
 #include "mesh/Vertex.hpp"
 #include "mesh/Edge.hpp"
 #include "mesh/Triangle.hpp"
 #include "mesh/Data.hpp"
 #include "utils/MasterSlave.hpp"
 #include "com/Communication.hpp"
+#include <algorithm>
 #include <limits>
 
 namespace precice {
@@ -18,12 +19,14 @@ WatchPoint:: WatchPoint
 (
   Eigen::VectorXd    pointCoords,
   mesh::PtrMesh      meshToWatch,
-  const std::string& exportFilename )
+  const std::string& exportFilename,
+  int                flushInterval )
 :
   _point(std::move(pointCoords)),
   _mesh(std::move(meshToWatch)),
   _txtWriter ( exportFilename )
 {
+  _txtWriter.setFlushInterval(flushInterval);
   assertion ( _mesh.use_count() > 0 );
   assertion ( _point.size() == _mesh->getDimensions(), _point.size(),
                _mesh->getDimensions() );
@@ -37,89 +40,155 @@ const mesh::PtrMesh& WatchPoint:: mesh() const
 void WatchPoint:: initialize()
 {
   TRACE();
-  // Find closest vertex
-  if(_mesh->vertices().size()>0){
-    query::FindClosestVertex findVertex ( _point );
-    findVertex ( *_mesh );
-    _vertices.push_back ( & findVertex.getClosestVertex() );
-    _shortestDistance = findVertex.getEuclidianDistance ();
-    _weights.push_back ( 1.0 );
+  locate();
+  selectClosestRanks({this});
+  if (_isClosest){
+    initializeWriter();
   }
+}
 
-  if(utils::MasterSlave::_slaveMode){
-    utils::MasterSlave::_communication->send(_shortestDistance, 0);
-    utils::MasterSlave::_communication->receive(_isClosest, 0);
+void WatchPoint:: initialize
+(
+  const std::vector<PtrWatchPoint>& watchPoints )
+{
+  std::vector<WatchPoint*> located;
+  for (const PtrWatchPoint& watchPoint : watchPoints){
+    watchPoint->locate();
+    located.push_back(watchPoint.get());
   }
-
-  if(utils::MasterSlave::_masterMode){
-    int closestRank = 0;
-    double closestDistanceGlobal = _shortestDistance;
-    double closestDistanceLocal = std::numeric_limits<double>::max();
-    for(int rankSlave = 1; rankSlave < utils::MasterSlave::_size; rankSlave++){
-      utils::MasterSlave::_communication->receive(closestDistanceLocal, rankSlave);
-      if(closestDistanceLocal < closestDistanceGlobal){
-        closestDistanceGlobal = closestDistanceLocal;
-        closestRank = rankSlave;
-      }
-    }
-    _isClosest = closestRank == 0;
-    for(int rankSlave = 1; rankSlave < utils::MasterSlave::_size; rankSlave++){
-      utils::MasterSlave::_communication->send(closestRank==rankSlave, rankSlave);
+  selectClosestRanks(located);
+  for (WatchPoint* watchPoint : located){
+    if (watchPoint->_isClosest){
+      watchPoint->initializeWriter();
     }
   }
+}
 
-  DEBUG("Rank: " << utils::MasterSlave::_rank << ", isClosest: " << _isClosest);
+void WatchPoint:: locate()
+{
+  TRACE(_point);
+  _vertices.clear();
+  _weights.clear();
+  _shortestDistance = std::numeric_limits<double>::max();
+  if (_mesh->vertices().empty()){
+    return;
+  }
 
-  if(_isClosest){
+  // Visit the primitives ordered by the distance to their bounding box, until no closer one can follow
+  const int dimensions = _mesh->getDimensions();
+  mesh::Vertex searchPoint(_point, -1);
+  mesh::Point3d point(_point[0], _point[1], dimensions == 3 ? _point[2] : 0.0);
+  mesh::PtrPrimitiveRTree rtree = mesh::rtree::getPrimitiveRTree(_mesh);
+  namespace bgi = boost::geometry::index;
+  for (auto it = rtree->qbegin(bgi::nearest(point, rtree->size())); it != rtree->qend(); ++it){
+    if (boost::geometry::distance(point, it->first) > _shortestDistance){
+      break;
+    }
+    query::InterpolationElements elements;
+    const mesh::PrimitiveIndex& primitive = it->second;
+    if (primitive.type == mesh::Primitive::Vertex){
+      elements = query::generateInterpolationElements(searchPoint, _mesh->vertices()[primitive.index]);
+    }
+    else if (primitive.type == mesh::Primitive::Edge){
+      elements = query::generateInterpolationElements(searchPoint, _mesh->edges()[primitive.index]);
+    }
+    else if (primitive.type == mesh::Primitive::Triangle && dimensions == 3){
+      elements = query::generateInterpolationElements(searchPoint, _mesh->triangles()[primitive.index]);
+    }
+    else {
+      continue;
+    }
 
-    // Find closest edge
-    query::FindClosestEdge findEdge ( _point );
-    if ( findEdge(*_mesh) ) {
-      if ( findEdge.getEuclidianDistance() < _shortestDistance ) {
-        //         _closestEdge = & findEdge.getClosestEdge ();
-        _vertices.clear ();
-        _vertices.push_back ( & findEdge.getClosestEdge().vertex(0) );
-        _vertices.push_back ( & findEdge.getClosestEdge().vertex(1) );
-        _shortestDistance = findEdge.getEuclidianDistance ();
-        _weights.clear ();
-        _weights.push_back ( findEdge.getProjectionPointParameter(0) );
-        _weights.push_back ( findEdge.getProjectionPointParameter(1) );
-      }
+    // Only projections inside of the edge or triangle are considered
+    bool inside = std::none_of(elements.begin(), elements.end(), [](const query::InterpolationElement& element){
+      return element.weight < - math::NUMERICAL_ZERO_DIFFERENCE;
+    });
+    if (not inside){
+      continue;
     }
-    if ( _mesh->getDimensions() == 3 ) {
-      // Find closest triangle
-      query::FindClosestTriangle findTriangle ( _point );
-      if ( findTriangle(*_mesh) ) {
-        if ( findTriangle.getEuclidianDistance() < _shortestDistance ) {
-          _vertices.clear ();
-          _vertices.push_back ( & findTriangle.getClosestTriangle().vertex(0) );
-          _vertices.push_back ( & findTriangle.getClosestTriangle().vertex(1) );
-          _vertices.push_back ( & findTriangle.getClosestTriangle().vertex(2) );
-          _shortestDistance = findTriangle.getEuclidianDistance ();
-          _weights.clear ();
-          _weights.push_back ( findTriangle.getProjectionPointParameter(0) );
-          _weights.push_back ( findTriangle.getProjectionPointParameter(1) );
-          _weights.push_back ( findTriangle.getProjectionPointParameter(2) );
-        }
+    Eigen::VectorXd projection = Eigen::VectorXd::Zero(dimensions);
+    for (const query::InterpolationElement& element : elements){
+      projection += element.weight * element.element->getCoords();
+    }
+    double distance = (projection - _point).norm();
+    if (distance < _shortestDistance){
+      _shortestDistance = distance;
+      _vertices.clear();
+      _weights.clear();
+      for (const query::InterpolationElement& element : elements){
+        _vertices.push_back(const_cast<mesh::Vertex*>(element.element));
+        _weights.push_back(element.weight);
       }
     }
+  }
+  DEBUG("Rank: " << utils::MasterSlave::_rank << ", distance: " << _shortestDistance);
+}
+
+void WatchPoint:: selectClosestRanks
+(
+  const std::vector<WatchPoint*>& watchPoints )
+{
+  if (watchPoints.empty()){
+    return;
+  }
+  std::vector<double> distances;
+  for (const WatchPoint* watchPoint : watchPoints){
+    distances.push_back(watchPoint->_shortestDistance);
+  }
+
+  if(utils::MasterSlave::_slaveMode){
+    utils::MasterSlave::_communication->send(distances, 0);
+    std::vector<int> isClosest;
+    utils::MasterSlave::_communication->receive(isClosest, 0);
+    assertion(isClosest.size() == watchPoints.size());
+    for (size_t i=0; i < watchPoints.size(); i++){
+      watchPoints[i]->_isClosest = isClosest[i] == 1;
+    }
+  }
 
-    io::TXTTableWriter::DataType vectorType = _mesh->getDimensions() == 2
-        ? io::TXTTableWriter::VECTOR2D
-        : io::TXTTableWriter::VECTOR3D;
-    _txtWriter.addData("Time", io::TXTTableWriter::DOUBLE);
-    _txtWriter.addData("Coordinate", vectorType);
-    for (size_t i=0; i < _mesh->data().size(); i++){
-      _dataToExport.push_back(_mesh->data()[i]);
-      if (_dataToExport[i]->getDimensions() > 1){
-        _txtWriter.addData(_dataToExport[i]->getName(), vectorType);
+  if(utils::MasterSlave::_masterMode){
+    std::vector<int> closestRanks(watchPoints.size(), 0);
+    std::vector<double> closestDistances = distances;
+    std::vector<double> slaveDistances;
+    for(int rankSlave = 1; rankSlave < utils::MasterSlave::_size; rankSlave++){
+      utils::MasterSlave::_communication->receive(slaveDistances, rankSlave);
+      assertion(slaveDistances.size() == watchPoints.size());
+      for (size_t i=0; i < watchPoints.size(); i++){
+        if (slaveDistances[i] < closestDistances[i]){
+          closestDistances[i] = slaveDistances[i];
+          closestRanks[i] = rankSlave;
+        }
       }
-      else {
-        _txtWriter.addData(_dataToExport[i]->getName(), io::TXTTableWriter::DOUBLE);
+    }
+    for (size_t i=0; i < watchPoints.size(); i++){
+      watchPoints[i]->_isClosest = closestRanks[i] == 0;
+    }
+    for(int rankSlave = 1; rankSlave < utils::MasterSlave::_size; rankSlave++){
+      std::vector<int> isClosest(watchPoints.size());
+      for (size_t i=0; i < watchPoints.size(); i++){
+        isClosest[i] = closestRanks[i] == rankSlave ? 1 : 0;
       }
+      utils::MasterSlave::_communication->send(isClosest, rankSlave);
     }
+  }
+}
 
-  } //isClosest
+void WatchPoint:: initializeWriter()
+{
+  io::TXTTableWriter::DataType vectorType = _mesh->getDimensions() == 2
+      ? io::TXTTableWriter::VECTOR2D
+      : io::TXTTableWriter::VECTOR3D;
+  _txtWriter.addData("Time", io::TXTTableWriter::DOUBLE);
+  _txtWriter.addData("Coordinate", vectorType);
+  for (size_t i=0; i < _mesh->data().size(); i++){
+    _dataToExport.push_back(_mesh->data()[i]);
+    if (_dataToExport[i]->getDimensions() > 1){
+      _txtWriter.addData(_dataToExport[i]->getName(), vectorType);
+    }
+    else {
+      _txtWriter.addData(_dataToExport[i]->getName(), io::TXTTableWriter::DOUBLE);
+    }
+  }
 }
 
 void WatchPoint:: exportPointData
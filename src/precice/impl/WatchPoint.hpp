@@ -25,11 +25,13 @@ public:
    * @brief Constructor.
    *
    * @param[in] meshToWatch Mesh to be watched, can be empty on construction.
+   * @param[in] flushInterval Number of exported lines after which the output file is flushed.
    */
   WatchPoint (
     Eigen::VectorXd    pointCoords,
     mesh::PtrMesh      meshToWatch,
-    const std::string& exportFilename );
+    const std::string& exportFilename,
+    int                flushInterval = 1 );
 
   const mesh::PtrMesh& mesh() const;
   
@@ -38,6 +40,14 @@ public:
   /// Initializes the watch point for exporting point data.
   void initialize();
 
+  /**
+   * @brief Initializes all watch points of a participant at once.
+   *
+   * The watch points are located by the cached primitive R-tree of their meshes. In master-slave
+   * mode, the distances of all watch points are gathered in one message per slave.
+   */
+  static void initialize(const std::vector<PtrWatchPoint>& watchPoints);
+
   /// Writes one line with data of the watchpoint into the output file.
   void exportPointData(double time);
 
@@ -62,6 +72,15 @@ private:
   /// Holds the information if this processor is the closest
   bool _isClosest = true;
 
+  /// Finds the closest vertex, edge, or triangle and sets the vertices and weights to interpolate.
+  void locate();
+
+  /// Selects the closest rank for each watch point, given the local distances of the watch points.
+  static void selectClosestRanks(const std::vector<WatchPoint*>& watchPoints);
+
+  /// Adds the columns of the output file.
+  void initializeWriter();
+
   void getValue (
     Eigen::VectorXd&  value,
     mesh::PtrData&    data );
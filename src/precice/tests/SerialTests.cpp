@@ -501,6 +501,234 @@ BOOST_AUTO_TEST_CASE(testExplicitWithBlockDataExchange,
   }
 }
 
+/// Both solvers access the data values in place, SolverTwo by registered buffers.
+BOOST_AUTO_TEST_CASE(testExplicitWithDataBuffers,
+                     * testing::MinRanks(2)
+                     * boost::unit_test::fixture<testing::MPICommRestrictFixture>(std::vector<int>({0, 1})))
+{
+  if (utils::Parallel::getCommunicatorSize() != 2)
+    return;
+
+  using Eigen::Vector3d;
+  const int size = 4;
+  Eigen::VectorXd positions(size*3);
+  positions << 0.0, 0.0, 0.0,  1.0, 0.0, 0.0,  0.0, 1.0, 0.0,  1.0, 1.0, 0.0;
+  double counter = 0.0;
+
+  if (utils::Parallel::getProcessRank() == 0){
+    SolverInterface cplInterface("SolverOne", 0, 1);
+    config::Configuration config;
+    xml::configure(config.getXMLTag(), _pathToTests + "explicit-mpi-single-non-inc.xml");
+    cplInterface._impl->configure(config.getSolverInterfaceConfiguration());
+    int meshOneID = cplInterface.getMeshID("MeshOne");
+    Eigen::VectorXi vertexIDs(size);
+    cplInterface.setMeshVertices(meshOneID, size, positions.data(), vertexIDs.data());
+    int forcesID = cplInterface.getDataID("Forces", meshOneID);
+    int velocitiesID = cplInterface.getDataID("Velocities", meshOneID);
+    double maxDt = cplInterface.initialize();
+
+    // Empty blocks, as on ranks without vertices, are ignored
+    cplInterface.writeBlockVectorData(forcesID, 0, nullptr, nullptr);
+    cplInterface.readBlockVectorData(velocitiesID, 0, nullptr, nullptr);
+    cplInterface.writeBlockScalarData(cplInterface.getDataID("Pressures", meshOneID), 0, nullptr, nullptr);
+    cplInterface.readBlockScalarData(cplInterface.getDataID("Temperatures", meshOneID), 0, nullptr, nullptr);
+
+    while (cplInterface.isCouplingOngoing()){
+      Eigen::Map<Eigen::VectorXd> forces(cplInterface.accessBlockData(forcesID, vertexIDs[0], size), size*3);
+      forces = positions + Eigen::VectorXd::Constant(size*3, counter);
+      maxDt = cplInterface.advance(maxDt);
+      if (cplInterface.isCouplingOngoing()){
+        cplInterface.mapReadDataTo(meshOneID);
+        Eigen::Map<Eigen::VectorXd> velocities(cplInterface.accessBlockData(velocitiesID, vertexIDs[0], size), size*3);
+        BOOST_TEST(velocities == positions + Eigen::VectorXd::Constant(size*3, counter));
+        counter += 1.0;
+      }
+    }
+    cplInterface.finalize();
+  }
+  else if (utils::Parallel::getProcessRank() == 1){
+    SolverInterface cplInterface("SolverTwo", 0, 1);
+    config::Configuration config;
+    xml::configure(config.getXMLTag(), _pathToTests + "explicit-mpi-single-non-inc.xml");
+    cplInterface._impl->configure(config.getSolverInterfaceConfiguration());
+    int squareID = cplInterface.getMeshID("Test-Square");
+    Eigen::VectorXi vertexIDs(size);
+    cplInterface.setMeshVertices(squareID, size, positions.data(), vertexIDs.data());
+    Eigen::VectorXd forces = Eigen::VectorXd::Zero(size*3);
+    Eigen::VectorXd velocities(size*3);
+    cplInterface.setDataBuffer(cplInterface.getDataID("Forces", squareID), forces.data());
+    cplInterface.setDataBuffer(cplInterface.getDataID("Velocities", squareID), velocities.data());
+    double maxDt = cplInterface.initialize();
+    BOOST_TEST(forces == positions + Eigen::VectorXd::Constant(size*3, counter));
+    counter += 1.0;
+
+    while (cplInterface.isCouplingOngoing()){
+      velocities = positions + Eigen::VectorXd::Constant(size*3, counter - 1.0);
+      maxDt = cplInterface.advance(maxDt);
+      if (cplInterface.isCouplingOngoing()){
+        BOOST_TEST(forces == positions + Eigen::VectorXd::Constant(size*3, counter));
+        counter += 1.0;
+      }
+    }
+    cplInterface.finalize();
+  }
+}
+
+/// SolverOne maps read data only when it reads the data.
+BOOST_AUTO_TEST_CASE(testExplicitWithLazyReadMapping,
+                     * testing::MinRanks(2)
+                     * boost::unit_test::fixture<testing::MPICommRestrictFixture>(std::vector<int>({0, 1})))
+{
+  if (utils::Parallel::getCommunicatorSize() != 2)
+    return;
+
+  const int size = 4;
+  Eigen::VectorXd positions(size*3);
+  positions << 0.0, 0.0, 0.0,  1.0, 0.0, 0.0,  0.0, 1.0, 0.0,  1.0, 1.0, 0.0;
+  Eigen::VectorXd xCoords(size);
+  xCoords << 0.0, 1.0, 0.0, 1.0;
+  double counter = 0.0;
+
+  if (utils::Parallel::getProcessRank() == 0){
+    SolverInterface cplInterface("SolverOne", 0, 1);
+    config::Configuration config;
+    xml::configure(config.getXMLTag(), _pathToTests + "explicit-lazy-read-mapping.xml");
+    cplInterface._impl->configure(config.getSolverInterfaceConfiguration());
+    int meshOneID = cplInterface.getMeshID("MeshOne");
+    Eigen::VectorXi vertexIDs(size);
+    cplInterface.setMeshVertices(meshOneID, size, positions.data(), vertexIDs.data());
+    int forcesID = cplInterface.getDataID("Forces", meshOneID);
+    int pressuresID = cplInterface.getDataID("Pressures", meshOneID);
+    int velocitiesID = cplInterface.getDataID("Velocities", meshOneID);
+    int temperaturesID = cplInterface.getDataID("Temperatures", meshOneID);
+    impl::DataContext& velocitiesContext = cplInterface._impl->_accessor->dataContext(velocitiesID);
+    impl::DataContext& temperaturesContext = cplInterface._impl->_accessor->dataContext(temperaturesID);
+    double maxDt = cplInterface.initialize();
+    Eigen::VectorXd velocities(size*3);
+    Eigen::VectorXd temperatures(size);
+
+    while (cplInterface.isCouplingOngoing()){
+      Eigen::VectorXd forces = positions + Eigen::VectorXd::Constant(size*3, counter);
+      Eigen::VectorXd pressures = xCoords + Eigen::VectorXd::Constant(size, counter);
+      cplInterface.writeBlockVectorData(forcesID, size, vertexIDs.data(), forces.data());
+      cplInterface.writeBlockScalarData(pressuresID, size, vertexIDs.data(), pressures.data());
+      maxDt = cplInterface.advance(maxDt);
+      if (cplInterface.isCouplingOngoing()){
+        BOOST_TEST(velocitiesContext.hasPendingMapping);
+        BOOST_TEST(temperaturesContext.hasPendingMapping);
+        cplInterface.readBlockVectorData(velocitiesID, size, vertexIDs.data(), velocities.data());
+        BOOST_TEST(velocities == positions + Eigen::VectorXd::Constant(size*3, counter));
+        BOOST_TEST(not velocitiesContext.hasPendingMapping);
+        BOOST_TEST(temperaturesContext.hasPendingMapping);
+        counter += 1.0;
+      }
+    }
+    // Temperatures are mapped once, at the only read
+    cplInterface.readBlockScalarData(temperaturesID, size, vertexIDs.data(), temperatures.data());
+    BOOST_TEST(temperatures == xCoords + Eigen::VectorXd::Constant(size, counter));
+    BOOST_TEST(not temperaturesContext.hasPendingMapping);
+    // The shared mapping is cleared once the pending velocities are mapped as well
+    BOOST_TEST(velocitiesContext.hasPendingMapping);
+    BOOST_TEST(temperaturesContext.mappingContext.mapping->hasComputedMapping());
+    cplInterface.readBlockVectorData(velocitiesID, size, vertexIDs.data(), velocities.data());
+    BOOST_TEST(velocities == positions + Eigen::VectorXd::Constant(size*3, counter));
+    BOOST_TEST(not velocitiesContext.hasPendingMapping);
+    BOOST_TEST(not temperaturesContext.mappingContext.mapping->hasComputedMapping());
+    cplInterface.finalize();
+  }
+  else if (utils::Parallel::getProcessRank() == 1){
+    SolverInterface cplInterface("SolverTwo", 0, 1);
+    config::Configuration config;
+    xml::configure(config.getXMLTag(), _pathToTests + "explicit-lazy-read-mapping.xml");
+    cplInterface._impl->configure(config.getSolverInterfaceConfiguration());
+    int squareID = cplInterface.getMeshID("Test-Square");
+    Eigen::VectorXi vertexIDs(size);
+    cplInterface.setMeshVertices(squareID, size, positions.data(), vertexIDs.data());
+    int velocitiesID = cplInterface.getDataID("Velocities", squareID);
+    int temperaturesID = cplInterface.getDataID("Temperatures", squareID);
+    double maxDt = cplInterface.initialize();
+
+    while (cplInterface.isCouplingOngoing()){
+      Eigen::VectorXd velocities = positions + Eigen::VectorXd::Constant(size*3, counter);
+      Eigen::VectorXd temperatures = xCoords + Eigen::VectorXd::Constant(size, counter);
+      cplInterface.writeBlockVectorData(velocitiesID, size, vertexIDs.data(), velocities.data());
+      cplInterface.writeBlockScalarData(temperaturesID, size, vertexIDs.data(), temperatures.data());
+      maxDt = cplInterface.advance(maxDt);
+      counter += 1.0;
+    }
+    cplInterface.finalize();
+  }
+}
+
+/// Watch points export the read data, hence SolverOne maps it before the export.
+BOOST_AUTO_TEST_CASE(testExplicitWithLazyReadMappingAndWatchPoint,
+                     * testing::MinRanks(2)
+                     * boost::unit_test::fixture<testing::MPICommRestrictFixture>(std::vector<int>({0, 1})))
+{
+  if (utils::Parallel::getCommunicatorSize() != 2)
+    return;
+
+  const int size = 4;
+  Eigen::VectorXd positions(size*3);
+  positions << 0.0, 0.0, 0.0,  1.0, 0.0, 0.0,  0.0, 1.0, 0.0,  1.0, 1.0, 0.0;
+  Eigen::VectorXd xCoords(size);
+  xCoords << 0.0, 1.0, 0.0, 1.0;
+  double counter = 0.0;
+
+  if (utils::Parallel::getProcessRank() == 0){
+    SolverInterface cplInterface("SolverOne", 0, 1);
+    config::Configuration config;
+    xml::configure(config.getXMLTag(), _pathToTests + "explicit-lazy-read-mapping-watchpoint.xml");
+    cplInterface._impl->configure(config.getSolverInterfaceConfiguration());
+    int meshOneID = cplInterface.getMeshID("MeshOne");
+    Eigen::VectorXi vertexIDs(size);
+    cplInterface.setMeshVertices(meshOneID, size, positions.data(), vertexIDs.data());
+    int forcesID = cplInterface.getDataID("Forces", meshOneID);
+    int pressuresID = cplInterface.getDataID("Pressures", meshOneID);
+    int temperaturesID = cplInterface.getDataID("Temperatures", meshOneID);
+    impl::DataContext& temperaturesContext = cplInterface._impl->_accessor->dataContext(temperaturesID);
+    double maxDt = cplInterface.initialize();
+
+    while (cplInterface.isCouplingOngoing()){
+      Eigen::VectorXd forces = positions + Eigen::VectorXd::Constant(size*3, counter);
+      Eigen::VectorXd pressures = xCoords + Eigen::VectorXd::Constant(size, counter);
+      cplInterface.writeBlockVectorData(forcesID, size, vertexIDs.data(), forces.data());
+      cplInterface.writeBlockScalarData(pressuresID, size, vertexIDs.data(), pressures.data());
+      maxDt = cplInterface.advance(maxDt);
+      if (cplInterface.isCouplingOngoing()){
+        // Mapped for the watch point without being read by the solver
+        BOOST_TEST(not temperaturesContext.hasPendingMapping);
+        BOOST_TEST(temperaturesContext.toData->values() == xCoords + Eigen::VectorXd::Constant(size, counter));
+        BOOST_TEST(not temperaturesContext.mappingContext.mapping->hasComputedMapping());
+        counter += 1.0;
+      }
+    }
+    cplInterface.finalize();
+  }
+  else if (utils::Parallel::getProcessRank() == 1){
+    SolverInterface cplInterface("SolverTwo", 0, 1);
+    config::Configuration config;
+    xml::configure(config.getXMLTag(), _pathToTests + "explicit-lazy-read-mapping-watchpoint.xml");
+    cplInterface._impl->configure(config.getSolverInterfaceConfiguration());
+    int squareID = cplInterface.getMeshID("Test-Square");
+    Eigen::VectorXi vertexIDs(size);
+    cplInterface.setMeshVertices(squareID, size, positions.data(), vertexIDs.data());
+    int velocitiesID = cplInterface.getDataID("Velocities", squareID);
+    int temperaturesID = cplInterface.getDataID("Temperatures", squareID);
+    double maxDt = cplInterface.initialize();
+
+    while (cplInterface.isCouplingOngoing()){
+      Eigen::VectorXd velocities = positions + Eigen::VectorXd::Constant(size*3, counter);
+      Eigen::VectorXd temperatures = xCoords + Eigen::VectorXd::Constant(size, counter);
+      cplInterface.writeBlockVectorData(velocitiesID, size, vertexIDs.data(), velocities.data());
+      cplInterface.writeBlockScalarData(temperaturesID, size, vertexIDs.data(), temperatures.data());
+      maxDt = cplInterface.advance(maxDt);
+      counter += 1.0;
+    }
+    cplInterface.finalize();
+  }
+}
+
 /**
   * @brief Runs a coupled simulation where one solver supplies a geometry.
   *
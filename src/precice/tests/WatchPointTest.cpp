@@ -1,4 +1,7 @@
+#include <fstream>
+#include <string>
 #include "../impl/WatchPoint.hpp"
+#include "mesh/Data.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
 #include "mesh/Vertex.hpp"
@@ -60,4 +63,52 @@ BOOST_AUTO_TEST_CASE(WatchPoint)
   watchpoint1.exportPointData(1.0);
 }
 
+/// Watch points initialized together, which are projected onto a triangle, an edge, and a vertex.
+BOOST_AUTO_TEST_CASE(WatchPointsBatch)
+{
+  using namespace mesh;
+  PtrMesh mesh(new Mesh("square", 3, false));
+  mesh::Vertex& v1 = mesh->createVertex(Eigen::Vector3d(0.0, 0.0, 0.0));
+  mesh::Vertex& v2 = mesh->createVertex(Eigen::Vector3d(1.0, 0.0, 0.0));
+  mesh::Vertex& v3 = mesh->createVertex(Eigen::Vector3d(0.0, 1.0, 0.0));
+  mesh::Vertex& v4 = mesh->createVertex(Eigen::Vector3d(1.0, 1.0, 0.0));
+  mesh::Edge& e12 = mesh->createEdge(v1, v2);
+  mesh::Edge& e24 = mesh->createEdge(v2, v4);
+  mesh::Edge& e43 = mesh->createEdge(v4, v3);
+  mesh::Edge& e31 = mesh->createEdge(v3, v1);
+  mesh::Edge& e23 = mesh->createEdge(v2, v3);
+  mesh->createTriangle(e12, e23, e31);
+  mesh->createTriangle(e24, e43, e23);
+  PtrData data = mesh->createData("DoubleData", 1);
+  mesh->computeState();
+  mesh->allocateDataValues();
+  for (const mesh::Vertex& vertex : mesh->vertices()) {
+    data->values()[vertex.getID()] = vertex.getCoords()[0] + 2.0 * vertex.getCoords()[1];
+  }
+
+  std::vector<Eigen::Vector3d> points{{0.25, 0.5, 1.0}, {0.5, -1.0, 0.0}, {2.0, 2.0, 0.0}};
+  std::vector<double> expected{1.25, 0.5, 3.0};
+  std::vector<impl::PtrWatchPoint> watchPoints;
+  for (size_t i = 0; i < points.size(); i++) {
+    std::string filename = "precice-WatchPointTest-batch" + std::to_string(i) + ".log";
+    watchPoints.push_back(std::make_shared<impl::WatchPoint>(points[i], mesh, filename, 10));
+  }
+  impl::WatchPoint::initialize(watchPoints);
+  for (const impl::PtrWatchPoint& watchPoint : watchPoints) {
+    watchPoint->exportPointData(0.0);
+  }
+  watchPoints.clear(); // closes the files
+
+  for (size_t i = 0; i < points.size(); i++) {
+    std::ifstream file("precice-WatchPointTest-batch" + std::to_string(i) + ".log");
+    std::string header;
+    std::getline(file, header);
+    double time, x, y, z, value;
+    file >> time >> x >> y >> z >> value;
+    BOOST_TEST(file.good());
+    BOOST_TEST(testing::equals(value, expected[i], 1e-12));
+    BOOST_TEST(z == 0.0);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Precice
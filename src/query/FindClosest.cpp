@@ -1,4 +1,5 @@
 #include "FindClosest.hpp"
+#include "mesh/Mesh.hpp"
 #include "mesh/Vertex.hpp"
 #include "mesh/Edge.hpp"
 #include "mesh/Triangle.hpp"
@@ -84,9 +85,21 @@ InterpolationElements generateInterpolationElements(
   return elems;
 }
 
+bool FindClosest:: operator()
+(
+  mesh::Mesh& mesh )
+{
+  _mesh = &mesh;
+  _findClosestTriangle(mesh);
+  _findClosestEdge(mesh);
+  _findClosestVertex(mesh);
+  _findClosestQuad(mesh);
+  return determineClosest();
+}
+
 bool FindClosest:: hasFound() const
 {
-  return not _closest.meshIDs.empty();
+  return not _closest.interpolationElements.empty();
 }
 
 const ClosestElement& FindClosest:: getClosest()
@@ -131,7 +144,9 @@ bool FindClosest:: determineClosest()
   Eigen::VectorXd normal = Eigen::VectorXd::Zero(_searchpoint.size());
   if ( closestType == 0 ) { // Vertex
     mesh::Vertex& vertex = _findClosestVertex.getClosestVertex ();
-    vertex.getProperties ( vertex.INDEX_GEOMETRY_ID, _closest.meshIDs );
+    if (_mesh) {
+      _mesh->getGeometryIDs(vertex, _closest.meshIDs);
+    }
     _closest.vectorToElement = vertex.getCoords() - _searchpoint;
     normal = vertex.getNormal();
     InterpolationElement element;
@@ -141,7 +156,9 @@ bool FindClosest:: determineClosest()
   }
   else if ( closestType == 1 ) { // Edge
     mesh::Edge& edge = _findClosestEdge.getClosestEdge();
-    edge.getProperties ( edge.INDEX_GEOMETRY_ID, _closest.meshIDs );
+    if (_mesh) {
+      _mesh->getGeometryIDs(edge, _closest.meshIDs);
+    }
     _closest.vectorToElement = _findClosestEdge.getVectorToProjectionPoint();
     normal = edge.getNormal();
     InterpolationElement element0, element1;
@@ -154,7 +171,9 @@ bool FindClosest:: determineClosest()
   }
   else if ( closestType == 2 ) { // Triangle
     mesh::Triangle& triangle = _findClosestTriangle.getClosestTriangle ();
-    triangle.getProperties ( triangle.INDEX_GEOMETRY_ID, _closest.meshIDs );
+    if (_mesh) {
+      _mesh->getGeometryIDs(triangle, _closest.meshIDs);
+    }
     _closest.vectorToElement = _findClosestTriangle.getVectorToProjectionPoint();
     normal = triangle.getNormal();
     InterpolationElement element0, element1, element2;
@@ -170,7 +189,9 @@ bool FindClosest:: determineClosest()
   }
   else if ( closestType == 3 ) { // Quad
     mesh::Quad& quad = _findClosestQuad.getClosestQuad();
-    quad.getProperties(quad.INDEX_GEOMETRY_ID, _closest.meshIDs);
+    if (_mesh) {
+      _mesh->getGeometryIDs(quad, _closest.meshIDs);
+    }
     _closest.vectorToElement = _findClosestQuad.getVectorToProjectionPoint();
     normal = quad.getNormal();
     InterpolationElement element0, element1, element2, element3;
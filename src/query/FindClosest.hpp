@@ -100,6 +100,9 @@ public:
   template<typename CONTAINER_T>
   bool operator() ( CONTAINER_T& container );
 
+  /// Finds closest distance to all elements of the mesh, also determines the geometry IDs of the closest.
+  bool operator() ( mesh::Mesh& mesh );
+
   /// Returns true, if a closest element was found.
   bool hasFound() const;
 
@@ -137,6 +140,9 @@ private:
   /// Search point, from where distances to objects are measured
   const Eigen::VectorXd _searchpoint;
 
+  /// Mesh holding the geometry IDs of the searched elements, if searched in a mesh
+  mesh::Mesh* _mesh = nullptr;
+
   /**
    * @brief Determines the closest element from all FindXY member objects.
    *
@@ -309,14 +309,14 @@ BOOST_AUTO_TEST_CASE(MultipleMeshIDs)
     vertices[i]                  = &mesh.createVertex(vertexCoords);
   }
   mesh::Edge &face = mesh.createEdge(*vertices[0], *vertices[1]);
-  face.addParent(mesh.setSubID("face-2"));
+  mesh.elementProperties(face).addParent(mesh.setSubID("face-2"));
   int idFace = mesh.getID("Mesh-face-2");
   int idsVertices[2];
   mesh.computeState();
   for (int i = 0; i < 2; i++) {
     std::ostringstream stream;
     stream << "vertex-" << i;
-    face.vertex(i).addParent(mesh.setSubID(stream.str()));
+    mesh.elementProperties(face.vertex(i)).addParent(mesh.setSubID(stream.str()));
     idsVertices[i] = mesh.getID("Mesh-" + stream.str());
   }
 
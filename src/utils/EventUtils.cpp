@@ -55,6 +55,41 @@ std::map<std::string, GlobalEventStats> getGlobalStats(std::vector<RankData> eve
 }
 
 
+/// Holds the data of one channel summed over all remote and local ranks and the extrema of the wait time of the local ranks
+struct GlobalChannelStats
+{
+  ChannelData total;
+  double maxWait = -1, minWait = -1;
+  int maxRank = 0, minRank = 0;
+};
+
+
+std::map<std::string, GlobalChannelStats> getChannelStats(std::vector<RankData> const & ranks)
+{
+  std::map<std::string, GlobalChannelStats> globalStats;
+  for (size_t rank = 0; rank < ranks.size(); ++rank) {
+    for (auto & channel : ranks[rank].channelData) {
+      ChannelData rankTotal;
+      for (auto & remote : channel.second)
+        rankTotal += remote.second;
+
+      GlobalChannelStats & stats = globalStats[channel.first];
+      stats.total += rankTotal;
+      double const wait = rankTotal.getWaitTime();
+      if (stats.maxWait < 0 or wait > stats.maxWait) {
+        stats.maxWait = wait;
+        stats.maxRank = rank;
+      }
+      if (stats.minWait < 0 or wait < stats.minWait) {
+        stats.minWait = wait;
+        stats.minRank = rank;
+      }
+    }
+  }
+  return globalStats;
+}
+
+
 struct MPI_EventData
 {
   char name[255] = {'\0'};
@@ -63,6 +98,14 @@ struct MPI_EventData
   int dataSize = 0, stateChangesSize = 0;
 };
 
+/// A ChannelData of one remote rank as transferred in EventRegistry::collect
+struct MPI_ChannelData
+{
+  char name[255] = {'\0'};
+  int remoteRank = 0;
+  ChannelData data;
+};
+
 
 // -----------------------------------------------------------------------
 
@@ -129,6 +172,24 @@ std::vector<int> const & EventData::getData() const
 }
 
 
+// -----------------------------------------------------------------------
+
+ChannelData & ChannelData::operator+=(ChannelData const & other)
+{
+  bytesSent        += other.bytesSent;
+  bytesReceived    += other.bytesReceived;
+  messagesSent     += other.messagesSent;
+  messagesReceived += other.messagesReceived;
+  waitTime         += other.waitTime;
+  return *this;
+}
+
+double ChannelData::getWaitTime() const
+{
+  return std::chrono::duration<double, std::milli>(waitTime).count();
+}
+
+
 // -----------------------------------------------------------------------
 
 void RankData::initialize()
@@ -162,6 +223,12 @@ void RankData::addEventData(EventData ed)
 }
 
 
+void RankData::putChannel(std::string const & name, int remoteRank, ChannelData const & data)
+{
+  channelData[name][remoteRank] += data;
+}
+
+
 void RankData::normalizeTo(sys_clk::time_point t0)
 {
   auto const delta = initializedAt - t0; // duration that this rank initialized after the first rank
@@ -180,6 +247,7 @@ void RankData::normalizeTo(sys_clk::time_point t0)
 void RankData::clear()
 {
   evData.clear();
+  channelData.clear();
 }
 
 sys_clk::duration RankData::getDuration() const
@@ -249,6 +317,12 @@ void EventRegistry::put(Event const & event)
   localRankData.put(event);
 }
 
+void EventRegistry::putChannel(std::string const & name, std::map<int, ChannelData> const & data)
+{
+  for (auto const & remote : data)
+    localRankData.putChannel(name, remote.first, remote.second);
+}
+
 Event & EventRegistry::getStoredEvent(std::string const & name)
 {
   // Reset the prefix for creation of a stored event. Using prefixes with stored events is possible
@@ -342,6 +416,31 @@ void EventRegistry::writeSummary(std::ostream &out)
         t.printRow(e.first, ev.max, ev.maxRank, ev.min, ev.minRank, rel);
       }
     }
+    auto channels = getChannelStats(globalRankData);
+    if (not channels.empty()) { // Print communication per channel
+      out << endl << endl;
+      size_t nameWidth = 7;
+      for (auto & c : channels)
+        nameWidth = std::max(nameWidth, c.first.size());
+
+      Table t(out);
+      t.addColumn("Channel", nameWidth);
+      t.addColumn("Sent[B]", 12);
+      t.addColumn("Received[B]", 12);
+      t.addColumn("Messages", 10);
+      t.addColumn("MaxWait[ms]", 12);
+      t.addColumn("MaxOnRank", 10);
+      t.addColumn("MinWait[ms]", 12);
+      t.addColumn("MinOnRank", 10);
+      t.printHeader();
+
+      for (auto & c : channels) {
+        auto & ch = c.second;
+        t.printRow(c.first, ch.total.bytesSent, ch.total.bytesReceived,
+                   ch.total.messagesSent + ch.total.messagesReceived,
+                   ch.maxWait, ch.maxRank, ch.minWait, ch.minRank);
+      }
+    }
   }
 }
 
@@ -381,11 +480,27 @@ void EventRegistry::writeJSON(std::ostream & out)
           });
       }
     }
+    auto jChannels = json::array();
+    for (auto const & channel : rank.channelData) {
+      for (auto const & remote : channel.second) {
+        auto const & c = remote.second;
+        jChannels.push_back({
+            {"Name", channel.first},
+            {"RemoteRank", remote.first},
+            {"BytesSent", c.bytesSent},
+            {"BytesReceived", c.bytesReceived},
+            {"MessagesSent", c.messagesSent},
+            {"MessagesReceived", c.messagesReceived},
+            {"WaitTime", c.getWaitTime()}
+          });
+      }
+    }
     js["Ranks"].push_back({
         {"Finalized", timepoint_to_string(rank.finalizedAt)},
         {"Initialized", timepoint_to_string(rank.initializedAt)},
         {"Timings", jTimings},
-        {"StateChanges", jStateChanges}
+        {"StateChanges", jStateChanges},
+        {"Channels", jChannels}
       });
   }
   
@@ -420,6 +535,21 @@ void EventRegistry::collect()
   size_t eventsSize = localRankData.evData.size();
   MPI_Gather(&eventsSize, 1, MPI_INT, eventsPerRank.data(), 1, MPI_INT, 0, comm);
 
+  std::vector<MPI_ChannelData> channelSendBuf;
+  for (auto const & channel : localRankData.channelData) {
+    for (auto const & remote : channel.second) {
+      MPI_ChannelData channeldata;
+      assert(channel.first.size() <= sizeof(channeldata.name));
+      channel.first.copy(channeldata.name, sizeof(channeldata.name));
+      channeldata.remoteRank = remote.first;
+      channeldata.data = remote.second;
+      channelSendBuf.push_back(channeldata);
+    }
+  }
+  std::vector<int> channelsPerRank(MPIsize);
+  int channelsSize = channelSendBuf.size();
+  MPI_Gather(&channelsSize, 1, MPI_INT, channelsPerRank.data(), 1, MPI_INT, 0, comm);
+
   std::vector<MPI_EventData> eventSendBuf(eventsSize);
   std::vector<std::unique_ptr<char[]>> packSendBuf(eventsSize);
   int i = 0;
@@ -469,6 +599,10 @@ void EventRegistry::collect()
     ++i;
   }
 
+  // Send the data of all channels after the events
+  MPI_Isend(channelSendBuf.data(), channelSendBuf.size() * sizeof(MPI_ChannelData), MPI_BYTE, 0, 0, comm, &req);
+  requests.push_back(req);
+
   // Receive
   if (rank == 0) {
     for (int i = 0; i < MPIsize; ++i) {
@@ -498,6 +632,12 @@ void EventRegistry::collect()
         EventData ed(ev.name, ev.count, ev.total, ev.max, ev.min, recvData, recvStateChanges);
         data.addEventData(std::move(ed));
       }
+
+      // Receive the data of all channels
+      std::vector<MPI_ChannelData> channels(channelsPerRank[i]);
+      MPI_Recv(channels.data(), channels.size() * sizeof(MPI_ChannelData), MPI_BYTE, i, MPI_ANY_TAG, comm, MPI_STATUS_IGNORE);
+      for (auto const & channel : channels)
+        data.putChannel(channel.name, channel.remoteRank, channel.data);
       globalRankData.push_back(data);      
     }
   }
@@ -58,6 +58,23 @@ private:
   std::vector<int> data;
 };
 
+/// Volume of the messages exchanged with one remote rank over a communication channel and the time blocked for them
+struct ChannelData
+{
+  long bytesSent = 0;
+  long bytesReceived = 0;
+  long messagesSent = 0;
+  long messagesReceived = 0;
+
+  /// Time blocked in receives and in waiting for requests
+  Event::Clock::duration waitTime = Event::Clock::duration::zero();
+
+  ChannelData & operator+=(ChannelData const & other);
+
+  /// Get the wait time in milliseconds
+  double getWaitTime() const;
+};
+
 /// All EventData of one particular rank
 class RankData
 {
@@ -75,6 +92,9 @@ public:
   /// Adds aggregated data for a specific event
   void addEventData(EventData ed);
 
+  /// Adds the data of a channel to a remote rank
+  void putChannel(std::string const & name, int remoteRank, ChannelData const & data);
+
   /// Normalizes all Events to zero time of t0
   void normalizeTo(std::chrono::system_clock::time_point t0);
 
@@ -84,6 +104,9 @@ public:
   /// Map of EventName -> EventData, should be private later
   std::map<std::string, EventData> evData;
 
+  /// Map of channel name -> remote rank -> ChannelData
+  std::map<std::string, std::map<int, ChannelData>> channelData;
+
   std::chrono::system_clock::duration getDuration() const;
 
   std::chrono::system_clock::time_point initializedAt;
@@ -143,6 +166,9 @@ public:
   /// Records the event.
   void put(Event const & event);
 
+  /// Records the data of a communication channel per remote rank, accumulating data of the same name.
+  void putChannel(std::string const & name, std::map<int, ChannelData> const & data);
+
   /// Returns or creates a stored event, i.e., an event with life beyond the current scope
   Event & getStoredEvent(std::string const & name);
 
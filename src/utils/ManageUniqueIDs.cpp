@@ -1,4 +1,5 @@
 #include "utils/ManageUniqueIDs.hpp"
+#include "utils/assertion.hpp"
 
 namespace precice
 {
@@ -7,31 +8,47 @@ namespace utils
 
 int ManageUniqueIDs::getFreeID()
 {
-  bool notFound = true;
-  while (notFound) {
-    if (_ids.count(_lowerLimit) == 0) {
-      notFound = false;
-    }
+  while (isInserted(_lowerLimit)) {
     _lowerLimit++;
   }
-  _ids.insert(_lowerLimit - 1);
+  _lowerLimit++;
   return _lowerLimit - 1;
 }
 
+int ManageUniqueIDs::getFreeIDs(int count)
+{
+  assertion(count >= 0, count);
+  int first = _lowerLimit;
+  for (int id = first; id < first + count; id++) {
+    if (isInserted(id)) {
+      first = id + 1;
+    }
+  }
+  _lowerLimit = first + count;
+  return first;
+}
+
 bool ManageUniqueIDs::insertID(int id)
 {
-  if (_ids.count(id) != 0)
+  assertion(id >= 0, id);
+  if (id < _lowerLimit || isInserted(id))
     return false;
-  else
-    _ids.insert(id);
+  if (static_cast<size_t>(id) >= _insertedIDs.size())
+    _insertedIDs.resize(id + 1, false);
+  _insertedIDs[id] = true;
   return true;
 }
 
 void ManageUniqueIDs::resetIDs()
 {
-  _ids.clear();
+  _insertedIDs.clear();
   _lowerLimit = 0;
 }
 
+bool ManageUniqueIDs::isInserted(int id) const
+{
+  return static_cast<size_t>(id) < _insertedIDs.size() && _insertedIDs[id];
+}
+
 } // namespace utils
 } // namespace precice
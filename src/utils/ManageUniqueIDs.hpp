@@ -1,6 +1,6 @@
 #pragma once
 
-#include <set>
+#include <vector>
 
 namespace precice
 {
@@ -8,12 +8,24 @@ namespace utils
 {
 
 /// Manages a set of unique IDs.
+/*
+ * All IDs below a counter are in use. IDs above the counter, which have been inserted explicitly,
+ * are marked in a bitmap. Obtaining an ID is therefore O(1) amortized and needs no memory per ID.
+ */
 class ManageUniqueIDs
 {
 public:
   // Returns the next free, i.e. unique, ID.
   int getFreeID();
 
+  /**
+   * @brief Returns the first ID of a contiguous range of count free IDs.
+   *
+   * The range starts at the first position at which count consecutive IDs are free.
+   * Free IDs skipped to find such a range are not handed out anymore.
+   */
+  int getFreeIDs(int count);
+
   /**
     * @brief Inserts an ID which has to be unique.
     *
@@ -26,10 +38,13 @@ public:
   void resetIDs();
 
 private:
-  /// Stores all used IDs.
-  std::set<int> _ids;
+  /// Returns true if the ID at or above _lowerLimit has been inserted.
+  bool isInserted(int id) const;
+
+  /// Marks IDs which have been inserted explicitly, indexed by the ID.
+  std::vector<bool> _insertedIDs;
 
-  /// Marks next ID to be given, from lower to higher values.
+  /// Marks next ID to be given, from lower to higher values. All IDs below are in use.
   int _lowerLimit = 0;
 };
 
@@ -43,13 +43,9 @@ double MasterSlave:: l2norm(const Eigen::VectorXd& vec)
 
   assertion(_communication.get() != nullptr);
   assertion(_communication->isConnected());
-  double localSum2 = 0.0;
+  double localSum2 = localSquaredNorm(vec);
   double globalSum2 = 0.0;
 
-  for(int i=0; i<vec.size(); i++){
-    localSum2 += vec(i)*vec(i);
-  }
-
   // localSum is modified, do not use afterwards
   allreduceSum(localSum2, globalSum2, 1);
    /* old loop over all slaves solution
@@ -82,14 +78,9 @@ double MasterSlave:: dot(const Eigen::VectorXd& vec1, const Eigen::VectorXd& vec
 
   assertion(_communication.get() != nullptr);
   assertion(_communication->isConnected());
-  assertion(vec1.size()==vec2.size(), vec1.size(), vec2.size());
-  double localSum = 0.0;
+  double localSum = localDot(vec1, vec2);
   double globalSum = 0.0;
 
-  for(int i=0; i<vec1.size(); i++){
-    localSum += vec1(i)*vec2(i);
-  }
-
   // localSum is modified, do not use afterwards
   allreduceSum(localSum, globalSum, 1);
 
@@ -113,6 +104,33 @@ double MasterSlave:: dot(const Eigen::VectorXd& vec1, const Eigen::VectorXd& vec
   return globalSum;
 }
 
+double MasterSlave:: localDot(const Eigen::VectorXd& vec1, const Eigen::VectorXd& vec2)
+{
+  assertion(vec1.size()==vec2.size(), vec1.size(), vec2.size());
+  if(not _masterMode && not _slaveMode){ //old case
+    return vec1.dot(vec2);
+  }
+
+  double localSum = 0.0;
+  for(int i=0; i<vec1.size(); i++){
+    localSum += vec1(i)*vec2(i);
+  }
+  return localSum;
+}
+
+double MasterSlave:: localSquaredNorm(const Eigen::VectorXd& vec)
+{
+  if(not _masterMode && not _slaveMode){ //old case
+    return vec.squaredNorm();
+  }
+
+  double localSum2 = 0.0;
+  for(int i=0; i<vec.size(); i++){
+    localSum2 += vec(i)*vec(i);
+  }
+  return localSum2;
+}
+
 void MasterSlave:: reset()
 {
   TRACE();
@@ -233,6 +251,21 @@ MasterSlave::allreduceSum(int& sendData, int& rcvData, int size) {
   }
 }
 
+Eigen::VectorXd
+MasterSlave::allreduceSum(const Eigen::VectorXd& localSums) {
+  TRACE(localSums.size());
+
+  if ((not _masterMode && not _slaveMode) || localSums.size() == 0) {
+    return localSums;
+  }
+
+  // The send buffer is modified by the reduction
+  Eigen::VectorXd sendData = localSums;
+  Eigen::VectorXd globalSums(localSums.size());
+  allreduceSum(sendData.data(), globalSums.data(), localSums.size());
+  return globalSums;
+}
+
 void
 MasterSlave::broadcast(bool& value) {
   TRACE();
@@ -38,6 +38,12 @@ public:
   // The dot product of 2 vectors is calculated on distributed data.
   static double dot(const Eigen::VectorXd& vec1, const Eigen::VectorXd& vec2);
 
+  /// The local part of dot(), summed in the same order, for several dot products reduced at once by allreduceSum().
+  static double localDot(const Eigen::VectorXd& vec1, const Eigen::VectorXd& vec2);
+
+  /// The local part of the squared l2norm(), summed in the same order, to be reduced by allreduceSum().
+  static double localSquaredNorm(const Eigen::VectorXd& vec);
+
   static void reset();
 
   static void reduceSum(double* sendData, double* rcvData, int size);
@@ -50,6 +56,9 @@ public:
 
   static void allreduceSum(int& sendData, int& rcvData, int size);
 
+  /// Sums several local partial sums over all ranks in a single reduction.
+  static Eigen::VectorXd allreduceSum(const Eigen::VectorXd& localSums);
+
   static void broadcast(bool& value);
 
   static void broadcast(double& value);
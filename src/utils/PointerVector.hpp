@@ -108,6 +108,14 @@ public:
       _content.push_back ( content );
    }
 
+   /**
+    * @brief Reserves storage for at least count pointers.
+    */
+   void reserve ( size_t count )
+   {
+      _content.reserve ( count );
+   }
+
    /**
     * @brief Inserts elements into vector.
     *
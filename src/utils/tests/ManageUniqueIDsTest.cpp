@@ -16,6 +16,31 @@ BOOST_AUTO_TEST_CASE(UniqueIDs)
   BOOST_TEST(success);
   id = uniqueIDs.getFreeID();
   BOOST_TEST(id == 3);
+  success = uniqueIDs.insertID(1);
+  BOOST_TEST(not success);
+  uniqueIDs.resetIDs();
+  id = uniqueIDs.getFreeID();
+  BOOST_TEST(id == 0);
+}
+
+BOOST_AUTO_TEST_CASE(UniqueIDRanges)
+{
+  ManageUniqueIDs uniqueIDs;
+  int first = uniqueIDs.getFreeIDs(3);
+  BOOST_TEST(first == 0);
+  int id = uniqueIDs.getFreeID();
+  BOOST_TEST(id == 3);
+  // The range has to skip the inserted ID
+  bool success = uniqueIDs.insertID(6);
+  BOOST_TEST(success);
+  first = uniqueIDs.getFreeIDs(3);
+  BOOST_TEST(first == 7);
+  success = uniqueIDs.insertID(8);
+  BOOST_TEST(not success);
+  id = uniqueIDs.getFreeID();
+  BOOST_TEST(id == 10);
+  first = uniqueIDs.getFreeIDs(0);
+  BOOST_TEST(first == 11);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
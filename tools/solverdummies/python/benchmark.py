@@ -0,0 +1,75 @@
+from __future__ import division, print_function
+
+import argparse
+import timeit
+import numpy as np
+
+from mpi4py import MPI
+import PySolverInterface
+from PySolverInterface import *
+
+parser = argparse.ArgumentParser(description="Measures the time spent in the block methods of the Python bindings.")
+parser.add_argument("configurationFileName", help="Name of the xml config file.", type=str)
+parser.add_argument("participantName", help="Name of the solver.", type=str)
+parser.add_argument("meshName", help="Name of the mesh.", type=str)
+parser.add_argument("--vertices", help="Number of vertices.", type=int, default=1000000)
+parser.add_argument("--lists", help="Also measure passing Python lists instead of NumPy arrays.", action="store_true")
+
+try:
+    args = parser.parse_args()
+except SystemExit:
+    print("")
+    print("Usage: python ./benchmark.py precice-config participant-name mesh-name [--vertices N] [--lists]")
+    quit()
+
+if args.participantName == "SolverOne":
+    writeDataName, readDataName = "Forces", "Velocities"
+else:
+    writeDataName, readDataName = "Velocities", "Forces"
+
+N = args.vertices
+
+interface = PySolverInterface(args.participantName, 0, 1)
+interface.configure(args.configurationFileName)
+
+meshID = interface.getMeshID(args.meshName)
+dimensions = interface.getDimensions()
+writeDataID = interface.getDataID(writeDataName, meshID)
+readDataID = interface.getDataID(readDataName, meshID)
+
+positions = np.random.rand(N * dimensions)
+vertexIDs = np.zeros(N, dtype=np.intc)
+writeData = np.random.rand(N * dimensions)
+readData = np.zeros(N * dimensions)
+
+
+def measure(name, function, repetitions=1):
+    seconds = timeit.timeit(function, number=repetitions) / repetitions
+    print("BENCHMARK: {:<40} {:10.3f} ms".format(name, seconds * 1e3))
+
+
+measure("setMeshVertices (numpy)", lambda: interface.setMeshVertices(meshID, N, positions, vertexIDs))
+
+dt = interface.initialize()
+
+measure("writeBlockVectorData (numpy)", lambda: interface.writeBlockVectorData(writeDataID, N, vertexIDs, writeData), 10)
+measure("readBlockVectorData (numpy)", lambda: interface.readBlockVectorData(readDataID, N, vertexIDs, readData), 10)
+if args.lists:
+    vertexIDList = vertexIDs.tolist()
+    writeDataList = writeData.tolist()
+    readDataList = readData.tolist()
+    measure("writeBlockVectorData (list)", lambda: interface.writeBlockVectorData(writeDataID, N, vertexIDList, writeDataList))
+    measure("readBlockVectorData (list)", lambda: interface.readBlockVectorData(readDataID, N, vertexIDList, readDataList))
+
+while interface.isCouplingOngoing():
+    if interface.isActionRequired(PyActionWriteIterationCheckpoint()):
+        interface.fulfilledAction(PyActionWriteIterationCheckpoint())
+
+    interface.writeBlockVectorData(writeDataID, N, vertexIDs, writeData)
+    dt = interface.advance(dt)
+    interface.readBlockVectorData(readDataID, N, vertexIDs, readData)
+
+    if interface.isActionRequired(PyActionReadIterationCheckpoint()):
+        interface.fulfilledAction(PyActionReadIterationCheckpoint())
+
+interface.finalize()